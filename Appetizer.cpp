@@ -10,12 +10,20 @@
  */
 
 #include "Appetizer.hpp"
+#include "StableHash.hpp"
+#include <utility>
 
 /**
     * Default constructor.
     * Initializes all private members with default values.
 */
-Appetizer::Appetizer() : Dish("UNKNOWN", {}, 0, 0.0, CuisineType::OTHER), serving_style_(ServingStyle::PLATED), spiciness_level_(0), vegetarian_(false) {}
+Appetizer::Appetizer() : Appetizer(allocator_type()) {}
+
+Appetizer::Appetizer(const allocator_type& allocator)
+        : Dish(allocator), serving_style_(PLATED), spiciness_level_(0) {
+    setDietaryAttribute(VEGETARIAN, false);
+    Instrumentation::count(Instrumentation::Class::APPETIZER, Instrumentation::Event::CONSTRUCTION);
+}
 /**
     * Parameterized constructor.
     * @param name The name of the appetizer.
@@ -24,11 +32,52 @@ Appetizer::Appetizer() : Dish("UNKNOWN", {}, 0, 0.0, CuisineType::OTHER), servin
     * @param price The price of the appetizer.
     * @param cuisine_type The cuisine type of the appetizer.
     * @param serving_style The serving style of the appetizer.
-    * @param spiciness_level The spiciness level of the appetizer.
+    * @param spiciness_level The spiciness level of the appetizer, clamped to [0, kMaxSpicinessLevel].
     * @param vegetarian Flag indicating if the appetizer is vegetarian.
+    * @param allocator The allocator for the name and ingredient list.
 */
-Appetizer::Appetizer(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type, ServingStyle serving_style, int spiciness_level, bool vegetarian)
-        : Dish(name, ingredients, prep_time, price, cuisine_type), serving_style_(serving_style), spiciness_level_(spiciness_level), vegetarian_(vegetarian) {}
+Appetizer::Appetizer(std::string_view name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type, ServingStyle serving_style, int spiciness_level, bool vegetarian,
+                     const allocator_type& allocator)
+        : Dish(name, ingredients, prep_time, price, cuisine_type, allocator), serving_style_(toEnumBits(serving_style, BUFFET, PLATED)), spiciness_level_(clampLevel(spiciness_level, kMaxSpicinessLevel)) {
+    setDietaryAttribute(VEGETARIAN, vegetarian);
+    Instrumentation::count(Instrumentation::Class::APPETIZER, Instrumentation::Event::CONSTRUCTION);
+}
+
+// Allocator-extended copy and move constructors
+Appetizer::Appetizer(const Appetizer& other, const allocator_type& allocator) : Dish(other, allocator), serving_style_(other.serving_style_), spiciness_level_(other.spiciness_level_) {
+    Instrumentation::count(Instrumentation::Class::APPETIZER, Instrumentation::Event::COPY);
+}
+
+Appetizer::Appetizer(Appetizer&& other, const allocator_type& allocator) : Dish(std::move(other), allocator), serving_style_(other.serving_style_), spiciness_level_(other.spiciness_level_) {
+    Instrumentation::count(Instrumentation::Class::APPETIZER, Instrumentation::Event::MOVE);
+}
+
+#if BISTRO_INSTRUMENTATION
+// Copy and move constructors and assignment, counted
+Appetizer::Appetizer(const Appetizer& other) : Dish(other), serving_style_(other.serving_style_), spiciness_level_(other.spiciness_level_) {
+    Instrumentation::count(Instrumentation::Class::APPETIZER, Instrumentation::Event::COPY);
+}
+
+Appetizer::Appetizer(Appetizer&& other) noexcept : Dish(std::move(other)), serving_style_(other.serving_style_), spiciness_level_(other.spiciness_level_) {
+    Instrumentation::count(Instrumentation::Class::APPETIZER, Instrumentation::Event::MOVE);
+}
+
+Appetizer& Appetizer::operator=(const Appetizer& other) {
+    Instrumentation::count(Instrumentation::Class::APPETIZER, Instrumentation::Event::COPY);
+    Dish::operator=(other);
+    serving_style_ = other.serving_style_;
+    spiciness_level_ = other.spiciness_level_;
+    return *this;
+}
+
+Appetizer& Appetizer::operator=(Appetizer&& other) {
+    Instrumentation::count(Instrumentation::Class::APPETIZER, Instrumentation::Event::MOVE);
+    Dish::operator=(std::move(other));
+    serving_style_ = other.serving_style_;
+    spiciness_level_ = other.spiciness_level_;
+    return *this;
+}
+#endif
 
 // Accessors
 
@@ -36,7 +85,7 @@ Appetizer::Appetizer(const std::string& name, const std::vector<std::string>& in
     * @return The serving style of the appetizer (as an enum).
 */
 Appetizer::ServingStyle Appetizer::getServingStyle() const {
-    return serving_style_;
+    return static_cast<ServingStyle>(serving_style_);
 }
 
 /**
@@ -50,7 +99,7 @@ int Appetizer::getSpicinessLevel() const {
    * @return True if the appetizer is vegetarian, false otherwise.
 */
 bool Appetizer::isVegetarian() const {
-    return vegetarian_;
+    return (getDietaryAttributes() & VEGETARIAN) != 0;
 }
 
 // Mutators
@@ -58,10 +107,12 @@ bool Appetizer::isVegetarian() const {
     * Sets the serving style of the appetizer.
     * @param serving_style The new serving style.
     * @post Sets the private member `serving_style_` to the value of the
-    parameter.
+    parameter; a value outside the enum is stored as PLATED.
 */
 void Appetizer::setServingStyle(const ServingStyle& serving_style) {
-    serving_style_ = serving_style;
+    notifyChanging(DishField::SERVING_STYLE);
+    serving_style_ = toEnumBits(serving_style, BUFFET, PLATED);
+    notifyChanged(DishField::SERVING_STYLE);
 }
 
 /**
@@ -69,20 +120,34 @@ void Appetizer::setServingStyle(const ServingStyle& serving_style) {
     * @param spiciness_level An integer representing the spiciness level of
     the appetizer.
     * @post Sets the private member `spiciness_level_` to the value of the
-    parameter.
+    parameter, clamped to [0, kMaxSpicinessLevel].
 */
 void Appetizer::setSpicinessLevel(const int& spiciness_level) {
-    spiciness_level_ = spiciness_level;
+    notifyChanging(DishField::SPICINESS_LEVEL);
+    spiciness_level_ = clampLevel(spiciness_level, kMaxSpicinessLevel);
+    notifyChanged(DishField::SPICINESS_LEVEL);
 }
 
 /**
     * Sets the vegetarian flag of the appetizer.
     * @param vegetarian A boolean indicating if the appetizer is
     vegetarian.
-    * @post Sets the private member `vegetarian_` to the value of the
-    parameter.
+    * @post Records VEGETARIAN in the dish's dietary attributes with the
+    value of the parameter.
 */
 void Appetizer::setVegetarian(const bool& vegetarian) {
-    vegetarian_ = vegetarian;
+    notifyChanging(DishField::VEGETARIAN);
+    setDietaryAttribute(VEGETARIAN, vegetarian);
+    notifyChanged(DishField::VEGETARIAN);
 }
 
+
+// Comparison and hashing
+bool Appetizer::operator==(const Appetizer& other) const {
+    return serving_style_ == other.serving_style_ && spiciness_level_ == other.spiciness_level_ && Dish::operator==(other);
+}
+
+std::uint64_t Appetizer::hash() const {
+    // The leading 1 tags the class (2 for MainCourse, 3 for Dessert)
+    return hashCombine(Dish::hash(), 1u | static_cast<unsigned>(serving_style_) << 8 | static_cast<unsigned>(spiciness_level_) << 16);
+}
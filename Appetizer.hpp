@@ -4,6 +4,8 @@
  *
  * The Appetizer class includes attributes such as ServingStyle, spiciness levels, and if vegetarian.
  * It provides constructors, accessor and mutator functions, and inherits the Dish class properties.
+ * The serving style and spiciness level are bit-fields that fit in the tail padding of Dish, so an Appetizer is no
+ * larger than a Dish.
  *
  * @date 09/19/2024
  * @author Mitchell Lipyansky
@@ -13,12 +15,19 @@
 #define APPETIZER_HPP
 
 #include "Dish.hpp"
+#include "Instrumentation.hpp"
 
 class Appetizer : public Dish {
 public:
     // ServingStyle enum definition
     enum ServingStyle { PLATED, FAMILY_STYLE, BUFFET };
 
+    // Spiciness levels run from 0 to kMaxSpicinessLevel
+    static constexpr int kMaxSpicinessLevel = 10;
+
+    // Upper bound on sizeof(Appetizer) (64-bit libstdc++)
+    static constexpr std::size_t kSizeBudget = 104;
+
     // Constructors
     /**
     * Default constructor.
@@ -26,6 +35,12 @@ public:
     */
     Appetizer();
 
+    /**
+    * Default constructor with an allocator.
+    * @param allocator The allocator for the name and ingredient list.
+    */
+    explicit Appetizer(const allocator_type& allocator);
+
     /**
     * Parameterized constructor.
     * @param name The name of the appetizer.
@@ -34,10 +49,29 @@ public:
     * @param price The price of the appetizer.
     * @param cuisine_type The cuisine type of the appetizer.
     * @param serving_style The serving style of the appetizer.
-    * @param spiciness_level The spiciness level of the appetizer.
+    * @param spiciness_level The spiciness level of the appetizer, clamped to [0, kMaxSpicinessLevel].
     * @param vegetarian Flag indicating if the appetizer is vegetarian.
+    * @param allocator The allocator for the name and ingredient list (default is the default memory resource).
+    */
+    Appetizer(std::string_view name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type, ServingStyle serving_style, int spiciness_level, bool vegetarian,
+              const allocator_type& allocator = {});
+
+    /**
+    * Copy and move constructors that place the copy in the given allocator (used by std::pmr containers).
+    */
+    Appetizer(const Appetizer& other, const allocator_type& allocator);
+    Appetizer(Appetizer&& other, const allocator_type& allocator);
+
+#if BISTRO_INSTRUMENTATION
+    /**
+    * Copy and move constructors and assignment, declared so that Instrumentation counts them; without
+    * instrumentation the implicit ones are used.
     */
-    Appetizer(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type, ServingStyle serving_style, int spiciness_level, bool vegetarian);
+    Appetizer(const Appetizer& other);
+    Appetizer(Appetizer&& other) noexcept;
+    Appetizer& operator=(const Appetizer& other);
+    Appetizer& operator=(Appetizer&& other);
+#endif
 
     // Accessors
     /**
@@ -60,7 +94,7 @@ public:
     * Sets the serving style of the appetizer.
     * @param serving_style The new serving style.
     * @post Sets the private member `serving_style_` to the value of the
-    parameter.
+    parameter; a value outside the enum is stored as PLATED.
     */
     void setServingStyle(const ServingStyle& serving_style);
 
@@ -69,7 +103,7 @@ public:
     * @param spiciness_level An integer representing the spiciness level of
     the appetizer.
     * @post Sets the private member `spiciness_level_` to the value of the
-    parameter.
+    parameter, clamped to [0, kMaxSpicinessLevel].
     */
     void setSpicinessLevel(const int& spiciness_level);
 
@@ -77,15 +111,38 @@ public:
     * Sets the vegetarian flag of the appetizer.
     * @param vegetarian A boolean indicating if the appetizer is
     vegetarian.
-    * @post Sets the private member `vegetarian_` to the value of the
-    parameter.
+    * @post Records VEGETARIAN in the dish's dietary attributes with the
+    value of the parameter.
     */
     void setVegetarian(const bool& vegetarian);
 
+    // Comparison and hashing
+    /**
+    * Compares every field of two appetizers, including the dish parts (see Dish::operator==).
+    * @param other The appetizer to compare with.
+    * @return True if every compared field is equal.
+    */
+    bool operator==(const Appetizer& other) const;
+    bool operator!=(const Appetizer& other) const { return !(*this == other); }
+
+    /**
+    * @return The stable 64-bit hash of the fields compared by operator==; it differs from Dish::hash() of the same
+    dish, so appetizers and other dishes with equal dish parts rarely collide.
+    */
+    std::uint64_t hash() const;
+
 private:
-    ServingStyle serving_style_;
-    int spiciness_level_;
-    bool vegetarian_;
+    std::uint8_t serving_style_ : 2;    // a ServingStyle
+    std::uint8_t spiciness_level_ : 4;  // 0 to kMaxSpicinessLevel
+};
+
+static_assert(sizeof(Appetizer) <= Appetizer::kSizeBudget, "Appetizer exceeds its size budget; pack the new field or raise kSizeBudget");
+
+namespace std {
+template <>
+struct hash<Appetizer> {
+    std::size_t operator()(const Appetizer& dish) const { return static_cast<std::size_t>(dish.hash()); }
 };
+} // namespace std
 
 #endif // APPETIZER_HPP
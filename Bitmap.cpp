@@ -0,0 +1,79 @@
+/**
+ * @file Bitmap.cpp
+ * @brief This file contains the implementation of the Bitmap class, a dense selection bitmap over menu rows.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "Bitmap.hpp"
+
+// Default Constructor
+Bitmap::Bitmap() : size_(0) {}
+
+// Parameterized Constructor
+Bitmap::Bitmap(std::size_t size, bool value)
+        : words_((size + 63) / 64, value ? ~std::uint64_t{0} : 0), size_(size) {
+    clearTail();
+}
+
+std::size_t Bitmap::count() const {
+    std::size_t total = 0;
+    for (std::uint64_t word : words_) {
+        total += static_cast<std::size_t>(__builtin_popcountll(word));
+    }
+    return total;
+}
+
+std::vector<std::size_t> Bitmap::toIndices() const {
+    std::vector<std::size_t> indices;
+    indices.reserve(count());
+    forEachSet([&indices](std::size_t index) { indices.push_back(index); });
+    return indices;
+}
+
+void Bitmap::resize(std::size_t size, bool value) {
+    const std::size_t old_size = size_;
+    words_.resize((size + 63) / 64, value ? ~std::uint64_t{0} : 0);
+    size_ = size;
+    if (value && size > old_size && (old_size & 63) != 0) {
+        // The partially used word that already existed must have its new high bits set too
+        words_[old_size >> 6] |= ~std::uint64_t{0} << (old_size & 63);
+    }
+    clearTail();
+}
+
+void Bitmap::fill(bool value) {
+    for (std::uint64_t& word : words_) {
+        word = value ? ~std::uint64_t{0} : 0;
+    }
+    clearTail();
+}
+
+Bitmap& Bitmap::operator&=(const Bitmap& other) {
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+        words_[w] &= other.words_[w];
+    }
+    return *this;
+}
+
+Bitmap& Bitmap::operator|=(const Bitmap& other) {
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+        words_[w] |= other.words_[w];
+    }
+    return *this;
+}
+
+Bitmap& Bitmap::andNot(const Bitmap& other) {
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+        words_[w] &= ~other.words_[w];
+    }
+    return *this;
+}
+
+// Helper function to keep the bits past size_ zero
+void Bitmap::clearTail() {
+    if ((size_ & 63) != 0) {
+        words_.back() &= (std::uint64_t{1} << (size_ & 63)) - 1;
+    }
+}
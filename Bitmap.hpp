@@ -0,0 +1,133 @@
+/**
+ * @file Bitmap.hpp
+ * @brief This file contains the declaration of the Bitmap class, a dense selection bitmap over menu rows.
+ *
+ * A Bitmap stores one bit per dish row packed into 64-bit words, so that filters over large menus
+ * can be combined with word-wide AND/OR/ANDN operations instead of per-object branching.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef BITMAP_HPP
+#define BITMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Bitmap {
+public:
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty bitmap holding zero bits.
+     */
+    Bitmap();
+
+    /**
+     * Parameterized constructor.
+     * @param size The number of bits in the bitmap.
+     * @param value The initial value of every bit (default is false).
+     */
+    explicit Bitmap(std::size_t size, bool value = false);
+
+    // Accessors
+    /**
+     * @return The number of bits in the bitmap.
+     */
+    std::size_t size() const { return size_; }
+
+    /**
+     * @return The number of 64-bit words backing the bitmap.
+     */
+    std::size_t wordCount() const { return words_.size(); }
+
+    /**
+     * @return A pointer to the backing words. Bits past size() in the last word are always zero.
+     */
+    const std::uint64_t* words() const { return words_.data(); }
+    std::uint64_t* words() { return words_.data(); }
+
+    /**
+     * @param index The bit to test.
+     * @return True if the bit at index is set.
+     */
+    bool test(std::size_t index) const { return (words_[index >> 6] >> (index & 63)) & 1u; }
+
+    /**
+     * @return The number of set bits.
+     */
+    std::size_t count() const;
+
+    /**
+     * @return The indices of all set bits in increasing order.
+     */
+    std::vector<std::size_t> toIndices() const;
+
+    // Mutators
+    /**
+     * Resizes the bitmap.
+     * @param size The new number of bits.
+     * @param value The value of any newly added bits (default is false).
+     * @post Existing bits below the new size are preserved.
+     */
+    void resize(std::size_t size, bool value = false);
+
+    /**
+     * Sets or clears a single bit.
+     * @param index The bit to change.
+     * @param value The new value of the bit (default is true).
+     */
+    void set(std::size_t index, bool value = true) {
+        const std::uint64_t mask = std::uint64_t{1} << (index & 63);
+        if (value) {
+            words_[index >> 6] |= mask;
+        } else {
+            words_[index >> 6] &= ~mask;
+        }
+    }
+
+    /**
+     * Clears a single bit.
+     * @param index The bit to clear.
+     */
+    void reset(std::size_t index) { set(index, false); }
+
+    /**
+     * Sets every bit to value.
+     * @param value The value to fill with.
+     */
+    void fill(bool value);
+
+    /**
+     * In-place word-wide bitwise operations. Both bitmaps must have the same size.
+     * @post `this` holds this AND other / this OR other / this AND NOT other respectively.
+     */
+    Bitmap& operator&=(const Bitmap& other);
+    Bitmap& operator|=(const Bitmap& other);
+    Bitmap& andNot(const Bitmap& other);
+
+    /**
+     * Calls f(index) for every set bit in increasing order.
+     */
+    template <typename F>
+    void forEachSet(F&& f) const {
+        for (std::size_t w = 0; w < words_.size(); ++w) {
+            std::uint64_t word = words_[w];
+            while (word != 0) {
+                f((w << 6) + static_cast<std::size_t>(__builtin_ctzll(word)));
+                word &= word - 1;
+            }
+        }
+    }
+
+private:
+    std::vector<std::uint64_t> words_;
+    std::size_t size_;
+
+    // Clears the unused bits of the last word so that count() and comparisons stay exact
+    void clearTail();
+};
+
+#endif // BITMAP_HPP
@@ -0,0 +1,587 @@
+/**
+ * @file ChangeLog.cpp
+ * @brief This file contains the implementation of the ChangeLog and ChangeLogReplayer classes, an append-only file of
+ * dish changes that keeps replicas of a menu in sync.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "ChangeLog.hpp"
+#include "Appetizer.hpp"
+#include "Dessert.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>   // For open
+#include <unistd.h>  // For pread, write, fdatasync, ftruncate, close
+
+namespace {
+
+constexpr char kMagic[8] = {'B', 'S', 'T', 'R', 'C', 'L', 'O', 'G'};
+constexpr std::size_t kFrameHeader = 8;  // payload length and CRC
+
+// CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320), one table lookup per byte
+constexpr std::array<std::uint32_t, 256> makeCrcTable() {
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 1u) != 0 ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+constexpr std::array<std::uint32_t, 256> kCrcTable = makeCrcTable();
+
+std::uint32_t crc32(const char* data, std::size_t size) {
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (std::size_t i = 0; i < size; ++i) {
+        crc = kCrcTable[(crc ^ static_cast<unsigned char>(data[i])) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// Encoding
+
+void putU32(std::string& out, std::size_t at, std::uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out[at + i] = static_cast<char>((value >> (8 * i)) & 0xFFu);
+    }
+}
+
+std::uint32_t getU32(const char* bytes) {
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value |= static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    }
+    return value;
+}
+
+// LEB128 varint; signed values are zigzag-mapped first so that small negative numbers stay short
+void putVarint(std::string& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out += static_cast<char>(value | 0x80);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+void putSigned(std::string& out, std::int64_t value) {
+    putVarint(out, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+}
+
+void putString(std::string& out, std::string_view text) {
+    putVarint(out, text.size());
+    out.append(text.data(), text.size());
+}
+
+// Reads the encoding back; any read past the end or overlong varint clears ok
+struct Cursor {
+    const char* at;
+    const char* end;
+    bool ok;
+
+    std::uint64_t varint() {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64 && at < end; shift += 7) {
+            const auto byte = static_cast<unsigned char>(*at++);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (byte < 0x80) {
+                return value;
+            }
+        }
+        ok = false;
+        return 0;
+    }
+
+    std::int64_t signedVarint() {
+        const std::uint64_t value = varint();
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    std::string_view string() {
+        const std::uint64_t length = varint();
+        if (!ok || length > static_cast<std::uint64_t>(end - at)) {
+            ok = false;
+            return {};
+        }
+        const std::string_view text(at, static_cast<std::size_t>(length));
+        at += length;
+        return text;
+    }
+};
+
+// One decoded change
+struct Delta {
+    DishId id;
+    DishField field;
+    std::int64_t number;
+    std::string text;
+    std::vector<std::string> list;
+    std::vector<MainCourse::SideDish> side_dishes;
+};
+
+// Appends the current value of a field of a dish; subclass fields are only ever reported by their own subclass
+void encodeValue(std::string& out, const Dish& dish, DishField field) {
+    switch (field) {
+        case DishField::NAME:
+            putString(out, dish.getNameView());
+            break;
+        case DishField::INGREDIENTS:
+            putVarint(out, dish.getIngredientCount());
+            for (std::size_t i = 0; i < dish.getIngredientCount(); ++i) {
+                putString(out, dish.getIngredient(i));
+            }
+            break;
+        case DishField::PREP_TIME:
+            putSigned(out, dish.getPrepTime());
+            break;
+        case DishField::PRICE:
+            putSigned(out, dish.getPriceCents());
+            break;
+        case DishField::CUISINE_TYPE:
+            putVarint(out, static_cast<std::uint64_t>(dish.getCuisine()));
+            break;
+        case DishField::SERVING_STYLE:
+            putVarint(out, static_cast<std::uint64_t>(static_cast<const Appetizer&>(dish).getServingStyle()));
+            break;
+        case DishField::SPICINESS_LEVEL:
+            putVarint(out, static_cast<std::uint64_t>(static_cast<const Appetizer&>(dish).getSpicinessLevel()));
+            break;
+        case DishField::VEGETARIAN:
+            putVarint(out, (dish.getDietaryAttributes() & Dish::VEGETARIAN) != 0 ? 1 : 0);
+            break;
+        case DishField::COOKING_METHOD:
+            putVarint(out, static_cast<std::uint64_t>(static_cast<const MainCourse&>(dish).getCookingMethod()));
+            break;
+        case DishField::PROTEIN_TYPE:
+            putString(out, static_cast<const MainCourse&>(dish).getProteinTypeView());
+            break;
+        case DishField::GLUTEN_FREE:
+            putVarint(out, (dish.getDietaryAttributes() & Dish::GLUTEN_FREE) != 0 ? 1 : 0);
+            break;
+        case DishField::SIDE_DISHES: {
+            const Span<const MainCourse::SideDish> side_dishes = static_cast<const MainCourse&>(dish).getSideDishesView();
+            putVarint(out, side_dishes.size());
+            for (const MainCourse::SideDish& side_dish : side_dishes) {
+                putString(out, side_dish.name);
+                putVarint(out, static_cast<std::uint64_t>(side_dish.category));
+            }
+            break;
+        }
+        case DishField::FLAVOR_PROFILE:
+            putVarint(out, static_cast<std::uint64_t>(static_cast<const Dessert&>(dish).getFlavorProfile()));
+            break;
+        case DishField::SWEETNESS_LEVEL:
+            putVarint(out, static_cast<std::uint64_t>(static_cast<const Dessert&>(dish).getSweetnessLevel()));
+            break;
+        case DishField::CONTAINS_NUTS:
+            putVarint(out, (dish.getDietaryAttributes() & Dish::NUT_FREE) != 0 ? 0 : 1);
+            break;
+    }
+}
+
+// Decodes one delta; the dish ID is stored as the gap from the previous delta of the frame
+bool decodeDelta(Cursor& cursor, DishId& previous, Delta& delta) {
+    const std::int64_t id = static_cast<std::int64_t>(previous) + cursor.signedVarint();
+    if (cursor.at >= cursor.end || id < 0 || id >= static_cast<std::int64_t>(kNoDishId)) {
+        return false;
+    }
+    const auto field = static_cast<unsigned char>(*cursor.at++);
+    if (field > static_cast<unsigned char>(DishField::CONTAINS_NUTS)) {
+        return false;
+    }
+    delta.id = previous = static_cast<DishId>(id);
+    delta.field = static_cast<DishField>(field);
+    switch (delta.field) {
+        case DishField::NAME:
+        case DishField::PROTEIN_TYPE:
+            delta.text = cursor.string();
+            break;
+        case DishField::INGREDIENTS: {
+            const std::uint64_t count = cursor.varint();
+            delta.list.clear();
+            for (std::uint64_t i = 0; i < count && cursor.ok; ++i) {
+                delta.list.emplace_back(cursor.string());
+            }
+            break;
+        }
+        case DishField::PREP_TIME:
+        case DishField::PRICE:
+            delta.number = cursor.signedVarint();
+            break;
+        case DishField::SIDE_DISHES: {
+            const std::uint64_t count = cursor.varint();
+            delta.side_dishes.clear();
+            for (std::uint64_t i = 0; i < count && cursor.ok; ++i) {
+                const std::string_view name = cursor.string();
+                const std::uint64_t category = cursor.varint();
+                if (category > MainCourse::VEGETABLE) {
+                    return false;
+                }
+                delta.side_dishes.emplace_back(name, static_cast<MainCourse::Category>(category));
+            }
+            break;
+        }
+        default:
+            delta.number = static_cast<std::int64_t>(cursor.varint());
+            break;
+    }
+    return cursor.ok;
+}
+
+// Decodes a whole frame payload, so that a frame is applied entirely or not at all
+bool decodeFrame(const char* payload, std::size_t size, std::vector<Delta>& deltas) {
+    Cursor cursor{payload, payload + size, true};
+    const std::uint64_t count = cursor.varint();
+    if (!cursor.ok || count > size) {
+        return false;
+    }
+    deltas.resize(static_cast<std::size_t>(count));
+    DishId previous = 0;
+    for (Delta& delta : deltas) {
+        if (!decodeDelta(cursor, previous, delta)) {
+            return false;
+        }
+    }
+    return cursor.at == cursor.end;
+}
+
+// Calls visit(payload, size) for each complete frame with a matching CRC, from the start of `data`, while it returns
+// true; returns the length of the frames accepted
+template <typename Visitor>
+std::size_t scanFrames(std::string_view data, Visitor&& visit) {
+    std::size_t position = 0;
+    while (data.size() - position >= kFrameHeader) {
+        const std::uint32_t length = getU32(data.data() + position);
+        const std::uint32_t crc = getU32(data.data() + position + 4);
+        if (length > data.size() - position - kFrameHeader) {
+            break;
+        }
+        const char* payload = data.data() + position + kFrameHeader;
+        if (crc32(payload, length) != crc || !visit(payload, length)) {
+            break;
+        }
+        position += kFrameHeader + length;
+    }
+    return position;
+}
+
+// Applies a delta through the setter of a dish; fields of another subclass and out-of-range enums are refused
+template <typename T>
+bool apply(T& dish, const Delta& delta) {
+    const std::int64_t number = delta.number;
+    switch (delta.field) {
+        case DishField::NAME: dish.setName(delta.text); return true;
+        case DishField::INGREDIENTS: dish.setIngredients(delta.list); return true;
+        case DishField::PREP_TIME: dish.setPrepTime(static_cast<int>(number)); return true;
+        case DishField::PRICE: dish.setPrice(static_cast<double>(number) / 100.0); return true;
+        case DishField::CUISINE_TYPE:
+            if (number > static_cast<std::int64_t>(Dish::CuisineType::OTHER)) {
+                return false;
+            }
+            dish.setCuisineType(static_cast<Dish::CuisineType>(number));
+            return true;
+        default:
+            break;
+    }
+    if constexpr (std::is_same_v<T, Appetizer>) {
+        switch (delta.field) {
+            case DishField::SERVING_STYLE:
+                if (number > Appetizer::BUFFET) {
+                    return false;
+                }
+                dish.setServingStyle(static_cast<Appetizer::ServingStyle>(number));
+                return true;
+            case DishField::SPICINESS_LEVEL: dish.setSpicinessLevel(static_cast<int>(number)); return true;
+            case DishField::VEGETARIAN: dish.setVegetarian(number != 0); return true;
+            default: return false;
+        }
+    } else if constexpr (std::is_same_v<T, MainCourse>) {
+        switch (delta.field) {
+            case DishField::COOKING_METHOD:
+                if (number > MainCourse::RAW) {
+                    return false;
+                }
+                dish.setCookingMethod(static_cast<MainCourse::CookingMethod>(number));
+                return true;
+            case DishField::PROTEIN_TYPE: dish.setProteinType(delta.text); return true;
+            case DishField::GLUTEN_FREE: dish.setGlutenFree(number != 0); return true;
+            case DishField::SIDE_DISHES: dish.setSideDishes(delta.side_dishes); return true;
+            default: return false;
+        }
+    } else {
+        switch (delta.field) {
+            case DishField::FLAVOR_PROFILE:
+                if (number > Dessert::UMAMI) {
+                    return false;
+                }
+                dish.setFlavorProfile(static_cast<Dessert::FlavorProfile>(number));
+                return true;
+            case DishField::SWEETNESS_LEVEL: dish.setSweetnessLevel(static_cast<int>(number)); return true;
+            case DishField::CONTAINS_NUTS: dish.setContainsNuts(number != 0); return true;
+            default: return false;
+        }
+    }
+}
+
+// File helpers
+
+void writeAll(int fd, const char* data, std::size_t size) {
+    while (size > 0) {
+        const ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(std::string("ChangeLog: write failed: ") + std::strerror(errno));
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+// Reads from `offset` to the end of the file into `out`
+void readFrom(int fd, std::uint64_t offset, std::string& out) {
+    out.clear();
+    char chunk[1 << 16];
+    for (;;) {
+        const ssize_t count = ::pread(fd, chunk, sizeof(chunk), static_cast<off_t>(offset + out.size()));
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(std::string("ChangeLog: read failed: ") + std::strerror(errno));
+        }
+        if (count == 0) {
+            return;
+        }
+        out.append(chunk, static_cast<std::size_t>(count));
+    }
+}
+
+} // namespace
+
+// ChangeLog
+
+// Parameterized Constructor
+ChangeLog::ChangeLog(const std::string& path, const Options& options)
+        : fd_(::open(path.c_str(), O_RDWR | O_CREAT, 0644)), options_(options), pending_count_(0), last_id_(0), recorded_(0), settled_(0),
+          durable_(0), writing_(false), file_size_(0), stats_{0, 0, 0}, callers_(0) {
+    if (fd_ < 0) {
+        throw std::runtime_error("ChangeLog: cannot open " + path);
+    }
+    std::string contents;
+    try {
+        readFrom(fd_, 0, contents);
+        // A file shorter than the magic was torn while it was being created
+        const std::size_t magic_length = std::min(contents.size(), sizeof(kMagic));
+        if (std::memcmp(contents.data(), kMagic, magic_length) != 0) {
+            throw std::runtime_error("ChangeLog: " + path + " is not a change log");
+        }
+        std::vector<Delta> deltas;
+        file_size_ = contents.size() < sizeof(kMagic)
+                             ? 0
+                             : sizeof(kMagic) + scanFrames(std::string_view(contents).substr(sizeof(kMagic)), [&deltas](const char* payload, std::size_t size) {
+                                   return decodeFrame(payload, size, deltas);
+                               });
+        if (file_size_ < contents.size() && ::ftruncate(fd_, static_cast<off_t>(file_size_)) != 0) {
+            throw std::runtime_error("ChangeLog: cannot cut the torn end of " + path);
+        }
+        if (::lseek(fd_, static_cast<off_t>(file_size_), SEEK_SET) < 0) {
+            throw std::runtime_error("ChangeLog: cannot seek in " + path);
+        }
+        if (file_size_ == 0) {
+            writeAll(fd_, kMagic, sizeof(kMagic));
+            file_size_ = sizeof(kMagic);
+        }
+    } catch (...) {
+        ::close(fd_);
+        throw;
+    }
+}
+
+// Destructor
+ChangeLog::~ChangeLog() {
+    try {
+        commit();
+    } catch (const std::exception&) {
+        // Reported by commit() to callers that commit before destroying the log
+    }
+    ::close(fd_);
+}
+
+// Accessors
+ChangeLog::Stats ChangeLog::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+std::uint64_t ChangeLog::fileSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return file_size_;
+}
+
+// Mutators
+void ChangeLog::record(const Dish& dish, DishField field) {
+    const DishId id = dish.getId();
+    if (id == kNoDishId) {
+        throw std::invalid_argument("ChangeLog::record: dish has no ID");
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    append(lock, dish, field);
+}
+
+std::uint64_t ChangeLog::commit() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    std::string error = commitUpTo(lock, recorded_);
+    if (error.empty()) {
+        error = deferred_error_;
+    }
+    deferred_error_.clear();
+    if (!error.empty()) {
+        throw std::runtime_error(error);
+    }
+    return durable_;
+}
+
+void ChangeLog::dishChanged(const Dish& dish, DishField field) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (dish.getId() == kNoDishId) {
+        deferred_error_ = "ChangeLog: a change to a dish without an ID was not recorded";
+        return;
+    }
+    append(lock, dish, field);
+}
+
+// Helper functions
+
+void ChangeLog::append(std::unique_lock<std::mutex>& lock, const Dish& dish, DishField field) {
+    const DishId id = dish.getId();
+    putSigned(pending_, static_cast<std::int64_t>(id) - static_cast<std::int64_t>(last_id_));
+    pending_ += static_cast<char>(field);
+    encodeValue(pending_, dish, field);
+    last_id_ = id;
+    ++pending_count_;
+    ++recorded_;
+    ++stats_.deltas;
+    if (pending_.size() >= options_.batch_bytes && !writing_) {
+        std::string error = commitUpTo(lock, recorded_);
+        if (!error.empty()) {
+            deferred_error_ = std::move(error);
+        }
+    }
+}
+
+std::string ChangeLog::commitUpTo(std::unique_lock<std::mutex>& lock, std::uint64_t target) {
+    const std::uint64_t from = settled_;
+    ++callers_;
+    while (settled_ < target) {
+        if (writing_) {
+            committed_.wait(lock);
+            continue;
+        }
+
+        // Lead: take every pending delta, including those of the callers waiting, and write them as one frame
+        writing_ = true;
+        std::string frame(kFrameHeader, '\0');
+        putVarint(frame, pending_count_);
+        frame += pending_;
+        putU32(frame, 0, static_cast<std::uint32_t>(frame.size() - kFrameHeader));
+        putU32(frame, 4, crc32(frame.data() + kFrameHeader, frame.size() - kFrameHeader));
+        const std::uint64_t batch_begin = settled_;
+        const std::uint64_t batch_end = recorded_;
+        pending_.clear();
+        pending_count_ = 0;
+        last_id_ = 0;
+
+        lock.unlock();
+        std::string error;
+        try {
+            writeAll(fd_, frame.data(), frame.size());
+            if (options_.sync && ::fdatasync(fd_) != 0) {
+                throw std::runtime_error(std::string("ChangeLog: fdatasync failed: ") + std::strerror(errno));
+            }
+        } catch (const std::runtime_error& failure) {
+            error = failure.what();
+        }
+        lock.lock();
+
+        writing_ = false;
+        settled_ = batch_end;
+        if (error.empty()) {
+            durable_ += batch_end - batch_begin;
+            file_size_ += frame.size();
+            ++stats_.commits;
+            stats_.bytes += frame.size();
+        } else {
+            // Cut a partial frame off again so that the file still ends on a commit; the batch is lost
+            if (::ftruncate(fd_, static_cast<off_t>(file_size_)) == 0) {
+                ::lseek(fd_, static_cast<off_t>(file_size_), SEEK_SET);
+            }
+            lost_.push_back({batch_begin, batch_end, error});
+        }
+        committed_.notify_all();
+    }
+
+    std::string error;
+    for (const LostBatch& batch : lost_) {
+        if (batch.end > from && batch.begin < target) {
+            error = batch.error;
+            break;
+        }
+    }
+    // A later caller starts past every lost batch, so they are only kept while someone may still look
+    if (--callers_ == 0) {
+        lost_.clear();
+    }
+    return error;
+}
+
+// ChangeLogReplayer
+
+// Parameterized Constructor
+ChangeLogReplayer::ChangeLogReplayer(const std::string& path) : fd_(::open(path.c_str(), O_RDONLY)), offset_(sizeof(kMagic)) {
+    if (fd_ < 0) {
+        throw std::runtime_error("ChangeLogReplayer: cannot open " + path);
+    }
+    char magic[sizeof(kMagic)];
+    if (::pread(fd_, magic, sizeof(magic), 0) != static_cast<ssize_t>(sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+        ::close(fd_);
+        throw std::runtime_error("ChangeLogReplayer: " + path + " is not a change log");
+    }
+}
+
+// Destructor
+ChangeLogReplayer::~ChangeLogReplayer() {
+    ::close(fd_);
+}
+
+// Mutators
+ChangeLogReplayer::Result ChangeLogReplayer::catchUp(Menu& menu) {
+    Result result{0, 0, 0, true};
+    readFrom(fd_, offset_, buffer_);
+    std::vector<Delta> deltas;
+    const std::size_t consumed = scanFrames(buffer_, [&](const char* payload, std::size_t size) {
+        if (!decodeFrame(payload, size, deltas)) {
+            return false;
+        }
+        for (const Delta& delta : deltas) {
+            const bool applied = delta.id < menu.size() && menu.visit(delta.id, [&delta](auto& dish) { return apply(dish, delta); });
+            ++(applied ? result.deltas : result.skipped);
+        }
+        ++result.commits;
+        return true;
+    });
+    offset_ += consumed;
+    result.complete = consumed == buffer_.size();
+    return result;
+}
@@ -0,0 +1,191 @@
+/**
+ * @file ChangeLog.hpp
+ * @brief This file contains the declaration of the ChangeLog and ChangeLogReplayer classes, an append-only file of
+ * dish changes that keeps replicas of a menu in sync without redistributing the whole menu.
+ *
+ * A ChangeLog is a DishObserver: registered with a Menu (addObserver), it records every change made through the
+ * setters of Dish and its subclasses as a delta of (dish ID, field, new value). Deltas are buffered and written in
+ * batches with group commit: commit() makes every delta recorded so far durable, and concurrent callers share one
+ * write and one fdatasync. A batch that reaches Options::batch_bytes is committed by the call that filled it.
+ * A batch that cannot be written is lost: it is cut off the file, does not count as durable, and every commit()
+ * waiting for one of its deltas throws. Recording never throws from the observer callback, which would leave the
+ * observers after the log unnotified; a batch lost by an automatic commit is reported by the next commit().
+ *
+ * File layout: the magic "BSTRCLOG", then one frame per commit:
+ * - payload length (uint32, little-endian) and the CRC-32 of the payload (uint32, little-endian);
+ * - payload: the number of deltas (varint), then per delta the zigzag varint gap from the previous delta's dish ID,
+ *   the field (one byte) and the value. Integers and enums are varints (prices in zigzag cents), strings are a
+ *   varint length and the bytes, lists are a varint count and their elements; ingredients are logged by name,
+ *   since IngredientIds differ between processes.
+ * A crash can leave a torn frame at the end of the file. Replay stops before it, and opening a ChangeLog on the file
+ * cuts it off, so a log is always a sequence of complete commits.
+ *
+ * A ChangeLogReplayer tails a log: catchUp() reads the frames added since its last call and applies them through
+ * the setters of another menu built from the same dishes (so that DishIds match), whose own observers follow as
+ * usual.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef CHANGE_LOG_HPP
+#define CHANGE_LOG_HPP
+
+#include "Dish.hpp"
+#include "DishObserver.hpp"
+#include "MainCourse.hpp"
+#include "Menu.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class ChangeLog : public DishObserver {
+public:
+    struct Options {
+        std::size_t batch_bytes;  // a batch this large is committed without waiting for commit()
+        bool sync;                // fdatasync every commit; without it a commit survives a process crash, not a power loss
+    };
+
+    // Counters since the log was opened
+    struct Stats {
+        std::uint64_t deltas;   // deltas recorded
+        std::uint64_t commits;  // frames written
+        std::uint64_t bytes;    // bytes written, frame headers included
+    };
+
+    // Default options: 64 KiB batches, synced
+    static constexpr Options kDefaultOptions = {std::size_t{64} << 10, true};
+
+    // Constructors
+    /**
+     * Opens a log for appending, creating it if needed. A torn frame left at the end by a crash is cut off.
+     * @param path The log file.
+     * @param options The batch size and durability (default is kDefaultOptions).
+     * @throw std::runtime_error if the file cannot be opened or is not a change log.
+     */
+    explicit ChangeLog(const std::string& path, const Options& options = kDefaultOptions);
+
+    ChangeLog(const ChangeLog&) = delete;
+    ChangeLog& operator=(const ChangeLog&) = delete;
+
+    /**
+     * Destructor.
+     * Commits the pending deltas; errors are ignored at this point, so call commit() first to see them.
+     */
+    ~ChangeLog() override;
+
+    // Accessors
+    /**
+     * @return The counters since the log was opened.
+     */
+    Stats stats() const;
+
+    /**
+     * @return The size of the file after the last commit.
+     */
+    std::uint64_t fileSize() const;
+
+    // Mutators
+    /**
+     * Records the current value of one field of a dish. Safe to call from several threads on different dishes.
+     * @param dish The changed dish; it must have an ID.
+     * @param field The field to record.
+     * A full batch is committed by this call; if it cannot be written, the next commit() throws.
+     * @throw std::invalid_argument if the dish has no ID.
+     */
+    void record(const Dish& dish, DishField field);
+
+    /**
+     * Makes every delta recorded before the call durable. Callers that arrive while another commit is writing wait
+     * for it and commit everything recorded in the meantime together.
+     * @return The number of deltas durable so far.
+     * @throw std::runtime_error if a batch holding deltas this call waited for could not be written, or if a batch
+     * committed by record() or a change without a dish ID was lost since the last commit().
+     */
+    std::uint64_t commit();
+
+    // DishObserver: records the change like record(), but never throws
+    void dishChanged(const Dish& dish, DishField field) override;
+
+private:
+    int fd_;
+    Options options_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable committed_;
+    std::string pending_;            // encoded deltas of the next frame
+    std::uint64_t pending_count_;    // deltas in pending_
+    DishId last_id_;                 // dish ID of the last delta in pending_
+    std::uint64_t recorded_;         // deltas recorded
+    std::uint64_t settled_;          // deltas whose batch was written or lost
+    std::uint64_t durable_;          // deltas written
+    bool writing_;                   // a commit is writing outside the lock
+    std::uint64_t file_size_;
+    Stats stats_;
+
+    // A batch that could not be written: deltas (begin, end] in recording order
+    struct LostBatch {
+        std::uint64_t begin;
+        std::uint64_t end;
+        std::string error;
+    };
+    std::vector<LostBatch> lost_;  // batches lost while callers_ > 0, so that each of them can check its own
+    std::size_t callers_;          // threads inside commitUpTo
+    std::string deferred_error_;   // a loss no caller was waiting for, raised by the next commit()
+
+    // Helper functions: appends one delta to the pending batch, committing the batch once it is full
+    void append(std::unique_lock<std::mutex>& lock, const Dish& dish, DishField field);
+
+    // Commits as the leader or waits for the leader until the first `target` deltas are settled;
+    // returns the error of a lost batch holding deltas that were not settled on entry, or an empty string
+    std::string commitUpTo(std::unique_lock<std::mutex>& lock, std::uint64_t target);
+};
+
+class ChangeLogReplayer {
+public:
+    // What one catchUp() call did
+    struct Result {
+        std::size_t commits;  // frames applied
+        std::size_t deltas;   // deltas applied
+        std::size_t skipped;  // deltas for a position past the end of the menu or a field the dish does not have
+        bool complete;        // false if the file ends in a torn or corrupt frame, which was not applied
+    };
+
+    // Constructors
+    /**
+     * Opens a log for reading from its beginning.
+     * @param path The log file.
+     * @throw std::runtime_error if the file cannot be opened or is not a change log.
+     */
+    explicit ChangeLogReplayer(const std::string& path);
+
+    ChangeLogReplayer(const ChangeLogReplayer&) = delete;
+    ChangeLogReplayer& operator=(const ChangeLogReplayer&) = delete;
+    ~ChangeLogReplayer();
+
+    // Accessors
+    /**
+     * @return The file offset up to which frames have been applied.
+     */
+    std::uint64_t offset() const { return offset_; }
+
+    // Mutators
+    /**
+     * Applies every complete frame written since the last call, in order, through the setters of the menu's dishes.
+     * A torn frame at the end is left for a later call, once the writer has finished it.
+     * @param menu The replica; its dish at position p receives the deltas of DishId p.
+     * @return What was applied.
+     * @throw std::runtime_error if the file cannot be read.
+     */
+    Result catchUp(Menu& menu);
+
+private:
+    int fd_;
+    std::uint64_t offset_;
+    std::string buffer_;  // file bytes past offset_, reused between calls
+};
+
+#endif // CHANGE_LOG_HPP
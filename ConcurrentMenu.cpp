@@ -0,0 +1,157 @@
+/**
+ * @file ConcurrentMenu.cpp
+ * @brief This file contains the implementation of the ConcurrentMenu class, a menu that many threads can read
+ * without locks while writers publish batched changes as new versions.
+ *
+ * Every epoch and version access is sequentially consistent. A reader announces epoch e and then loads the current
+ * version; a writer swaps the version, retires the old one with epoch E (the value it moves epoch_ past) and then
+ * scans the slots. If the reader loaded the old version, its announcement came before the swap, so e <= E and the
+ * scan sees it; a reader that announced a later epoch can only load the new version.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "ConcurrentMenu.hpp"
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+// Update
+
+ConcurrentMenu::Update& ConcurrentMenu::Update::setPrice(std::size_t position, double price) {
+    changes_.push_back({Change::Kind::PRICE, position, price, {}});
+    return *this;
+}
+
+ConcurrentMenu::Update& ConcurrentMenu::Update::setIngredients(std::size_t position, std::vector<std::string> ingredients) {
+    changes_.push_back({Change::Kind::INGREDIENTS, position, 0.0, std::move(ingredients)});
+    return *this;
+}
+
+ConcurrentMenu::Update& ConcurrentMenu::Update::add(MenuItem item) {
+    changes_.push_back({Change::Kind::ADD, additions_.size(), 0.0, {}});
+    additions_.push_back(std::move(item));
+    return *this;
+}
+
+// Constructors
+ConcurrentMenu::ConcurrentMenu() : current_(new Version{0, 0, {}}), epoch_(1) {}
+
+ConcurrentMenu::ConcurrentMenu(const Menu& menu) : ConcurrentMenu() {
+    Version* version = new Version{0, menu.size(), {}};
+    for (std::size_t position = 0; position < menu.size(); ++position) {
+        if (position % kChunkSize == 0) {
+            version->chunks.push_back(std::make_shared<Chunk>());
+            version->chunks.back()->items.reserve(kChunkSize);
+        }
+        version->chunks.back()->items.push_back(menu.item(position));
+    }
+    delete current_.exchange(version);
+}
+
+// Destructor
+ConcurrentMenu::~ConcurrentMenu() {
+    for (const std::pair<std::uint64_t, const Version*>& retired : retired_) {
+        delete retired.second;
+    }
+    delete current_.load();
+}
+
+// Readers
+
+ConcurrentMenu::Snapshot ConcurrentMenu::snapshot() const {
+    // Threads start their search in different slots, and each returns to the slot it used last
+    thread_local std::size_t hint = std::hash<std::thread::id>()(std::this_thread::get_id());
+    for (std::size_t attempt = 0;; ++attempt) {
+        const std::size_t index = (hint + attempt) % kReaderSlots;
+        std::atomic<std::uint64_t>& slot = slots_[index].epoch;
+        std::uint64_t free = 0;
+        if (slot.load(std::memory_order_relaxed) == 0 && slot.compare_exchange_strong(free, epoch_.load())) {
+            hint = index;
+            return Snapshot(&slot, current_.load());
+        }
+        if (attempt % kReaderSlots == kReaderSlots - 1) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// Writers
+
+std::uint64_t ConcurrentMenu::publish(const Update& update) {
+    std::lock_guard<std::mutex> lock(writer_);
+    std::unique_ptr<Version> next = std::make_unique<Version>(*current_.load());
+    ++next->number;
+
+    // Copy a chunk the first time the batch touches it; later changes to it go to the copy
+    std::vector<bool> copied(next->chunks.size(), false);
+    const auto writable = [&](std::size_t chunk) -> Chunk& {
+        if (!copied[chunk]) {
+            next->chunks[chunk] = std::make_shared<Chunk>(*next->chunks[chunk]);
+            copied[chunk] = true;
+        }
+        return *next->chunks[chunk];
+    };
+    const auto dish = [&](std::size_t position) -> Dish& {
+        if (position >= next->size) {
+            throw std::out_of_range("ConcurrentMenu: no dish at position " + std::to_string(position));
+        }
+        MenuItem& item = writable(position / kChunkSize).items[position % kChunkSize];
+        return std::visit([](Dish& dish) -> Dish& { return dish; }, item);
+    };
+
+    for (const Update::Change& change : update.changes_) {
+        switch (change.kind) {
+            case Update::Change::Kind::PRICE:
+                dish(change.position).setPrice(change.price);
+                break;
+            case Update::Change::Kind::INGREDIENTS:
+                dish(change.position).setIngredients(change.ingredients);
+                break;
+            case Update::Change::Kind::ADD:
+                if (next->size % kChunkSize == 0) {
+                    next->chunks.push_back(std::make_shared<Chunk>());
+                    next->chunks.back()->items.reserve(kChunkSize);
+                    copied.push_back(true);
+                }
+                writable(next->chunks.size() - 1).items.push_back(update.additions_[change.position]);
+                ++next->size;
+                break;
+        }
+    }
+
+    const std::uint64_t number = next->number;
+    const Version* replaced = current_.exchange(next.release());
+    retired_.emplace_back(epoch_.fetch_add(1), replaced);
+    reclaim();
+    return number;
+}
+
+std::size_t ConcurrentMenu::retiredCount() const {
+    std::lock_guard<std::mutex> lock(writer_);
+    return retired_.size();
+}
+
+// Helper functions
+
+void ConcurrentMenu::reclaim() {
+    std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+    for (const ReaderSlot& slot : slots_) {
+        const std::uint64_t epoch = slot.epoch.load();
+        if (epoch != 0 && epoch < oldest) {
+            oldest = epoch;
+        }
+    }
+    // A version retired at epoch E may be held by readers that announced E or earlier
+    std::size_t kept = 0;
+    for (const std::pair<std::uint64_t, const Version*>& retired : retired_) {
+        if (retired.first < oldest) {
+            delete retired.second;
+        } else {
+            retired_[kept++] = retired;
+        }
+    }
+    retired_.resize(kept);
+}
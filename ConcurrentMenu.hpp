@@ -0,0 +1,224 @@
+/**
+ * @file ConcurrentMenu.hpp
+ * @brief This file contains the declaration of the ConcurrentMenu class, a menu that many threads can read without
+ * locks while writers publish batched changes as new versions.
+ *
+ * The menu is a sequence of immutable versions. A version holds the dishes in fixed-size chunks shared between
+ * versions: a writer copies only the chunks its batch touches, applies the changes to the copies and publishes the
+ * new version with one atomic pointer swap, so readers see either all of a batch or none of it.
+ *
+ * Readers take a Snapshot. Taking one announces the current epoch in a reader slot and then loads the current
+ * version; it never blocks and never touches a reference count. A replaced version is retired with the epoch of
+ * its replacement and freed once no reader slot announces an epoch that old, so a snapshot stays valid (and
+ * unchanged) for as long as it is held. Snapshots are meant to be short-lived: a held snapshot delays the
+ * reclamation of every version retired after it was taken. Writers are serialized with a mutex.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef CONCURRENT_MENU_HPP
+#define CONCURRENT_MENU_HPP
+
+#include "Menu.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+class ConcurrentMenu {
+public:
+    static constexpr std::size_t kChunkSize = 16;    // dishes per copy-on-write chunk
+    static constexpr std::size_t kReaderSlots = 128;  // snapshots that can be held at the same time
+
+private:
+    struct Chunk {
+        std::vector<MenuItem> items;
+    };
+
+    // Chunks are shared between versions and never changed once their version is published
+    struct Version {
+        std::uint64_t number;
+        std::size_t size;
+        std::vector<std::shared_ptr<Chunk>> chunks;
+    };
+
+    // The epoch a reader announced (0 when the slot is free), alone on its cache line so readers do not contend
+    struct alignas(64) ReaderSlot {
+        std::atomic<std::uint64_t> epoch{0};
+    };
+
+public:
+    // A consistent, unchanging view of one version of the menu
+    class Snapshot {
+    public:
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+        Snapshot(Snapshot&& other) noexcept : slot_(std::exchange(other.slot_, nullptr)), version_(other.version_) {}
+
+        /**
+         * Destructor.
+         * Releases the reader slot, allowing older versions to be reclaimed.
+         */
+        ~Snapshot() {
+            if (slot_ != nullptr) {
+                slot_->store(0, std::memory_order_release);
+            }
+        }
+
+        /**
+         * @return The version number; every publish() increments it.
+         */
+        std::uint64_t version() const { return version_->number; }
+
+        /**
+         * @return The number of dishes in this version.
+         */
+        std::size_t size() const { return version_->size; }
+
+        /**
+         * @param position A menu position.
+         * @return The dish at that position, as its concrete type.
+         */
+        const MenuItem& item(std::size_t position) const {
+            return version_->chunks[position / kChunkSize]->items[position % kChunkSize];
+        }
+
+        /**
+         * @param position A menu position.
+         * @return The common Dish part of the dish at that position.
+         */
+        const Dish& operator[](std::size_t position) const {
+            return std::visit([](const Dish& dish) -> const Dish& { return dish; }, item(position));
+        }
+
+        /**
+         * Calls visitor with every dish (as const MenuItem&) in menu order.
+         */
+        template <typename Visitor>
+        void forEach(Visitor&& visitor) const {
+            for (const std::shared_ptr<Chunk>& chunk : version_->chunks) {
+                for (const MenuItem& item : chunk->items) {
+                    visitor(item);
+                }
+            }
+        }
+
+    private:
+        friend class ConcurrentMenu;
+
+        Snapshot(std::atomic<std::uint64_t>* slot, const Version* version) : slot_(slot), version_(version) {}
+
+        std::atomic<std::uint64_t>* slot_;
+        const Version* version_;
+    };
+
+    // A batch of changes, applied together by publish()
+    class Update {
+    public:
+        /**
+         * Queues a price change.
+         * @param position The menu position of the dish.
+         * @param price The new price.
+         * @return This update, for chaining.
+         */
+        Update& setPrice(std::size_t position, double price);
+
+        /**
+         * Queues an ingredient list change.
+         * @param position The menu position of the dish.
+         * @param ingredients The new ingredients.
+         * @return This update, for chaining.
+         */
+        Update& setIngredients(std::size_t position, std::vector<std::string> ingredients);
+
+        /**
+         * Queues a new dish at the end of the menu.
+         * @param item The dish.
+         * @return This update, for chaining.
+         */
+        Update& add(MenuItem item);
+
+        /**
+         * @return True if no change is queued.
+         */
+        bool empty() const { return changes_.empty(); }
+
+    private:
+        friend class ConcurrentMenu;
+
+        // One queued change; an ADD refers to its dish in additions_ by position
+        struct Change {
+            enum class Kind { PRICE, INGREDIENTS, ADD } kind;
+            std::size_t position;
+            double price;
+            std::vector<std::string> ingredients;
+        };
+
+        std::vector<Change> changes_;
+        std::vector<MenuItem> additions_;
+    };
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty menu at version 0.
+     */
+    ConcurrentMenu();
+
+    /**
+     * Parameterized constructor.
+     * Copies every dish of a menu, in menu order, into version 0.
+     * @param menu The menu to copy.
+     */
+    explicit ConcurrentMenu(const Menu& menu);
+
+    ConcurrentMenu(const ConcurrentMenu&) = delete;
+    ConcurrentMenu& operator=(const ConcurrentMenu&) = delete;
+
+    /**
+     * Destructor.
+     * Every snapshot must have been released.
+     */
+    ~ConcurrentMenu();
+
+    // Readers
+    /**
+     * Takes a snapshot of the current version without locking. Waits only if every reader slot is in use.
+     * @return The snapshot.
+     */
+    Snapshot snapshot() const;
+
+    // Writers
+    /**
+     * Applies a batch of changes and publishes the result as the next version. Readers see all of the batch or
+     * none of it. Safe to call from several threads; publishers are serialized.
+     * @param update The changes, applied in the order they were queued.
+     * @return The number of the new version.
+     * @throw std::out_of_range if a change refers to a position past the end of the menu; nothing is published.
+     */
+    std::uint64_t publish(const Update& update);
+
+    /**
+     * @return The number of replaced versions not yet reclaimed (kept alive by snapshots).
+     */
+    std::size_t retiredCount() const;
+
+private:
+    std::atomic<const Version*> current_;
+    std::atomic<std::uint64_t> epoch_;
+    mutable std::array<ReaderSlot, kReaderSlots> slots_;
+    mutable std::mutex writer_;
+    std::vector<std::pair<std::uint64_t, const Version*>> retired_;  // (epoch of retirement, version), under writer_
+
+    // Helper function: free the retired versions no reader can still see (writer_ held)
+    void reclaim();
+};
+
+#endif // CONCURRENT_MENU_HPP
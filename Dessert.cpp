@@ -11,13 +11,20 @@
  */
 
 #include "Dessert.hpp"
+#include "StableHash.hpp"
+#include <utility>
 
 /**
     * Default constructor.
     * Initializes all private members with default values.
 */
-Dessert::Dessert()
-        : Dish("UNKNOWN", {}, 0, 0.0, CuisineType::OTHER), flavor_profile_(FlavorProfile::SWEET), sweetness_level_(0), contains_nuts_(false) {}
+Dessert::Dessert() : Dessert(allocator_type()) {}
+
+Dessert::Dessert(const allocator_type& allocator)
+        : Dish(allocator), flavor_profile_(SWEET), sweetness_level_(0) {
+    setDietaryAttribute(NUT_FREE, true);
+    Instrumentation::count(Instrumentation::Class::DESSERT, Instrumentation::Event::CONSTRUCTION);
+}
 
 /**
     * Parameterized constructor.
@@ -27,11 +34,52 @@ Dessert::Dessert()
     * @param price The price of the dessert.
     * @param cuisine_type The cuisine type of the dessert.
     * @param flavor_profile The flavor profile of the dessert.
-    * @param sweetness_level The sweetness level of the dessert.
+    * @param sweetness_level The sweetness level of the dessert, clamped to [0, kMaxSweetnessLevel].
     * @param contains_nuts Flag indicating if the dessert contains nuts.
+    * @param allocator The allocator for the name and ingredient list.
 */
-Dessert::Dessert(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type, FlavorProfile flavor_profile, int sweetness_level, bool contains_nuts)
-        : Dish(name, ingredients, prep_time, price, cuisine_type), flavor_profile_(flavor_profile), sweetness_level_(sweetness_level), contains_nuts_(contains_nuts) {}
+Dessert::Dessert(std::string_view name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type, FlavorProfile flavor_profile, int sweetness_level, bool contains_nuts,
+                 const allocator_type& allocator)
+        : Dish(name, ingredients, prep_time, price, cuisine_type, allocator), flavor_profile_(toEnumBits(flavor_profile, UMAMI, SWEET)), sweetness_level_(clampLevel(sweetness_level, kMaxSweetnessLevel)) {
+    setDietaryAttribute(NUT_FREE, !contains_nuts);
+    Instrumentation::count(Instrumentation::Class::DESSERT, Instrumentation::Event::CONSTRUCTION);
+}
+
+// Allocator-extended copy and move constructors
+Dessert::Dessert(const Dessert& other, const allocator_type& allocator) : Dish(other, allocator), flavor_profile_(other.flavor_profile_), sweetness_level_(other.sweetness_level_) {
+    Instrumentation::count(Instrumentation::Class::DESSERT, Instrumentation::Event::COPY);
+}
+
+Dessert::Dessert(Dessert&& other, const allocator_type& allocator) : Dish(std::move(other), allocator), flavor_profile_(other.flavor_profile_), sweetness_level_(other.sweetness_level_) {
+    Instrumentation::count(Instrumentation::Class::DESSERT, Instrumentation::Event::MOVE);
+}
+
+#if BISTRO_INSTRUMENTATION
+// Copy and move constructors and assignment, counted
+Dessert::Dessert(const Dessert& other) : Dish(other), flavor_profile_(other.flavor_profile_), sweetness_level_(other.sweetness_level_) {
+    Instrumentation::count(Instrumentation::Class::DESSERT, Instrumentation::Event::COPY);
+}
+
+Dessert::Dessert(Dessert&& other) noexcept : Dish(std::move(other)), flavor_profile_(other.flavor_profile_), sweetness_level_(other.sweetness_level_) {
+    Instrumentation::count(Instrumentation::Class::DESSERT, Instrumentation::Event::MOVE);
+}
+
+Dessert& Dessert::operator=(const Dessert& other) {
+    Instrumentation::count(Instrumentation::Class::DESSERT, Instrumentation::Event::COPY);
+    Dish::operator=(other);
+    flavor_profile_ = other.flavor_profile_;
+    sweetness_level_ = other.sweetness_level_;
+    return *this;
+}
+
+Dessert& Dessert::operator=(Dessert&& other) {
+    Instrumentation::count(Instrumentation::Class::DESSERT, Instrumentation::Event::MOVE);
+    Dish::operator=(std::move(other));
+    flavor_profile_ = other.flavor_profile_;
+    sweetness_level_ = other.sweetness_level_;
+    return *this;
+}
+#endif
 
 // Accessors
 
@@ -39,7 +87,7 @@ Dessert::Dessert(const std::string& name, const std::vector<std::string>& ingred
     * @return The flavor profile of the dessert (as an enum).
 */
 Dessert::FlavorProfile Dessert::getFlavorProfile() const {
-    return flavor_profile_;
+    return static_cast<FlavorProfile>(flavor_profile_);
 }
 
 /**
@@ -53,7 +101,7 @@ int Dessert::getSweetnessLevel() const {
     * @return True if the dessert contains nuts, false otherwise.
 */
 bool Dessert::containsNuts() const {
-    return contains_nuts_;
+    return (getDietaryAttributes() & NUT_FREE) == 0;
 }
 
 // Mutators
@@ -62,10 +110,12 @@ bool Dessert::containsNuts() const {
     * Sets the flavor profile of the dessert.
     * @param flavor_profile The new flavor profile.
     * @post Sets the private member `flavor_profile_` to the value of the
-    parameter.
+    parameter; a value outside the enum is stored as SWEET.
 */
 void Dessert::setFlavorProfile(const FlavorProfile& flavor_profile) {
-    flavor_profile_ = flavor_profile;
+    notifyChanging(DishField::FLAVOR_PROFILE);
+    flavor_profile_ = toEnumBits(flavor_profile, UMAMI, SWEET);
+    notifyChanged(DishField::FLAVOR_PROFILE);
 }
 
 /**
@@ -73,19 +123,33 @@ void Dessert::setFlavorProfile(const FlavorProfile& flavor_profile) {
     * @param sweetness_level An integer representing the sweetness level of
     the dessert.
     * @post Sets the private member `sweetness_level_` to the value of the
-    parameter.
+    parameter, clamped to [0, kMaxSweetnessLevel].
 */
 void Dessert::setSweetnessLevel(const int& sweetness_level) {
-    sweetness_level_ = sweetness_level;
+    notifyChanging(DishField::SWEETNESS_LEVEL);
+    sweetness_level_ = clampLevel(sweetness_level, kMaxSweetnessLevel);
+    notifyChanged(DishField::SWEETNESS_LEVEL);
 }
 
 /**
     * Sets the contains_nuts flag of the dessert.
     * @param contains_nuts A boolean indicating if the dessert contains
     nuts.
-    * @post Sets the private member `contains_nuts_` to the value of the
+    * @post Records NUT_FREE in the dish's dietary attributes as the negation of the value of the
     parameter.
 */
 void Dessert::setContainsNuts(const bool& contains_nuts) {
-    contains_nuts_ = contains_nuts;
+    notifyChanging(DishField::CONTAINS_NUTS);
+    setDietaryAttribute(NUT_FREE, !contains_nuts);
+    notifyChanged(DishField::CONTAINS_NUTS);
+}
+
+// Comparison and hashing
+bool Dessert::operator==(const Dessert& other) const {
+    return flavor_profile_ == other.flavor_profile_ && sweetness_level_ == other.sweetness_level_ && Dish::operator==(other);
+}
+
+std::uint64_t Dessert::hash() const {
+    // The leading 3 tags the class (1 for Appetizer, 2 for MainCourse)
+    return hashCombine(Dish::hash(), 3u | static_cast<unsigned>(flavor_profile_) << 8 | static_cast<unsigned>(sweetness_level_) << 16);
 }
@@ -5,6 +5,7 @@
  * The Dessert class includes attributes such as flavor profile, sweetness level, and if it contains nuts.
  * and if gluten free.
  * It provides constructors, accessor and mutator functions, and inherits the Dish class properties.
+ * The flavor profile and sweetness level are packed into one byte in the tail padding of Dish.
  *
  * @date 09/21/2024
  * @author Mitchell Lipyansky
@@ -14,12 +15,19 @@
 #define DESSERT_HPP
 
 #include "Dish.hpp"
+#include "Instrumentation.hpp"
 
 class Dessert : public Dish {
 public:
     // Enum for FlavorProfile
     enum FlavorProfile { SWEET, BITTER, SOUR, SALTY, UMAMI };
 
+    // Sweetness levels run from 0 to kMaxSweetnessLevel
+    static constexpr int kMaxSweetnessLevel = 10;
+
+    // Upper bound on sizeof(Dessert) (64-bit libstdc++)
+    static constexpr std::size_t kSizeBudget = 104;
+
     // Constructors
 
     /**
@@ -28,6 +36,12 @@ public:
     */
     Dessert();
 
+    /**
+    * Default constructor with an allocator.
+    * @param allocator The allocator for the name and ingredient list.
+    */
+    explicit Dessert(const allocator_type& allocator);
+
     /**
     * Parameterized constructor.
     * @param name The name of the dessert.
@@ -36,10 +50,29 @@ public:
     * @param price The price of the dessert.
     * @param cuisine_type The cuisine type of the dessert.
     * @param flavor_profile The flavor profile of the dessert.
-    * @param sweetness_level The sweetness level of the dessert.
+    * @param sweetness_level The sweetness level of the dessert, clamped to [0, kMaxSweetnessLevel].
     * @param contains_nuts Flag indicating if the dessert contains nuts.
+    * @param allocator The allocator for the name and ingredient list (default is the default memory resource).
+    */
+    Dessert(std::string_view name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type, FlavorProfile flavor_profile, int sweetness_level, bool contains_nuts,
+            const allocator_type& allocator = {});
+
+    /**
+    * Copy and move constructors that place the copy in the given allocator (used by std::pmr containers).
+    */
+    Dessert(const Dessert& other, const allocator_type& allocator);
+    Dessert(Dessert&& other, const allocator_type& allocator);
+
+#if BISTRO_INSTRUMENTATION
+    /**
+    * Copy and move constructors and assignment, declared so that Instrumentation counts them; without
+    * instrumentation the implicit ones are used.
     */
-    Dessert(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type, FlavorProfile flavor_profile, int sweetness_level, bool contains_nuts);
+    Dessert(const Dessert& other);
+    Dessert(Dessert&& other) noexcept;
+    Dessert& operator=(const Dessert& other);
+    Dessert& operator=(Dessert&& other);
+#endif
 
     // Accessors
 
@@ -64,7 +97,7 @@ public:
     * Sets the flavor profile of the dessert.
     * @param flavor_profile The new flavor profile.
     * @post Sets the private member `flavor_profile_` to the value of the
-    parameter.
+    parameter; a value outside the enum is stored as SWEET.
     */
     void setFlavorProfile(const FlavorProfile& flavor_profile);
 
@@ -73,7 +106,7 @@ public:
     * @param sweetness_level An integer representing the sweetness level of
     the dessert.
     * @post Sets the private member `sweetness_level_` to the value of the
-    parameter.
+    parameter, clamped to [0, kMaxSweetnessLevel].
     */
     void setSweetnessLevel(const int& sweetness_level);
 
@@ -81,16 +114,39 @@ public:
     * Sets the contains_nuts flag of the dessert.
     * @param contains_nuts A boolean indicating if the dessert contains
     nuts.
-    * @post Sets the private member `contains_nuts_` to the value of the
+    * @post Records NUT_FREE in the dish's dietary attributes as the negation of the value of the
     parameter.
     */
     void setContainsNuts(const bool& contains_nuts);
 
+    // Comparison and hashing
+    /**
+    * Compares every field of two desserts, including the dish parts (see Dish::operator==).
+    * @param other The dessert to compare with.
+    * @return True if every compared field is equal.
+    */
+    bool operator==(const Dessert& other) const;
+    bool operator!=(const Dessert& other) const { return !(*this == other); }
+
+    /**
+    * @return The stable 64-bit hash of the fields compared by operator==; it differs from Dish::hash() of the same
+    dish, so desserts and other dishes with equal dish parts rarely collide.
+    */
+    std::uint64_t hash() const;
+
 private:
-    FlavorProfile flavor_profile_;
-    int sweetness_level_;
-    bool contains_nuts_;
+    std::uint8_t flavor_profile_ : 3;   // a FlavorProfile
+    std::uint8_t sweetness_level_ : 4;  // 0 to kMaxSweetnessLevel
+};
+
+static_assert(sizeof(Dessert) <= Dessert::kSizeBudget, "Dessert exceeds its size budget; pack the new field or raise kSizeBudget");
+
+namespace std {
+template <>
+struct hash<Dessert> {
+    std::size_t operator()(const Dessert& dish) const { return static_cast<std::size_t>(dish.hash()); }
 };
+} // namespace std
 
 #endif // DESSERT_HPP
 
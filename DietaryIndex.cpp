@@ -0,0 +1,107 @@
+/**
+ * @file DietaryIndex.cpp
+ * @brief This file contains the implementation of the DietaryIndex class, a bitset index over the dietary
+ * attributes of the dishes on a menu.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "DietaryIndex.hpp"
+#include "Instrumentation.hpp"
+#include <stdexcept>
+
+// Default Constructor
+DietaryIndex::DietaryIndex() : dish_count_(0) {}
+
+Bitmap DietaryIndex::select(Dish::DietaryMask required, Unknown unknown) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::DIETARY_QUERY);
+    Bitmap result = members_;
+    for (std::size_t attribute = 0; attribute < Dish::kDietaryAttributeCount; ++attribute) {
+        if ((required >> attribute) & 1u) {
+            if (unknown == Unknown::EXCLUDE) {
+                result &= holds_[attribute];
+            } else {
+                result.andNot(fails_[attribute]);
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<DishId> DietaryIndex::find(Dish::DietaryMask required, Unknown unknown) const {
+    std::vector<DishId> ids;
+    select(required, unknown).forEachSet([&](std::size_t id) { ids.push_back(static_cast<DishId>(id)); });
+    return ids;
+}
+
+std::size_t DietaryIndex::memoryUsage() const {
+    return members_.wordCount() * sizeof(std::uint64_t) * (1 + 2 * Dish::kDietaryAttributeCount);
+}
+
+void DietaryIndex::add(const Dish& dish) {
+    const DishId id = dish.getId();
+    if (id == kNoDishId) {
+        throw std::invalid_argument("DietaryIndex::add: dish has no ID");
+    }
+    if (contains(id)) {
+        return;
+    }
+    reserveId(id);
+    members_.set(id);
+    ++dish_count_;
+    store(dish);
+}
+
+void DietaryIndex::remove(const Dish& dish) {
+    const DishId id = dish.getId();
+    if (!contains(id)) {
+        return;
+    }
+    members_.reset(id);
+    for (std::size_t attribute = 0; attribute < Dish::kDietaryAttributeCount; ++attribute) {
+        holds_[attribute].reset(id);
+        fails_[attribute].reset(id);
+    }
+    --dish_count_;
+}
+
+void DietaryIndex::clear() {
+    members_ = Bitmap();
+    holds_.fill(Bitmap());
+    fails_.fill(Bitmap());
+    dish_count_ = 0;
+}
+
+void DietaryIndex::dishChanged(const Dish& dish, DishField field) {
+    if ((field == DishField::VEGETARIAN || field == DishField::GLUTEN_FREE || field == DishField::CONTAINS_NUTS) &&
+        contains(dish.getId())) {
+        store(dish);
+    }
+}
+
+// Helper functions
+
+void DietaryIndex::reserveId(DishId id) {
+    if (id < members_.size()) {
+        return;
+    }
+    const std::size_t size = static_cast<std::size_t>(id) + 1;
+    members_.resize(size);
+    for (std::size_t attribute = 0; attribute < Dish::kDietaryAttributeCount; ++attribute) {
+        holds_[attribute].resize(size);
+        fails_[attribute].resize(size);
+    }
+}
+
+void DietaryIndex::store(const Dish& dish) {
+    const DishId id = dish.getId();
+    const Dish::DietaryMask known = dish.getKnownDietaryAttributes();
+    const Dish::DietaryMask holds = dish.getDietaryAttributes();
+    for (std::size_t attribute = 0; attribute < Dish::kDietaryAttributeCount; ++attribute) {
+        const bool is_known = (known >> attribute) & 1u;
+        const bool does_hold = (holds >> attribute) & 1u;
+        holds_[attribute].set(id, is_known && does_hold);
+        fails_[attribute].set(id, is_known && !does_hold);
+    }
+}
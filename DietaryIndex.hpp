@@ -0,0 +1,105 @@
+/**
+ * @file DietaryIndex.hpp
+ * @brief This file contains the declaration of the DietaryIndex class, a bitset index over the dietary attributes
+ * of the dishes on a menu.
+ *
+ * For every attribute (vegetarian, gluten-free, nut-free) the index keeps two dense Bitmaps indexed by DishId: the
+ * dishes for which the attribute is known to hold and those for which it is known not to hold. A combined query
+ * such as "vegetarian and nut-free" is then one word-wide AND (or ANDN) per attribute over the whole menu, with no
+ * per-dish downcast. Attributes a dish does not record (a main course says nothing about nuts) are unknown, and
+ * each query chooses whether unknown counts as a match.
+ * The index is a DishObserver: once a dish is added and observed by the index (directly or through an
+ * ObserverList), calls to setVegetarian, setGlutenFree and setContainsNuts keep its bits up to date.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef DIETARY_INDEX_HPP
+#define DIETARY_INDEX_HPP
+
+#include "Bitmap.hpp"
+#include "Dish.hpp"
+#include "DishObserver.hpp"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+class DietaryIndex : public DishObserver {
+public:
+    // How a query treats a required attribute that a dish does not record
+    enum class Unknown { EXCLUDE, INCLUDE };
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty index.
+     */
+    DietaryIndex();
+
+    // Accessors
+    /**
+     * @return The number of dishes in the index.
+     */
+    std::size_t size() const { return dish_count_; }
+
+    /**
+     * @param id A dish ID.
+     * @return True if the dish with that ID has been added.
+     */
+    bool contains(DishId id) const { return id < members_.size() && members_.test(id); }
+
+    /**
+     * Evaluates a combined dietary query.
+     * @param required The attributes every match must have (a mask of Dish::DietaryAttribute bits); 0 matches every
+     * dish in the index.
+     * @param unknown Whether a dish that does not record a required attribute matches (default is EXCLUDE).
+     * @return A bitmap indexed by DishId with the bits of the matching dishes set.
+     */
+    Bitmap select(Dish::DietaryMask required, Unknown unknown = Unknown::EXCLUDE) const;
+
+    /**
+     * Evaluates a combined dietary query (see select()).
+     * @return The IDs of the matching dishes, in increasing order.
+     */
+    std::vector<DishId> find(Dish::DietaryMask required, Unknown unknown = Unknown::EXCLUDE) const;
+
+    /**
+     * @return The heap bytes used by the bitmaps.
+     */
+    std::size_t memoryUsage() const;
+
+    // Mutators
+    /**
+     * Adds a dish to the index. The dish must have an ID (see Dish::setId).
+     * @param dish The dish to index.
+     */
+    void add(const Dish& dish);
+
+    /**
+     * Removes a dish from the index.
+     * @param dish The dish to remove.
+     */
+    void remove(const Dish& dish);
+
+    /**
+     * Removes every dish from the index.
+     */
+    void clear();
+
+    // DishObserver
+    void dishChanged(const Dish& dish, DishField field) override;
+    void dishesCleared() override { clear(); }
+
+private:
+    Bitmap members_;                                                 // indexed by DishId
+    std::array<Bitmap, Dish::kDietaryAttributeCount> holds_;         // attribute known to hold
+    std::array<Bitmap, Dish::kDietaryAttributeCount> fails_;         // attribute known not to hold
+    std::size_t dish_count_;
+
+    // Helper functions: grow every bitmap to cover an ID, and write the bits of one dish
+    void reserveId(DishId id);
+    void store(const Dish& dish);
+};
+
+#endif // DIETARY_INDEX_HPP
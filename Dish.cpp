@@ -10,97 +10,283 @@
  */
 
 #include "Dish.hpp"
+#include "EnumNames.hpp"
+#include "Instrumentation.hpp"
+#include "MenuRenderer.hpp"
+#include "NameValidator.hpp"
+#include "StableHash.hpp"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
-#include <iomanip> // For std::fixed and std::setprecision
-#include <cctype>  // For std::isalpha, std::isspace
+#include <limits>
+#include <utility> // For std::move and std::exchange
+
+namespace {
+
+using Counted = Instrumentation::Class;
+using Event = Instrumentation::Event;
+
+// Counts a copy of a dish and the heap blocks it allocates: the name past the string's inline buffer and the
+// ingredient list past kInlineIngredients
+void countCopy(const Dish& dish) {
+    if constexpr (Instrumentation::kEnabled) {
+        Instrumentation::count(Counted::DISH, Event::COPY);
+        Instrumentation::count(Counted::DISH, Event::ALLOCATION,
+                               Instrumentation::stringBlocks(dish.getNameView().size()) + (dish.getIngredientCount() > Dish::kInlineIngredients ? 1 : 0));
+    }
+}
+
+} // namespace
 
 // Default Constructor
-Dish::Dish()
-        : name_("UNKNOWN"), ingredients_({}), prep_time_(0), price_(0.0), cuisine_type_(CuisineType::OTHER) {
+Dish::Dish() : Dish(allocator_type()) {
+}
+
+Dish::Dish(const allocator_type& allocator)
+        : name_("UNKNOWN", allocator), observer_(nullptr), price_cents_(0), prep_time_(0), id_(kNoDishId),
+          cuisine_type_(toCuisineBits(CuisineType::OTHER)), dietary_known_(0), dietary_(0) {
+    Instrumentation::count(Counted::DISH, Event::CONSTRUCTION);
 }
 
 // Parameterized Constructor
-Dish::Dish(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type)
-        : ingredients_(ingredients), prep_time_(prep_time), price_(price), cuisine_type_(cuisine_type) {
+Dish::Dish(std::string_view name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type,
+           const allocator_type& allocator)
+        : name_(allocator), observer_(nullptr), price_cents_(toCents(price)), prep_time_(prep_time), id_(kNoDishId),
+          cuisine_type_(toCuisineBits(cuisine_type)), dietary_known_(0), dietary_(0) {
     setName(name);  // Use setName to validate the name
+    // Last, as the destructor that frees a spilled list does not run if the constructor throws
+    const SmallVector<IngredientId, kInlineIngredients> ids = internIngredients(ingredients);
+    ingredients_.assign(ids.begin(), ids.end(), allocator);
+    Instrumentation::count(Counted::DISH, Event::CONSTRUCTION);
+}
+
+// Copy Constructors
+Dish::Dish(const Dish& other) : Dish(other, allocator_type()) {
+}
+
+Dish::Dish(const Dish& other, const allocator_type& allocator)
+        : name_(other.name_, allocator), observer_(nullptr), price_cents_(other.price_cents_), prep_time_(other.prep_time_), id_(other.id_),
+          cuisine_type_(other.cuisine_type_), dietary_known_(other.dietary_known_), dietary_(other.dietary_) {
+    ingredients_.assign(other.ingredients_.begin(), other.ingredients_.end(), allocator);
+    countCopy(other);
+}
+
+// Move Constructors
+Dish::Dish(Dish&& other) noexcept
+        : name_(std::move(other.name_)), observer_(std::exchange(other.observer_, nullptr)), price_cents_(other.price_cents_), prep_time_(other.prep_time_), id_(other.id_),
+          cuisine_type_(other.cuisine_type_), dietary_known_(other.dietary_known_), dietary_(other.dietary_) {
+    ingredients_.steal(other.ingredients_);  // name_ took other's allocator, so the list can be taken too
+    Instrumentation::count(Counted::DISH, Event::MOVE);
+}
+
+Dish::Dish(Dish&& other, const allocator_type& allocator)
+        : name_(std::move(other.name_), allocator), observer_(std::exchange(other.observer_, nullptr)), price_cents_(other.price_cents_), prep_time_(other.prep_time_),
+          id_(other.id_), cuisine_type_(other.cuisine_type_), dietary_known_(other.dietary_known_), dietary_(other.dietary_) {
+    if (allocator == other.get_allocator()) {
+        ingredients_.steal(other.ingredients_);
+    } else {
+        ingredients_.assign(other.ingredients_.begin(), other.ingredients_.end(), allocator);
+    }
+    Instrumentation::count(Counted::DISH, Event::MOVE);
+}
+
+// Assignment Operators
+Dish& Dish::operator=(const Dish& other) {
+    countCopy(other);
+    name_ = other.name_;
+    ingredients_.assign(other.ingredients_.begin(), other.ingredients_.end(), get_allocator());
+    price_cents_ = other.price_cents_;
+    prep_time_ = other.prep_time_;
+    cuisine_type_ = other.cuisine_type_;
+    dietary_known_ = other.dietary_known_;
+    dietary_ = other.dietary_;
+    return *this;
+}
+
+Dish& Dish::operator=(Dish&& other) {
+    Instrumentation::count(Counted::DISH, Event::MOVE);
+    name_ = std::move(other.name_);
+    if (this != &other) {
+        if (get_allocator() == other.get_allocator()) {
+            ingredients_.release(get_allocator());
+            ingredients_.steal(other.ingredients_);
+        } else {
+            ingredients_.assign(other.ingredients_.begin(), other.ingredients_.end(), get_allocator());
+        }
+    }
+    price_cents_ = other.price_cents_;
+    prep_time_ = other.prep_time_;
+    cuisine_type_ = other.cuisine_type_;
+    dietary_known_ = other.dietary_known_;
+    dietary_ = other.dietary_;
+    return *this;
+}
+
+// Destructor
+Dish::~Dish() {
+    ingredients_.release(get_allocator());
 }
 
 // Accessor Functions
 std::string Dish::getName() const {
+    Instrumentation::accessorCall(Instrumentation::Accessor::GET_NAME, Instrumentation::stringBlocks(name_.size()),
+                                  Instrumentation::stringBlocks(name_.size()) * (name_.size() + 1));
+    return std::string(name_);
+}
+
+std::string_view Dish::getNameView() const {
     return name_;
 }
 
 std::vector<std::string> Dish::getIngredients() const {
+    std::vector<std::string> ingredients;
+    ingredients.reserve(ingredients_.size());
+    for (IngredientId id : ingredients_) {
+        ingredients.emplace_back(IngredientTable::global().lookup(id));
+    }
+    if constexpr (Instrumentation::kEnabled) {
+        std::uint64_t blocks = ingredients.empty() ? 0 : 1;
+        std::uint64_t bytes = ingredients.capacity() * sizeof(std::string);
+        for (const std::string& ingredient : ingredients) {
+            blocks += Instrumentation::stringBlocks(ingredient.size());
+            bytes += Instrumentation::stringBlocks(ingredient.size()) * (ingredient.size() + 1);
+        }
+        Instrumentation::accessorCall(Instrumentation::Accessor::GET_INGREDIENTS, blocks, bytes);
+    }
+    return ingredients;
+}
+
+Span<const IngredientId> Dish::getIngredientIds() const {
     return ingredients_;
 }
 
+std::size_t Dish::getIngredientCount() const {
+    return ingredients_.size();
+}
+
+std::string_view Dish::getIngredient(std::size_t index) const {
+    return IngredientTable::global().lookup(ingredients_[index]);
+}
+
 int Dish::getPrepTime() const {
     return prep_time_;
 }
 
 double Dish::getPrice() const {
-    return price_;
+    return price_cents_ / 100.0;  // division, not * 0.01, so 1899 cents reads back as exactly 18.99
 }
 
 std::string Dish::getCuisineType() const {
-    switch (cuisine_type_) {
-        case CuisineType::ITALIAN: return "ITALIAN";
-        case CuisineType::MEXICAN: return "MEXICAN";
-        case CuisineType::CHINESE: return "CHINESE";
-        case CuisineType::INDIAN: return "INDIAN";
-        case CuisineType::AMERICAN: return "AMERICAN";
-        case CuisineType::FRENCH: return "FRENCH";
-        default: return "OTHER";
-    }
+    const std::string_view name = toString(getCuisine());
+    Instrumentation::accessorCall(Instrumentation::Accessor::GET_CUISINE_TYPE, Instrumentation::stringBlocks(name.size()),
+                                  Instrumentation::stringBlocks(name.size()) * (name.size() + 1));
+    return std::string(name);
+}
+
+Dish::CuisineType Dish::getCuisine() const {
+    return static_cast<CuisineType>(cuisine_type_);
 }
 
 // Mutator Functions
-void Dish::setName(const std::string& name) {
+void Dish::setName(std::string_view name) {
+    notifyChanging(DishField::NAME);
     if (isValidName(name)) {
         name_ = name;
     } else {
         name_ = "UNKNOWN";
     }
+    notifyChanged(DishField::NAME);
 }
 
 void Dish::setIngredients(const std::vector<std::string>& ingredients) {
-    ingredients_ = ingredients;
+    // Intern and make room first, so that a failure leaves the dish and its observer untouched
+    const SmallVector<IngredientId, kInlineIngredients> ids = internIngredients(ingredients);
+    ingredients_.reserve(ids.size(), get_allocator());
+    notifyChanging(DishField::INGREDIENTS);
+    ingredients_.assign(ids.begin(), ids.end(), get_allocator());
+    notifyChanged(DishField::INGREDIENTS);
+}
+
+void Dish::setIngredientIds(Span<const IngredientId> ingredient_ids) {
+    ingredients_.reserve(ingredient_ids.size(), get_allocator());
+    notifyChanging(DishField::INGREDIENTS);
+    ingredients_.assign(ingredient_ids.begin(), ingredient_ids.end(), get_allocator());
+    notifyChanged(DishField::INGREDIENTS);
 }
 
 void Dish::setPrepTime(const int& prep_time) {
+    notifyChanging(DishField::PREP_TIME);
     prep_time_ = prep_time;
+    notifyChanged(DishField::PREP_TIME);
 }
 
 void Dish::setPrice(const double& price) {
-    price_ = price;
+    notifyChanging(DishField::PRICE);
+    price_cents_ = toCents(price);
+    notifyChanged(DishField::PRICE);
 }
 
 void Dish::setCuisineType(const CuisineType& cuisine_type) {
-    cuisine_type_ = cuisine_type;
+    notifyChanging(DishField::CUISINE_TYPE);
+    cuisine_type_ = toCuisineBits(cuisine_type);
+    notifyChanged(DishField::CUISINE_TYPE);
 }
 
 // Display Function
 void Dish::display() const {
-    std::cout << "Dish Name: " << name_ << std::endl;
-    std::cout << "Ingredients: ";
-    for (size_t i = 0; i < ingredients_.size(); ++i) {
-        std::cout << ingredients_[i];
-        if (i != ingredients_.size() - 1) {
-            std::cout << ", ";
-        }
+    // Format into one buffer and write it once, leaving the stream's flags untouched
+    std::string buffer;
+    MenuRenderer().render(*this, buffer);
+    std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+// Comparison and hashing
+bool Dish::operator==(const Dish& other) const {
+    // The packed scalars first, so most unequal dishes are told apart without touching the name or the list
+    return price_cents_ == other.price_cents_ && prep_time_ == other.prep_time_ && cuisine_type_ == other.cuisine_type_ &&
+           dietary_known_ == other.dietary_known_ && dietary_ == other.dietary_ && ingredients_ == other.ingredients_ && name_ == other.name_;
+}
+
+std::uint64_t Dish::hash() const {
+    // Ingredients contribute the hash of their name, cached by the table, rather than their ID: IDs depend on the
+    // order in which a process interned the names
+    const IngredientTable& table = IngredientTable::global();
+    std::uint64_t hash = stableHash(name_);
+    for (IngredientId id : ingredients_) {
+        hash = hashCombine(hash, table.hashOf(id));
     }
-    std::cout << std::endl;
-    std::cout << "Preparation Time: " << prep_time_ << " minutes" << std::endl;
-    std::cout << std::fixed << std::setprecision(2) << "Price: $" << price_ << std::endl;
-    std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
+    hash = hashCombine(hash, ingredients_.size());
+    hash = hashCombine(hash, static_cast<std::uint64_t>(static_cast<std::uint32_t>(price_cents_)) << 32 | static_cast<std::uint32_t>(prep_time_));
+    return hashCombine(hash, static_cast<std::uint64_t>(cuisine_type_) | static_cast<std::uint64_t>(dietary_known_) << 3 |
+                                     static_cast<std::uint64_t>(dietary_) << (3 + kDietaryAttributeCount));
 }
 
 // Helper function to check if the name is valid
-bool Dish::isValidName(const std::string& name) const {
-    for (char c : name) {
-        if (!std::isalpha(c) && !std::isspace(c)) {  // Check if each character is a letter or space
-            return false;  // Name contains non-alphabetic characters other than spaces
-        }
+bool Dish::isValidName(std::string_view name) const {
+    return isValidDishName(name);  // Shared with the bulk validation used by the importers
+}
+
+// Helper function to intern a list of ingredient names
+SmallVector<IngredientId, Dish::kInlineIngredients> Dish::internIngredients(const std::vector<std::string>& ingredients) {
+    SmallVector<IngredientId, kInlineIngredients> ids;
+    ids.reserve(ingredients.size());
+    for (const std::string& ingredient : ingredients) {
+        ids.push_back(IngredientTable::global().intern(ingredient));
+    }
+    return ids;
+}
+
+// Helper functions to convert a price to stored cents and a cuisine to its stored bits
+std::int32_t Dish::toCents(double price) {
+    const double cents = std::round(price * 100.0);
+    if (std::isnan(cents)) {
+        return 0;
     }
-    return true;  // Name is valid
+    return static_cast<std::int32_t>(std::clamp(cents, static_cast<double>(std::numeric_limits<std::int32_t>::min()),
+                                                 static_cast<double>(std::numeric_limits<std::int32_t>::max())));
+}
+
+std::uint16_t Dish::toCuisineBits(CuisineType cuisine_type) {
+    const auto bits = static_cast<unsigned>(cuisine_type);
+    return static_cast<std::uint16_t>(bits <= static_cast<unsigned>(CuisineType::OTHER) ? bits : static_cast<unsigned>(CuisineType::OTHER));
 }
\ No newline at end of file
@@ -5,6 +5,29 @@
  * The Dish class includes attributes such as name, ingredients, preparation time, price, and cuisine type.
  * It provides constructors, accessor and mutator functions, and a display function to manage and present
  * the details of a dish.
+ * Ingredients are stored as IDs into the shared IngredientTable, so each distinct name is kept only once.
+ * Dish is allocator-aware: its name and ingredient list come from the std::pmr memory resource it was constructed
+ * with (the default resource unless one is given), so a whole menu can live in one MenuArena. Up to
+ * kInlineIngredients ingredient IDs are stored inside the dish, so most dishes need no allocation for their
+ * ingredient list. The list is a SmallArray, which borrows the allocator held by the name instead of keeping a copy.
+ * Names are passed in as std::string_view, and interned ingredient IDs as a Span (setIngredientIds). Ingredient names
+ * are taken as a const std::vector<std::string>& by the constructors and setIngredients: they are interned on the way
+ * in, so the vector is only read, and a second list overload would make the common {} and braced lists ambiguous.
+ * Everything is read out through the view accessors (getNameView, getIngredientIds), which make no copy. There are no
+ * rvalue overloads: the name lives in the dish's memory resource and the ingredients are interned IDs, so a moved-in
+ * std::string or std::vector could not be adopted and would be copied anyway, and a std::string overload next to the
+ * std::string_view one would make string literals ambiguous.
+ * Every dish also carries its dietary attributes as one bitmask, so that dietary queries need no downcast: each
+ * subclass records the attribute its own flag describes (vegetarian, gluten-free, nut-free) and leaves the others
+ * unknown.
+ * The layout is packed for cache density: the price is kept as integer cents, and the cuisine and dietary masks share
+ * a few bits after the pointer-aligned members, leaving the tail padding for the small fields of the subclasses.
+ * Dish and each subclass assert a sizeof budget (kSizeBudget), so a new field that bloats the record fails to compile
+ * instead of silently costing cache lines.
+ * Dishes compare and hash by value: operator== and hash() cover every field but the ID and the observer, which say
+ * where a dish is registered rather than what it is. Each subclass hides both with versions that add its own fields,
+ * and std::hash is specialized for the whole hierarchy. Hashes are stable (see StableHash.hpp), so two locations
+ * that build the same dish get the same hash.
  *
  * @date 09/19/2024
  * @author Mitchell Lipyansky
@@ -13,7 +36,17 @@
 #ifndef DISH_HPP
 #define DISH_HPP
 
+#include "DishObserver.hpp"
+#include "IngredientTable.hpp"
+#include "SmallArray.hpp"
+#include "SmallVector.hpp"
+#include "Span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class Dish {
@@ -21,6 +54,21 @@ public:
     // CuisineType enum definition
     enum class CuisineType { ITALIAN, MEXICAN, CHINESE, INDIAN, AMERICAN, FRENCH, OTHER };
 
+    // Dietary attributes, combined as the bits of a DietaryMask
+    enum DietaryAttribute : std::uint8_t { VEGETARIAN = 1u << 0, GLUTEN_FREE = 1u << 1, NUT_FREE = 1u << 2 };
+    using DietaryMask = std::uint8_t;
+    static constexpr std::size_t kDietaryAttributeCount = 3;
+
+    // Ingredients kept inside the dish before its list moves to the allocator. Eight covers the 3 to 8 of most
+    // dishes; six would save 8 bytes of the record but spill a third of the lists
+    static constexpr std::size_t kInlineIngredients = 8;
+
+    // Upper bound on sizeof(Dish) (64-bit libstdc++); raise it deliberately, not to make room for a stray field
+    static constexpr std::size_t kSizeBudget = 104;
+
+    // The allocator every dish allocates its strings and lists from; std::pmr containers pass theirs on to elements
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
     // Constructors
     /**
      * Default constructor.
@@ -33,16 +81,55 @@ public:
      */
     Dish();
 
+    /**
+     * Default constructor with an allocator.
+     * @param allocator The allocator for the name and ingredient list.
+     */
+    explicit Dish(const allocator_type& allocator);
+
     /**
      * Parameterized constructor.
-     * @param name A reference to the name of the dish.
+     * @param name The name of the dish.
      * @param ingredients A reference to a list of ingredients (default is an empty list).
      * @param prep_time The preparation time in minutes (default is 0).
      * @param price The price of the dish (default is 0.0).
      * @param cuisine_type The cuisine type of the dish (a CuisineType enum) with default value OTHER.
+     * @param allocator The allocator for the name and ingredient list (default is the default memory resource).
      * @post The private members are set to the values of the corresponding parameters.
      */
-    Dish(const std::string& name, const std::vector<std::string>& ingredients = {}, int prep_time = 0, double price = 0.0, CuisineType cuisine_type = CuisineType::OTHER);
+    Dish(std::string_view name, const std::vector<std::string>& ingredients = {}, int prep_time = 0, double price = 0.0,
+         CuisineType cuisine_type = CuisineType::OTHER, const allocator_type& allocator = {});
+
+    /**
+     * Copy constructor.
+     * Copies every field and the ID, but not the observer: a copy is not registered with any index or menu.
+     */
+    Dish(const Dish& other);
+    Dish(const Dish& other, const allocator_type& allocator);
+
+    /**
+     * Move constructor.
+     * Takes over every field, the ID and the observer, so a dish relocated inside a container stays registered.
+     * other is left without an observer, so changes to the moved-from dish are not reported as changes to this one.
+     * With an allocator that differs from other's, the name and ingredients are copied into the new allocator.
+     */
+    Dish(Dish&& other) noexcept;
+    Dish(Dish&& other, const allocator_type& allocator);
+
+    /**
+     * Copy and move assignment.
+     * Replace the field values only; the ID and observer of this dish are kept. Assignment is not reported to
+     * the observer, so re-register a dish with its indexes after assigning to it. A dish keeps its own allocator;
+     * moving from a dish with a different allocator copies.
+     */
+    Dish& operator=(const Dish& other);
+    Dish& operator=(Dish&& other);
+
+    /**
+     * Destructor.
+     * Returns a spilled ingredient list to the dish's allocator.
+     */
+    ~Dish();
 
     // Accessors
     /**
@@ -50,11 +137,33 @@ public:
      */
     std::string getName() const;
 
+    /**
+     * @return A view of the name of the dish, valid until the name is changed or the dish is destroyed.
+     */
+    std::string_view getNameView() const;
+
     /**
      * @return The list of ingredients used in the dish.
      */
     std::vector<std::string> getIngredients() const;
 
+    /**
+     * @return A view of the ingredients used in the dish as IDs into IngredientTable::global(),
+     * valid until the ingredients are changed or the dish is destroyed.
+     */
+    Span<const IngredientId> getIngredientIds() const;
+
+    /**
+     * @return The number of ingredients used in the dish.
+     */
+    std::size_t getIngredientCount() const;
+
+    /**
+     * @param index The position of the ingredient in the list.
+     * @return The name of the ingredient, resolved through the shared ingredient table without copying.
+     */
+    std::string_view getIngredient(std::size_t index) const;
+
     /**
      * @return The preparation time in minutes.
      */
@@ -65,18 +174,53 @@ public:
      */
     double getPrice() const;
 
+    /**
+     * @return The price of the dish in integer cents, as stored.
+     */
+    std::int32_t getPriceCents() const { return price_cents_; }
+
     /**
      * @return The cuisine type of the dish in string form.
      */
     std::string getCuisineType() const;
 
+    /**
+     * @return The cuisine type of the dish as the raw CuisineType enum, without building a string.
+     */
+    CuisineType getCuisine() const;
+
+    /**
+     * @return The dietary attributes that hold for the dish (a mask of DietaryAttribute bits).
+     */
+    DietaryMask getDietaryAttributes() const { return static_cast<DietaryMask>(dietary_); }
+
+    /**
+     * @return The dietary attributes the dish records at all, true or false; the others are unknown.
+     */
+    DietaryMask getKnownDietaryAttributes() const { return static_cast<DietaryMask>(dietary_known_); }
+
+    /**
+     * @return The ID of the dish within its menu, or kNoDishId if it has not been assigned one.
+     */
+    DishId getId() const { return id_; }
+
+    /**
+     * @return The observer notified when the dish changes, or nullptr.
+     */
+    DishObserver* getObserver() const { return observer_; }
+
+    /**
+     * @return The allocator the dish was constructed with.
+     */
+    allocator_type get_allocator() const { return name_.get_allocator(); }
+
     // Mutators
     /**
      * Sets the name of the dish.
-     * @param name A reference to the new name of the dish.
+     * @param name The new name of the dish, copied once into the dish's allocator.
      * @post Sets the private member `name_` to the value of the parameter. If the name contains non-alphabetic characters, it is set to "UNKNOWN".
      */
-    void setName(const std::string& name);
+    void setName(std::string_view name);
 
     /**
      * Sets the list of ingredients.
@@ -85,6 +229,13 @@ public:
      */
     void setIngredients(const std::vector<std::string>& ingredients);
 
+    /**
+     * Sets the list of ingredients from already interned IDs.
+     * @param ingredient_ids The new list of IDs into IngredientTable::global().
+     * @post Sets the private member `ingredients_` to the value of the parameter.
+     */
+    void setIngredientIds(Span<const IngredientId> ingredient_ids);
+
     /**
      * Sets the preparation time.
      * @param prep_time The new preparation time in minutes.
@@ -95,17 +246,32 @@ public:
     /**
      * Sets the price of the dish.
      * @param price The new price of the dish.
-     * @post Sets the private member `price_` to the value of the parameter.
+     * @post Sets the private member `price_cents_` to the parameter rounded to the nearest cent (NaN becomes 0 and
+     * prices beyond the int32 range of cents are clamped).
      */
     void setPrice(const double& price);
 
     /**
      * Sets the cuisine type of the dish.
      * @param cuisine_type The new cuisine type of the dish (a CuisineType enum).
-     * @post Sets the private member `cuisine_type_` to the value of the parameter.
+     * @post Sets the private member `cuisine_type_` to the value of the parameter; values outside the enum become OTHER.
      */
     void setCuisineType(const CuisineType& cuisine_type);
 
+    /**
+     * Sets the ID of the dish. IDs are assigned by whoever owns the menu (and its indexes).
+     * @param id The new ID.
+     * @post Sets the private member `id_` to the value of the parameter.
+     */
+    void setId(DishId id) { id_ = id; }
+
+    /**
+     * Sets the observer notified by every mutator of the dish and its subclasses.
+     * @param observer The observer, or nullptr to stop notifications. It must outlive its registration.
+     * @post Sets the private member `observer_` to the value of the parameter.
+     */
+    void setObserver(DishObserver* observer) { observer_ = observer; }
+
     // Display function
     /**
      * Displays the details of the dish.
@@ -117,15 +283,71 @@ public:
      * Preparation Time: [Preparation time] minutes
      * Price: $[Price, formatted to two decimal places]
      * Cuisine Type: [Cuisine type]
+     *
+     * The text is formatted by MenuRenderer and written with a single write, without flushing and without
+     * changing the formatting flags of std::cout.
      */
     void display() const;
 
+    // Comparison and hashing
+    /**
+     * Compares the dish parts of two dishes: name, ingredients in order, preparation time, price, cuisine type and
+     * dietary attributes. The IDs and observers are not compared.
+     * @param other The dish to compare with.
+     * @return True if every compared field is equal.
+     */
+    bool operator==(const Dish& other) const;
+    bool operator!=(const Dish& other) const { return !(*this == other); }
+
+    /**
+     * @return The stable 64-bit hash of the fields compared by operator==; equal dishes have equal hashes.
+     */
+    std::uint64_t hash() const;
+
+protected:
+    // Notification helpers used by the mutators of Dish and its subclasses
+    void notifyChanging(DishField field) const {
+        if (observer_ != nullptr) {
+            observer_->dishChanging(*this, field);
+        }
+    }
+
+    void notifyChanged(DishField field) const {
+        if (observer_ != nullptr) {
+            observer_->dishChanged(*this, field);
+        }
+    }
+
+    // Clamps a subclass level (spiciness, sweetness) to [0, max_level] so it fits the subclass's bit-field
+    static std::uint8_t clampLevel(int level, int max_level) {
+        return static_cast<std::uint8_t>(level < 0 ? 0 : (level > max_level ? max_level : level));
+    }
+
+    // Converts a subclass enum (serving style, cooking method, flavor profile) to its bit-field value. A value outside
+    // [0, last] would be truncated into some other enumerator, so it is stored as fallback instead, as toCuisineBits
+    // stores OTHER
+    static std::uint8_t toEnumBits(int value, int last, int fallback) {
+        return static_cast<std::uint8_t>(value >= 0 && value <= last ? value : fallback);
+    }
+
+    // Records a dietary attribute as known with the given value; the subclass setters notify around it
+    void setDietaryAttribute(DietaryAttribute attribute, bool value) {
+        dietary_known_ |= attribute;
+        dietary_ = value ? (dietary_ | attribute) : (dietary_ & ~attribute);
+    }
+
 private:
-    std::string name_;
-    std::vector<std::string> ingredients_;
+    // Pointer-aligned members first, then the 4-byte fields and the bit-fields, so the record has no interior
+    // padding and the subclasses can put their own bit-fields in its tail
+    std::pmr::string name_;
+    SmallArray<IngredientId, kInlineIngredients> ingredients_;  // interned IDs, inline up to kInlineIngredients; uses name_'s allocator
+    DishObserver* observer_;
+    std::int32_t price_cents_;
     int prep_time_;
-    double price_;
-    CuisineType cuisine_type_;
+    DishId id_;
+    std::uint16_t cuisine_type_ : 3;   // a CuisineType
+    std::uint16_t dietary_known_ : kDietaryAttributeCount;
+    std::uint16_t dietary_ : kDietaryAttributeCount;
 
     // Helper function to check if the name is valid
     /**
@@ -133,7 +355,23 @@ private:
      * @param name The name to be validated.
      * @return True if the name contains only alphabetic characters and spaces; false otherwise.
      */
-    bool isValidName(const std::string& name) const;
+    bool isValidName(std::string_view name) const;
+
+    // Helper function to intern a list of ingredient names
+    static SmallVector<IngredientId, kInlineIngredients> internIngredients(const std::vector<std::string>& ingredients);
+
+    // Helper functions to convert a price to stored cents and a cuisine to its stored bits
+    static std::int32_t toCents(double price);
+    static std::uint16_t toCuisineBits(CuisineType cuisine_type);
+};
+
+static_assert(sizeof(Dish) <= Dish::kSizeBudget, "Dish exceeds its size budget; pack the new field or raise kSizeBudget");
+
+namespace std {
+template <>
+struct hash<Dish> {
+    std::size_t operator()(const Dish& dish) const { return static_cast<std::size_t>(dish.hash()); }
 };
+} // namespace std
 
 #endif // DISH_HPP
\ No newline at end of file
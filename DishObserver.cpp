@@ -0,0 +1,39 @@
+/**
+ * @file DishObserver.cpp
+ * @brief This file contains the implementation of ObserverList, which forwards dish change notifications to several
+ * observers.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "DishObserver.hpp"
+#include <algorithm>
+
+void ObserverList::add(DishObserver* observer) {
+    if (std::find(observers_.begin(), observers_.end(), observer) == observers_.end()) {
+        observers_.push_back(observer);
+    }
+}
+
+void ObserverList::remove(DishObserver* observer) {
+    observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+}
+
+void ObserverList::dishChanging(const Dish& dish, DishField field) {
+    for (DishObserver* observer : observers_) {
+        observer->dishChanging(dish, field);
+    }
+}
+
+void ObserverList::dishChanged(const Dish& dish, DishField field) {
+    for (DishObserver* observer : observers_) {
+        observer->dishChanged(dish, field);
+    }
+}
+
+void ObserverList::dishesCleared() {
+    for (DishObserver* observer : observers_) {
+        observer->dishesCleared();
+    }
+}
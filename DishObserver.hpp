@@ -0,0 +1,87 @@
+/**
+ * @file DishObserver.hpp
+ * @brief This file contains the declaration of the DishObserver interface, which lets indexes and containers follow
+ * changes made through the Dish (and subclass) mutators.
+ *
+ * A dish notifies its observer twice for every setter call: dishChanging() runs while the dish still holds the
+ * old value and dishChanged() runs once the new value is in place, so an observer can retract the old value and
+ * publish the new one. A container that drops all of its dishes at once calls dishesCleared(), after which IDs are
+ * reused. ObserverList fans one notification out to several observers.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef DISH_OBSERVER_HPP
+#define DISH_OBSERVER_HPP
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class Dish;
+
+// Compact identifier of a dish inside a menu
+using DishId = std::uint32_t;
+constexpr DishId kNoDishId = std::numeric_limits<DishId>::max();
+
+// The field modified by a mutator
+enum class DishField {
+    NAME, INGREDIENTS, PREP_TIME, PRICE, CUISINE_TYPE,
+    SERVING_STYLE, SPICINESS_LEVEL, VEGETARIAN,
+    COOKING_METHOD, PROTEIN_TYPE, GLUTEN_FREE, SIDE_DISHES,
+    FLAVOR_PROFILE, SWEETNESS_LEVEL, CONTAINS_NUTS
+};
+
+class DishObserver {
+public:
+    virtual ~DishObserver() = default;
+
+    /**
+     * Called before a field of a dish changes.
+     * @param dish The dish, still holding the old value.
+     * @param field The field about to change.
+     */
+    virtual void dishChanging(const Dish& dish, DishField field) {}
+
+    /**
+     * Called after a field of a dish changed.
+     * @param dish The dish, now holding the new value.
+     * @param field The field that changed.
+     */
+    virtual void dishChanged(const Dish& dish, DishField field) {}
+
+    /**
+     * Called after every dish followed by the observer was removed (see Menu::clear()); the IDs will be reused.
+     */
+    virtual void dishesCleared() {}
+};
+
+class ObserverList : public DishObserver {
+public:
+    /**
+     * Adds an observer to the list. The observer must outlive its registration.
+     * @param observer The observer to notify.
+     */
+    void add(DishObserver* observer);
+
+    /**
+     * Removes an observer from the list, if present.
+     * @param observer The observer to stop notifying.
+     */
+    void remove(DishObserver* observer);
+
+    /**
+     * @return True if no observer is registered.
+     */
+    bool empty() const { return observers_.empty(); }
+
+    void dishChanging(const Dish& dish, DishField field) override;
+    void dishChanged(const Dish& dish, DishField field) override;
+    void dishesCleared() override;
+
+private:
+    std::vector<DishObserver*> observers_;
+};
+
+#endif // DISH_OBSERVER_HPP
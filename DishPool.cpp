@@ -0,0 +1,151 @@
+/**
+ * @file DishPool.cpp
+ * @brief This file contains the implementation of the DishPool class, which hash-conses dishes: equal dishes share
+ * one canonical instance.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "DishPool.hpp"
+#include <utility>
+
+namespace {
+
+// Strings longer than this are on the heap (libstdc++ small-string buffer)
+constexpr std::size_t kStringInlineCapacity = 15;
+
+constexpr std::size_t kInitialSlots = 64;
+
+} // namespace
+
+// Default Constructor
+DishPool::DishPool() : stats_{0, 0, 0, 0} {}
+
+// Destructor
+DishPool::~DishPool() {
+    clear();
+}
+
+// Accessors
+std::size_t DishPool::memoryUsage() const {
+    return arena_.bytesReserved() + dishes_.slots.capacity() * sizeof(Table<Dish>::Slot) +
+           appetizers_.slots.capacity() * sizeof(Table<Appetizer>::Slot) + main_courses_.slots.capacity() * sizeof(Table<MainCourse>::Slot) +
+           desserts_.slots.capacity() * sizeof(Table<Dessert>::Slot) +
+           (dishes_.dishes.capacity() + appetizers_.dishes.capacity() + main_courses_.dishes.capacity() + desserts_.dishes.capacity()) * sizeof(void*);
+}
+
+std::size_t DishPool::footprint(const Dish& dish) {
+    // Heap blocks are estimated from the sizes, since a dish does not expose the capacities of its storage
+    std::size_t bytes = sizeof(dish);
+    const std::size_t name_length = dish.getNameView().size();
+    if (name_length > kStringInlineCapacity) {
+        bytes += name_length + 1;
+    }
+    if (dish.getIngredientCount() > Dish::kInlineIngredients) {
+        bytes += dish.getIngredientCount() * sizeof(IngredientId);
+    }
+    return bytes;
+}
+
+std::size_t DishPool::footprint(const MainCourse& dish) {
+    std::size_t bytes = footprint(static_cast<const Dish&>(dish)) + sizeof(MainCourse) - sizeof(Dish);
+    const std::string_view protein_type = dish.getProteinTypeView();
+    if (protein_type.size() > SmallString::kInlineCapacity) {
+        bytes += protein_type.size() + 1;
+    }
+    const Span<const MainCourse::SideDish> side_dishes = dish.getSideDishesView();
+    bytes += side_dishes.size() * sizeof(MainCourse::SideDish);
+    for (const MainCourse::SideDish& side_dish : side_dishes) {
+        if (!side_dish.name.isInline()) {
+            bytes += side_dish.name.size() + 1;
+        }
+    }
+    return bytes;
+}
+
+// Mutators
+const Dish& DishPool::intern(const Dish& dish) {
+    return internIn(dishes_, dish);
+}
+
+const Appetizer& DishPool::intern(const Appetizer& dish) {
+    return internIn(appetizers_, dish);
+}
+
+const MainCourse& DishPool::intern(const MainCourse& dish) {
+    return internIn(main_courses_, dish);
+}
+
+const Dessert& DishPool::intern(const Dessert& dish) {
+    return internIn(desserts_, dish);
+}
+
+void DishPool::clear() {
+    destroy(dishes_);
+    destroy(appetizers_);
+    destroy(main_courses_);
+    destroy(desserts_);
+    arena_.release();
+    stats_ = Stats{0, 0, 0, 0};
+}
+
+// Helper functions
+
+template <typename T>
+const T& DishPool::internIn(Table<T>& table, const T& dish) {
+    ++stats_.requests;
+    const std::uint64_t hash = dish.hash();
+    if (table.slots.empty()) {
+        table.slots.assign(kInitialSlots, {0, nullptr});
+    }
+    const std::size_t mask = table.slots.size() - 1;
+    std::size_t index = static_cast<std::size_t>(hash) & mask;
+    for (; table.slots[index].dish != nullptr; index = (index + 1) & mask) {
+        const typename Table<T>::Slot& slot = table.slots[index];
+        if (slot.hash == hash && *slot.dish == dish) {
+            stats_.bytes_saved += footprint(dish);
+            return *slot.dish;
+        }
+    }
+
+    // A canonical copy in the arena: the allocator passes the arena on to the copy's strings and lists
+    std::pmr::polymorphic_allocator<T> allocator(&arena_);
+    T* canonical = allocator.allocate(1);
+    allocator.construct(canonical, dish);
+    canonical->setId(kNoDishId);
+    table.dishes.push_back(canonical);
+    table.slots[index] = {hash, canonical};
+    ++stats_.unique;
+    stats_.bytes_held += footprint(*canonical);
+    if (2 * table.dishes.size() > table.slots.size()) {
+        rehash(table);
+    }
+    return *canonical;
+}
+
+template <typename T>
+void DishPool::rehash(Table<T>& table) {
+    std::vector<typename Table<T>::Slot> slots(2 * table.slots.size(), {0, nullptr});
+    const std::size_t mask = slots.size() - 1;
+    for (const typename Table<T>::Slot& slot : table.slots) {
+        if (slot.dish != nullptr) {
+            std::size_t index = static_cast<std::size_t>(slot.hash) & mask;
+            while (slots[index].dish != nullptr) {
+                index = (index + 1) & mask;
+            }
+            slots[index] = slot;
+        }
+    }
+    table.slots = std::move(slots);
+}
+
+template <typename T>
+void DishPool::destroy(Table<T>& table) {
+    // The memory goes back with the arena; only the destructors need to run
+    for (T* dish : table.dishes) {
+        dish->~T();
+    }
+    table.dishes = std::vector<T*>();
+    table.slots = std::vector<typename Table<T>::Slot>();
+}
@@ -0,0 +1,127 @@
+/**
+ * @file DishPool.hpp
+ * @brief This file contains the declaration of the DishPool class, which hash-conses dishes: equal dishes share one
+ * canonical instance.
+ *
+ * Menus merged from several locations repeat the same dishes many times over. intern() looks a dish up by its stable
+ * hash (Dish::hash() and the subclass versions) in an open-addressing table per class, confirms a hit with
+ * operator==, and returns the canonical instance, copying the dish into the pool the first time it is seen. The
+ * canonical copies and their strings and lists live in the pool's MenuArena, so a pool of distinct dishes costs a few
+ * large blocks. Canonical copies carry no ID and no observer, since they stand for every location's copy at once.
+ * stats() reports how much interning deduplicated: the dedup ratio and the bytes the duplicates would have taken.
+ * A DishPool is not thread-safe.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef DISH_POOL_HPP
+#define DISH_POOL_HPP
+
+#include "Appetizer.hpp"
+#include "Dessert.hpp"
+#include "Dish.hpp"
+#include "MainCourse.hpp"
+#include "MenuArena.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+class DishPool {
+public:
+    // What interning has deduplicated so far
+    struct Stats {
+        std::size_t requests;     // calls to intern()
+        std::size_t unique;       // canonical instances held
+        std::size_t bytes_held;   // footprint of the canonical instances
+        std::size_t bytes_saved;  // footprint of the duplicates that were answered with a canonical instance
+
+        /**
+         * @return requests per canonical instance (1 when nothing was deduplicated or nothing interned).
+         */
+        double dedupRatio() const { return unique == 0 ? 1.0 : static_cast<double>(requests) / static_cast<double>(unique); }
+    };
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty pool.
+     */
+    DishPool();
+
+    DishPool(const DishPool&) = delete;
+    DishPool& operator=(const DishPool&) = delete;
+    ~DishPool();
+
+    // Accessors
+    /**
+     * @return The number of canonical instances held.
+     */
+    std::size_t size() const { return stats_.unique; }
+
+    /**
+     * @return The interning counters since construction or the last clear().
+     */
+    const Stats& stats() const { return stats_; }
+
+    /**
+     * @return The bytes held by the pool: its arena blocks and hash tables.
+     */
+    std::size_t memoryUsage() const;
+
+    /**
+     * @param dish A dish, appetizer, main course or dessert.
+     * @return The approximate bytes the dish occupies: its record plus the heap blocks of its strings and lists.
+     */
+    static std::size_t footprint(const Dish& dish);
+    static std::size_t footprint(const MainCourse& dish);
+
+    // Mutators
+    /**
+     * Returns the canonical instance equal to a dish, adding a copy of the dish if there is none yet.
+     * @param dish The dish to intern; it is not modified.
+     * @return The canonical instance, valid until clear() or the pool is destroyed.
+     */
+    const Dish& intern(const Dish& dish);
+    const Appetizer& intern(const Appetizer& dish);
+    const MainCourse& intern(const MainCourse& dish);
+    const Dessert& intern(const Dessert& dish);
+
+    /**
+     * Drops every canonical instance and resets the counters.
+     * @post References returned by intern() are invalid.
+     */
+    void clear();
+
+private:
+    // The canonical instances of one class and an open-addressing index over them (linear probing, at most half full)
+    template <typename T>
+    struct Table {
+        struct Slot {
+            std::uint64_t hash;
+            const T* dish;  // nullptr for an empty slot
+        };
+
+        std::vector<T*> dishes;   // canonical instances, allocated from the arena
+        std::vector<Slot> slots;  // power-of-two size
+    };
+
+    // The arena is declared first so that it outlives the dishes it holds
+    MenuArena arena_;
+    Table<Dish> dishes_;
+    Table<Appetizer> appetizers_;
+    Table<MainCourse> main_courses_;
+    Table<Dessert> desserts_;
+    Stats stats_;
+
+    // Helper functions: look a dish up in the table of its class, grow a table, and destroy a table's dishes
+    template <typename T>
+    const T& internIn(Table<T>& table, const T& dish);
+    template <typename T>
+    static void rehash(Table<T>& table);
+    template <typename T>
+    void destroy(Table<T>& table);
+};
+
+#endif // DISH_POOL_HPP
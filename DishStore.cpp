@@ -0,0 +1,157 @@
+/**
+ * @file DishStore.cpp
+ * @brief This file contains the implementation of the DishStore class, a columnar copy of a menu's filterable fields.
+ *
+ * The predicate kernel works on blocks of 64 rows: it first evaluates the filter into a byte per row with
+ * branch-free comparisons (which GCC and Clang vectorize at -O2), then packs the bytes into one
+ * 64-bit word of the result bitmap (with SSE2 movemask where available).
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "DishStore.hpp"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr unsigned kCuisineCount = static_cast<unsigned>(Dish::CuisineType::OTHER) + 1;
+constexpr std::uint32_t kAllCuisines = (std::uint32_t{1} << kCuisineCount) - 1;
+
+// Packs 64 bytes holding 0 or 1 into a 64-bit word, byte j becoming bit j
+std::uint64_t packBytesScalar(const std::uint8_t* match) {
+    std::uint64_t word = 0;
+    for (std::size_t j = 0; j < 64; ++j) {
+        word |= static_cast<std::uint64_t>(match[j]) << j;
+    }
+    return word;
+}
+
+#if defined(__SSE2__)
+std::uint64_t packBytesSse2(const std::uint8_t* match) {
+    std::uint64_t word = 0;
+    for (int k = 0; k < 4; ++k) {
+        const __m128i bytes = _mm_load_si128(reinterpret_cast<const __m128i*>(match + 16 * k));
+        const __m128i high = _mm_slli_epi16(bytes, 7);  // move each 0/1 byte into its sign bit
+        word |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(high))) << (16 * k);
+    }
+    return word;
+}
+#endif
+
+// The predicate kernel, with the packing step as a template parameter so that each version is inlined
+template <std::uint64_t (*Pack)(const std::uint8_t*)>
+Bitmap selectRows(const DishStore& store, const DishStore::Filter& filter) {
+    const std::size_t rows = store.size();
+    Bitmap result(rows);
+    const double* price = store.prices();
+    const int* prep = store.prepTimes();
+    const std::uint8_t* cuisine = store.cuisines();
+    const double min_price = filter.min_price;
+    const double max_price = filter.max_price;
+    const int min_prep = filter.min_prep_time;
+    const int max_prep = filter.max_prep_time;
+    const std::uint32_t mask = filter.cuisine_mask & kAllCuisines;
+    std::uint64_t* out = result.words();
+
+    // Cuisine types selected by the filter, so the cuisine test becomes byte compares instead of a variable shift
+    std::uint8_t wanted[kCuisineCount];
+    std::size_t wanted_count = 0;
+    for (unsigned c = 0; c < kCuisineCount; ++c) {
+        if ((mask >> c) & 1u) {
+            wanted[wanted_count++] = static_cast<std::uint8_t>(c);
+        }
+    }
+    const bool any_cuisine = mask == kAllCuisines;
+
+    for (std::size_t base = 0; base < rows; base += 64) {
+        const std::size_t block = rows - base < 64 ? rows - base : 64;
+        alignas(16) std::uint8_t match[64] = {};
+        for (std::size_t j = 0; j < block; ++j) {
+            match[j] = static_cast<std::uint8_t>((price[base + j] >= min_price) & (price[base + j] < max_price)
+                                                 & (prep[base + j] >= min_prep) & (prep[base + j] <= max_prep));
+        }
+        if (!any_cuisine) {
+            alignas(16) std::uint8_t hit[64] = {};
+            for (std::size_t k = 0; k < wanted_count; ++k) {
+                const std::uint8_t c = wanted[k];
+                for (std::size_t j = 0; j < block; ++j) {
+                    hit[j] |= static_cast<std::uint8_t>(cuisine[base + j] == c);
+                }
+            }
+            for (std::size_t j = 0; j < 64; ++j) {
+                match[j] &= hit[j];
+            }
+        }
+        out[base >> 6] = Pack(match);
+    }
+    return result;
+}
+
+} // namespace
+
+// Default Constructor
+DishStore::DishStore() {}
+
+void DishStore::reserve(std::size_t capacity) {
+    prices_.reserve(capacity);
+    prep_times_.reserve(capacity);
+    cuisines_.reserve(capacity);
+}
+
+std::size_t DishStore::append(const Dish& dish) {
+    prices_.push_back(dish.getPrice());
+    prep_times_.push_back(dish.getPrepTime());
+    cuisines_.push_back(static_cast<std::uint8_t>(dish.getCuisine()));
+    return prices_.size() - 1;
+}
+
+void DishStore::update(std::size_t row, const Dish& dish) {
+    prices_[row] = dish.getPrice();
+    prep_times_[row] = dish.getPrepTime();
+    cuisines_[row] = static_cast<std::uint8_t>(dish.getCuisine());
+}
+
+void DishStore::clear() {
+    prices_.clear();
+    prep_times_.clear();
+    cuisines_.clear();
+}
+
+Bitmap DishStore::select(const Filter& filter) const {
+#if defined(__SSE2__)
+    return select(filter, Pack::SSE2);
+#else
+    return select(filter, Pack::SCALAR);
+#endif
+}
+
+Bitmap DishStore::select(const Filter& filter, Pack pack) const {
+#if defined(__SSE2__)
+    if (pack == Pack::SSE2) {
+        return selectRows<packBytesSse2>(*this, filter);
+    }
+#endif
+    static_cast<void>(pack);
+    return selectRows<packBytesScalar>(*this, filter);
+}
+
+Bitmap DishStore::selectPriceBelow(double max_price) const {
+    Filter filter;
+    filter.max_price = max_price;
+    return select(filter);
+}
+
+Bitmap DishStore::selectPrepTimeAtMost(int max_prep_time) const {
+    Filter filter;
+    filter.max_prep_time = max_prep_time;
+    return select(filter);
+}
+
+Bitmap DishStore::selectCuisine(Dish::CuisineType cuisine_type) const {
+    Filter filter;
+    filter.cuisine_mask = cuisineBit(cuisine_type);
+    return select(filter);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file DishStore.hpp
+ * @brief This file contains the declaration of the DishStore class, a columnar (struct-of-arrays) copy of a menu's
+ * filterable fields.
+ *
+ * A DishStore keeps the price, preparation time and raw cuisine type of every dish in contiguous columns.
+ * Batch predicates run over those columns in fixed-size blocks that the compiler can vectorize, and return
+ * their matches as a selection Bitmap whose bit i refers to row i (the i-th appended dish).
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef DISH_STORE_HPP
+#define DISH_STORE_HPP
+
+#include "Dish.hpp"
+#include "Bitmap.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class DishStore {
+public:
+    /**
+     * A conjunctive filter over the store's columns. Every bound is optional: the defaults match all rows.
+     * A row matches when min_price <= price < max_price, min_prep_time <= prep_time <= max_prep_time,
+     * and the bit for its cuisine type is set in cuisine_mask.
+     */
+    struct Filter {
+        double min_price = -std::numeric_limits<double>::infinity();
+        double max_price = std::numeric_limits<double>::infinity();
+        int min_prep_time = std::numeric_limits<int>::min();
+        int max_prep_time = std::numeric_limits<int>::max();
+        std::uint32_t cuisine_mask = ~std::uint32_t{0};
+    };
+
+    // How select() packs its per-row matches into bitmap words
+    enum class Pack { SCALAR, SSE2 };
+
+    /**
+     * @param cuisine_type A cuisine type.
+     * @return The Filter::cuisine_mask bit selecting that cuisine type; combine several with |.
+     */
+    static std::uint32_t cuisineBit(Dish::CuisineType cuisine_type) {
+        return std::uint32_t{1} << static_cast<unsigned>(cuisine_type);
+    }
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty store.
+     */
+    DishStore();
+
+    // Accessors
+    /**
+     * @return The number of rows in the store.
+     */
+    std::size_t size() const { return prices_.size(); }
+
+    /**
+     * Raw column access. Each pointer addresses size() contiguous values.
+     */
+    const double* prices() const { return prices_.data(); }
+    const int* prepTimes() const { return prep_times_.data(); }
+    const std::uint8_t* cuisines() const { return cuisines_.data(); }
+
+    // Mutators
+    /**
+     * Reserves capacity in every column.
+     * @param capacity The number of rows to reserve.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * Appends one dish as a new row.
+     * @param dish The dish (or subclass) whose price, preparation time and cuisine type are copied.
+     * @return The row index of the new row.
+     */
+    std::size_t append(const Dish& dish);
+
+    /**
+     * Appends every dish in [first, last).
+     */
+    template <typename It>
+    void append(It first, It last) {
+        for (; first != last; ++first) {
+            append(*first);
+        }
+    }
+
+    /**
+     * Overwrites an existing row with the current values of a dish.
+     * @param row The row to refresh.
+     * @param dish The dish the row mirrors.
+     */
+    void update(std::size_t row, const Dish& dish);
+
+    /**
+     * Removes every row.
+     */
+    void clear();
+
+    // Batch predicates
+    /**
+     * Evaluates a filter over every row.
+     * @param filter The conjunctive filter to apply.
+     * @return A bitmap of size() bits with bit i set when row i matches.
+     */
+    Bitmap select(const Filter& filter) const;
+
+    /**
+     * Evaluates a filter with a given packing implementation, for tests and benchmarks.
+     * @param filter The conjunctive filter to apply.
+     * @param pack The implementation; SSE2 falls back to SCALAR when the target lacks it.
+     * @return The same bitmap as select(filter).
+     */
+    Bitmap select(const Filter& filter, Pack pack) const;
+
+    /**
+     * Convenience wrappers for the common single-column predicates.
+     */
+    Bitmap selectPriceBelow(double max_price) const;
+    Bitmap selectPrepTimeAtMost(int max_prep_time) const;
+    Bitmap selectCuisine(Dish::CuisineType cuisine_type) const;
+
+private:
+    std::vector<double> prices_;
+    std::vector<int> prep_times_;
+    std::vector<std::uint8_t> cuisines_;
+};
+
+#endif // DISH_STORE_HPP
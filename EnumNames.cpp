@@ -0,0 +1,43 @@
+/**
+ * @file EnumNames.cpp
+ * @brief This file contains the compile-time checks of the enum name tables.
+ *
+ * The conversions themselves are constexpr and live in EnumNames.hpp; checking the tables here runs the checks
+ * once per build instead of once per file that includes the header.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "EnumNames.hpp"
+
+namespace {
+
+// True if every name of the enum parses back to its own value, and a near miss does not parse
+template <typename Enum>
+constexpr bool roundTrips() {
+    for (std::size_t i = 0; i < EnumTraits<Enum>::names.size(); ++i) {
+        Enum value{};
+        if (!fromString(toString(static_cast<Enum>(i)), value) || value != static_cast<Enum>(i)) {
+            return false;
+        }
+        if (fromString(EnumTraits<Enum>::names[i].substr(1), value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(roundTrips<Dish::CuisineType>(), "CuisineType names must round-trip");
+static_assert(roundTrips<Appetizer::ServingStyle>(), "ServingStyle names must round-trip");
+static_assert(roundTrips<MainCourse::CookingMethod>(), "CookingMethod names must round-trip");
+static_assert(roundTrips<MainCourse::Category>(), "Category names must round-trip");
+static_assert(roundTrips<Dessert::FlavorProfile>(), "FlavorProfile names must round-trip");
+
+// The tables must cover each enum's last declared value
+static_assert(toString(Dish::CuisineType::OTHER) == "OTHER" && toString(Appetizer::BUFFET) == "BUFFET"
+              && toString(MainCourse::RAW) == "RAW" && toString(MainCourse::VEGETABLE) == "VEGETABLE"
+              && toString(Dessert::UMAMI) == "UMAMI", "enum name tables are out of date");
+static_assert(toDisplayString(MainCourse::STARCHES) == "Starches", "display names are out of order");
+
+} // namespace
@@ -0,0 +1,146 @@
+/**
+ * @file EnumNames.hpp
+ * @brief This file contains the string conversions for the enums of the Dish class hierarchy.
+ *
+ * Every enum has a compile-time table of its names (EnumTraits). toString() indexes that table and returns a view
+ * of a string literal, so converting an enum never allocates. Values outside an enum's declared range convert to
+ * "OTHER", matching Dish::getCuisineType(). fromString() parses those names back through a perfect hash that is
+ * also built at compile time: one hash of the input, one table probe and a single string comparison to confirm
+ * the match, with no allocation. Dish::CuisineType::OTHER is a declared value and parses normally.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef ENUM_NAMES_HPP
+#define ENUM_NAMES_HPP
+
+#include "Appetizer.hpp"
+#include "Dessert.hpp"
+#include "Dish.hpp"
+#include "MainCourse.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// The declared names of an enum, in declaration order (values are numbered from 0)
+template <typename Enum>
+struct EnumTraits;
+
+template <>
+struct EnumTraits<Dish::CuisineType> {
+    static constexpr std::array<std::string_view, 7> names = {
+        "ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"};
+};
+
+template <>
+struct EnumTraits<Appetizer::ServingStyle> {
+    static constexpr std::array<std::string_view, 3> names = {"PLATED", "FAMILY_STYLE", "BUFFET"};
+};
+
+template <>
+struct EnumTraits<MainCourse::CookingMethod> {
+    static constexpr std::array<std::string_view, 5> names = {"GRILLED", "BAKED", "FRIED", "STEAMED", "RAW"};
+};
+
+template <>
+struct EnumTraits<MainCourse::Category> {
+    static constexpr std::array<std::string_view, 8> names = {
+        "GRAIN", "PASTA", "LEGUME", "BREAD", "SALAD", "SOUP", "STARCHES", "VEGETABLE"};
+    static constexpr std::array<std::string_view, 8> display_names = {
+        "Grain", "Pasta", "Legume", "Bread", "Salad", "Soup", "Starches", "Vegetable"};
+};
+
+template <>
+struct EnumTraits<Dessert::FlavorProfile> {
+    static constexpr std::array<std::string_view, 5> names = {"SWEET", "BITTER", "SOUR", "SALTY", "UMAMI"};
+};
+
+namespace enum_names {
+
+// Seeded FNV-1a; the seed is chosen at compile time so that an enum's names land in distinct slots
+constexpr std::uint32_t hash(std::string_view text, std::uint32_t seed) {
+    std::uint32_t h = seed;
+    for (char c : text) {
+        h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    return h;
+}
+
+// A collision-free map from the names of one enum to their values
+template <std::size_t Count>
+struct PerfectHash {
+    static constexpr unsigned kBits = Count <= 8 ? 4 : 5;  // at least twice as many slots as names
+    static constexpr std::size_t kSlots = std::size_t{1} << kBits;
+    static constexpr std::uint8_t kEmpty = 0xFF;
+
+    std::uint32_t seed = 0;
+    std::array<std::uint8_t, kSlots> slots{};
+
+    // The top bits of the hash: the multiplications mix every input byte into them
+    constexpr std::size_t slot(std::string_view name) const { return hash(name, seed) >> (32 - kBits); }
+};
+
+template <std::size_t Count>
+constexpr PerfectHash<Count> makePerfectHash(const std::array<std::string_view, Count>& names) {
+    PerfectHash<Count> table;
+    for (std::uint32_t seed = 2166136261u;; ++seed) {
+        table.seed = seed;
+        for (std::uint8_t& slot : table.slots) {
+            slot = PerfectHash<Count>::kEmpty;
+        }
+        bool collision = false;
+        for (std::size_t i = 0; i < Count && !collision; ++i) {
+            std::uint8_t& slot = table.slots[table.slot(names[i])];
+            collision = slot != PerfectHash<Count>::kEmpty;
+            slot = static_cast<std::uint8_t>(i);
+        }
+        if (!collision) {
+            return table;
+        }
+    }
+}
+
+template <typename Enum>
+inline constexpr auto kPerfectHash = makePerfectHash(EnumTraits<Enum>::names);
+
+} // namespace enum_names
+
+/**
+ * @return The upper-case name of the enum value, as spelled in its declaration, or "OTHER" if it is out of range.
+ */
+template <typename Enum, typename = decltype(EnumTraits<Enum>::names)>
+constexpr std::string_view toString(Enum value) {
+    constexpr auto& names = EnumTraits<Enum>::names;
+    const auto index = static_cast<std::size_t>(value);
+    return index < names.size() ? names[index] : std::string_view("OTHER");
+}
+
+/**
+ * Parses the upper-case name of an enum value (the inverse of toString).
+ * @param name The name to parse.
+ * @param value Set to the parsed value on success; left unchanged otherwise.
+ * @return True if name is the name of a declared value.
+ */
+template <typename Enum, typename = decltype(EnumTraits<Enum>::names)>
+constexpr bool fromString(std::string_view name, Enum& value) {
+    constexpr auto& table = enum_names::kPerfectHash<Enum>;
+    const std::uint8_t index = table.slots[table.slot(name)];
+    if (index == table.kEmpty || EnumTraits<Enum>::names[index] != name) {
+        return false;
+    }
+    value = static_cast<Enum>(index);
+    return true;
+}
+
+/**
+ * @return The side-dish category in title case ("Starches", "Vegetable", ...), as printed on menus.
+ */
+constexpr std::string_view toDisplayString(MainCourse::Category category) {
+    constexpr auto& names = EnumTraits<MainCourse::Category>::display_names;
+    const auto index = static_cast<std::size_t>(category);
+    return index < names.size() ? names[index] : std::string_view("Other");
+}
+
+#endif // ENUM_NAMES_HPP
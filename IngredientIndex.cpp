@@ -0,0 +1,292 @@
+/**
+ * @file IngredientIndex.cpp
+ * @brief This file contains the implementation of the IngredientIndex class, an inverted index from ingredients to
+ * the dishes that contain them.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "IngredientIndex.hpp"
+#include "Instrumentation.hpp"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+
+// Returns the sorted, duplicate-free ingredient IDs of a dish
+std::vector<IngredientId> uniqueIngredients(const Dish& dish) {
+    std::vector<IngredientId> ids(dish.getIngredientIds().begin(), dish.getIngredientIds().end());
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+std::vector<DishId> intersect(const std::vector<DishId>& a, const std::vector<DishId>& b) {
+    std::vector<DishId> out;
+    out.reserve(std::min(a.size(), b.size()));
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+    return out;
+}
+
+std::vector<DishId> unite(const std::vector<DishId>& a, const std::vector<DishId>& b) {
+    std::vector<DishId> out;
+    out.reserve(a.size() + b.size());
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+    return out;
+}
+
+std::vector<DishId> subtract(const std::vector<DishId>& a, const std::vector<DishId>& b) {
+    std::vector<DishId> out;
+    out.reserve(a.size());
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+    return out;
+}
+
+} // namespace
+
+// PostingList
+
+void IngredientIndex::PostingList::append(DishId id) {
+    // LEB128 varint of the gap to the previous ID (the first ID is stored as-is)
+    std::uint32_t delta = count_ == 0 ? id : id - last_;
+    while (delta >= 0x80) {
+        bytes_.push_back(static_cast<std::uint8_t>(delta | 0x80));
+        delta >>= 7;
+    }
+    bytes_.push_back(static_cast<std::uint8_t>(delta));
+    last_ = id;
+    ++count_;
+}
+
+void IngredientIndex::PostingList::insert(DishId id) {
+    auto removed = std::lower_bound(removed_.begin(), removed_.end(), id);
+    if (removed != removed_.end() && *removed == id) {
+        removed_.erase(removed);
+        return;
+    }
+    if (added_.empty() && (count_ == 0 || id > last_)) {
+        append(id);  // fast path for IDs arriving in increasing order
+        return;
+    }
+    added_.insert(std::lower_bound(added_.begin(), added_.end(), id), id);
+    compactIfNeeded();
+}
+
+void IngredientIndex::PostingList::erase(DishId id) {
+    auto added = std::lower_bound(added_.begin(), added_.end(), id);
+    if (added != added_.end() && *added == id) {
+        added_.erase(added);
+        return;
+    }
+    removed_.insert(std::lower_bound(removed_.begin(), removed_.end(), id), id);
+    compactIfNeeded();
+}
+
+void IngredientIndex::PostingList::decode(std::vector<DishId>& out) const {
+    std::vector<DishId> base;
+    base.reserve(count_);
+    DishId value = 0;
+    std::size_t pos = 0;
+    for (std::uint32_t i = 0; i < count_; ++i) {
+        std::uint32_t delta = 0;
+        unsigned shift = 0;
+        std::uint8_t byte;
+        do {
+            byte = bytes_[pos++];
+            delta |= static_cast<std::uint32_t>(byte & 0x7f) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        value = i == 0 ? delta : value + delta;
+        base.push_back(value);
+    }
+
+    out.clear();
+    if (added_.empty() && removed_.empty()) {
+        out.swap(base);
+        return;
+    }
+    std::vector<DishId> merged = unite(base, added_);
+    out = subtract(merged, removed_);
+}
+
+void IngredientIndex::PostingList::compact() {
+    if (added_.empty() && removed_.empty()) {
+        return;
+    }
+    std::vector<DishId> ids;
+    decode(ids);
+    bytes_.clear();
+    count_ = 0;
+    last_ = 0;
+    added_.clear();
+    removed_.clear();
+    for (DishId id : ids) {
+        append(id);
+    }
+    bytes_.shrink_to_fit();
+}
+
+void IngredientIndex::PostingList::compactIfNeeded() {
+    if (added_.size() + removed_.size() > 32 + count_ / 8) {
+        compact();
+    }
+}
+
+std::size_t IngredientIndex::PostingList::memoryUsage() const {
+    return bytes_.capacity() + (added_.capacity() + removed_.capacity()) * sizeof(DishId);
+}
+
+// IngredientIndex
+
+// Default Constructor
+IngredientIndex::IngredientIndex() : table_(IngredientTable::global()), dish_count_(0) {}
+
+bool IngredientIndex::contains(DishId id) const {
+    return id < members_.size() && members_[id];
+}
+
+std::vector<DishId> IngredientIndex::dishesWith(std::string_view ingredient) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::INGREDIENT_QUERY);
+    std::vector<DishId> ids;
+    postingsFor(ingredient, ids);
+    return ids;
+}
+
+std::vector<DishId> IngredientIndex::find(const Query& query) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::INGREDIENT_QUERY);
+    std::vector<DishId> result;
+    std::vector<DishId> list;
+
+    if (!query.all_of.empty()) {
+        // Intersect the shortest lists first so the running result shrinks as fast as possible
+        std::vector<std::vector<DishId>> lists;
+        for (std::string_view ingredient : query.all_of) {
+            if (!postingsFor(ingredient, list)) {
+                return {};
+            }
+            lists.push_back(std::move(list));
+        }
+        std::sort(lists.begin(), lists.end(),
+                  [](const std::vector<DishId>& a, const std::vector<DishId>& b) { return a.size() < b.size(); });
+        result = std::move(lists[0]);
+        for (std::size_t i = 1; i < lists.size() && !result.empty(); ++i) {
+            result = intersect(result, lists[i]);
+        }
+    }
+
+    if (!query.any_of.empty()) {
+        std::vector<DishId> any;
+        for (std::string_view ingredient : query.any_of) {
+            if (postingsFor(ingredient, list)) {
+                any = unite(any, list);
+            }
+        }
+        result = query.all_of.empty() ? std::move(any) : intersect(result, any);
+    } else if (query.all_of.empty()) {
+        result = allDishes();
+    }
+
+    for (std::string_view ingredient : query.none_of) {
+        if (!result.empty() && postingsFor(ingredient, list)) {
+            result = subtract(result, list);
+        }
+    }
+    return result;
+}
+
+std::size_t IngredientIndex::memoryUsage() const {
+    std::size_t bytes = postings_.capacity() * sizeof(PostingList) + members_.capacity() / 8;
+    for (const PostingList& postings : postings_) {
+        bytes += postings.memoryUsage();
+    }
+    return bytes;
+}
+
+void IngredientIndex::add(const Dish& dish) {
+    const DishId id = dish.getId();
+    if (id == kNoDishId) {
+        throw std::invalid_argument("IngredientIndex::add: dish has no ID");
+    }
+    if (contains(id)) {
+        return;
+    }
+    if (id >= members_.size()) {
+        members_.resize(static_cast<std::size_t>(id) + 1, false);
+    }
+    members_[id] = true;
+    ++dish_count_;
+    insertPostings(dish);
+}
+
+void IngredientIndex::remove(const Dish& dish) {
+    if (!contains(dish.getId())) {
+        return;
+    }
+    erasePostings(dish);
+    members_[dish.getId()] = false;
+    --dish_count_;
+}
+
+void IngredientIndex::clear() {
+    postings_.clear();
+    members_.clear();
+    dish_count_ = 0;
+}
+
+void IngredientIndex::compact() {
+    for (PostingList& postings : postings_) {
+        postings.compact();
+    }
+}
+
+void IngredientIndex::dishChanging(const Dish& dish, DishField field) {
+    if (field == DishField::INGREDIENTS && contains(dish.getId())) {
+        erasePostings(dish);
+    }
+}
+
+void IngredientIndex::dishChanged(const Dish& dish, DishField field) {
+    if (field == DishField::INGREDIENTS && contains(dish.getId())) {
+        insertPostings(dish);
+    }
+}
+
+// Helper functions
+
+void IngredientIndex::insertPostings(const Dish& dish) {
+    for (IngredientId ingredient : uniqueIngredients(dish)) {
+        if (ingredient >= postings_.size()) {
+            postings_.resize(static_cast<std::size_t>(ingredient) + 1);
+        }
+        postings_[ingredient].insert(dish.getId());
+    }
+}
+
+void IngredientIndex::erasePostings(const Dish& dish) {
+    for (IngredientId ingredient : uniqueIngredients(dish)) {
+        postings_[ingredient].erase(dish.getId());
+    }
+}
+
+std::vector<DishId> IngredientIndex::allDishes() const {
+    std::vector<DishId> ids;
+    ids.reserve(dish_count_);
+    for (std::size_t id = 0; id < members_.size(); ++id) {
+        if (members_[id]) {
+            ids.push_back(static_cast<DishId>(id));
+        }
+    }
+    return ids;
+}
+
+bool IngredientIndex::postingsFor(std::string_view ingredient, std::vector<DishId>& out) const {
+    IngredientId id;
+    out.clear();
+    if (!table_.find(ingredient, id) || id >= postings_.size()) {
+        return false;
+    }
+    postings_[id].decode(out);
+    return true;
+}
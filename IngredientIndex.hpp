@@ -0,0 +1,142 @@
+/**
+ * @file IngredientIndex.hpp
+ * @brief This file contains the declaration of the IngredientIndex class, an inverted index from ingredients to the
+ * dishes that contain them.
+ *
+ * For every ingredient the index keeps a sorted posting list of DishIds, stored as varint-encoded deltas plus a
+ * small uncompressed buffer of recent insertions and removals that is folded back in once it grows. Queries
+ * combine posting lists with AND (all of), OR (any of) and NOT (none of).
+ * The index is a DishObserver: once a dish is added and observed by the index (directly or through an
+ * ObserverList), calls to setIngredients keep its postings up to date.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef INGREDIENT_INDEX_HPP
+#define INGREDIENT_INDEX_HPP
+
+#include "Dish.hpp"
+#include "DishObserver.hpp"
+#include "IngredientTable.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+class IngredientIndex : public DishObserver {
+public:
+    /**
+     * A query over ingredient names: dishes containing every ingredient in all_of, at least one ingredient in
+     * any_of (ignored when empty), and none of the ingredients in none_of.
+     */
+    struct Query {
+        std::vector<std::string_view> all_of;
+        std::vector<std::string_view> any_of;
+        std::vector<std::string_view> none_of;
+
+        Query& require(std::string_view ingredient) { all_of.push_back(ingredient); return *this; }
+        Query& either(std::string_view ingredient) { any_of.push_back(ingredient); return *this; }
+        Query& exclude(std::string_view ingredient) { none_of.push_back(ingredient); return *this; }
+    };
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty index over IngredientTable::global().
+     */
+    IngredientIndex();
+
+    // Accessors
+    /**
+     * @return The number of dishes in the index.
+     */
+    std::size_t size() const { return dish_count_; }
+
+    /**
+     * @param id A dish ID.
+     * @return True if the dish with that ID has been added.
+     */
+    bool contains(DishId id) const;
+
+    /**
+     * @param ingredient An ingredient name.
+     * @return The IDs of the dishes containing the ingredient, in increasing order.
+     */
+    std::vector<DishId> dishesWith(std::string_view ingredient) const;
+
+    /**
+     * Evaluates a query.
+     * @param query The ingredient query.
+     * @return The IDs of the matching dishes, in increasing order.
+     */
+    std::vector<DishId> find(const Query& query) const;
+
+    /**
+     * @return The heap bytes used by the posting lists.
+     */
+    std::size_t memoryUsage() const;
+
+    // Mutators
+    /**
+     * Adds a dish to the index. The dish must have an ID (see Dish::setId).
+     * @param dish The dish to index.
+     */
+    void add(const Dish& dish);
+
+    /**
+     * Removes a dish from the index.
+     * @param dish The dish to remove, still holding the ingredients it was indexed with.
+     */
+    void remove(const Dish& dish);
+
+    /**
+     * Removes every dish from the index.
+     */
+    void clear();
+
+    /**
+     * Folds every pending insertion and removal into the compressed posting lists.
+     */
+    void compact();
+
+    // DishObserver
+    void dishChanging(const Dish& dish, DishField field) override;
+    void dishChanged(const Dish& dish, DishField field) override;
+    void dishesCleared() override { clear(); }
+
+private:
+    // A sorted set of DishIds stored as varint deltas, with sorted pending insertions and removals
+    class PostingList {
+    public:
+        void insert(DishId id);
+        void erase(DishId id);
+        void decode(std::vector<DishId>& out) const;
+        void compact();
+        std::size_t size() const { return count_ + added_.size() - removed_.size(); }
+        std::size_t memoryUsage() const;
+
+    private:
+        std::vector<std::uint8_t> bytes_;
+        std::uint32_t count_ = 0;
+        DishId last_ = 0;
+        std::vector<DishId> added_;
+        std::vector<DishId> removed_;
+
+        void append(DishId id);
+        void compactIfNeeded();
+    };
+
+    const IngredientTable& table_;
+    std::vector<PostingList> postings_;  // indexed by IngredientId
+    std::vector<bool> members_;          // indexed by DishId
+    std::size_t dish_count_;
+
+    // Helper functions for the posting-list updates and set algebra
+    void insertPostings(const Dish& dish);
+    void erasePostings(const Dish& dish);
+    std::vector<DishId> allDishes() const;
+    bool postingsFor(std::string_view ingredient, std::vector<DishId>& out) const;
+};
+
+#endif // INGREDIENT_INDEX_HPP
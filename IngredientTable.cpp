@@ -0,0 +1,81 @@
+/**
+ * @file IngredientTable.cpp
+ * @brief This file contains the implementation of the IngredientTable class, a shared symbol table of ingredient names.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "IngredientTable.hpp"
+#include "StableHash.hpp"
+#include <stdexcept>
+
+// Default Constructor
+IngredientTable::IngredientTable() : size_(0) {
+    for (std::atomic<Entry*>& chunk : chunks_) {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+// Destructor
+IngredientTable::~IngredientTable() {
+    for (std::atomic<Entry*>& chunk : chunks_) {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+IngredientTable& IngredientTable::global() {
+    static IngredientTable table;
+    return table;
+}
+
+bool IngredientTable::find(std::string_view name, IngredientId& id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    if (it == ids_.end()) {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
+
+std::size_t IngredientTable::memoryUsage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t bytes = names_.size() * sizeof(std::string);
+    for (const std::string& name : names_) {
+        if (name.capacity() > 15) {  // longer names live outside the small-string buffer
+            bytes += name.capacity() + 1;
+        }
+    }
+    const std::size_t chunks = (names_.size() + kChunkMask) >> kChunkBits;
+    bytes += chunks * (kChunkMask + 1) * sizeof(Entry);
+    bytes += ids_.bucket_count() * sizeof(void*) + ids_.size() * (sizeof(std::string_view) + sizeof(IngredientId) + 2 * sizeof(void*));
+    return bytes;
+}
+
+IngredientId IngredientTable::intern(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+
+    const std::size_t index = names_.size();
+    if ((index >> kChunkBits) >= kMaxChunks) {
+        throw std::length_error("IngredientTable: too many distinct ingredients");
+    }
+    const IngredientId id = static_cast<IngredientId>(index);
+    Entry* chunk = chunks_[id >> kChunkBits].load(std::memory_order_relaxed);
+    if (chunk == nullptr) {
+        chunk = new Entry[kChunkMask + 1];
+        chunks_[id >> kChunkBits].store(chunk, std::memory_order_release);
+    }
+
+    names_.emplace_back(name);
+    const std::string_view stored = names_.back();
+    chunk[id & kChunkMask].name = stored;
+    chunk[id & kChunkMask].hash = stableHash(stored);
+    ids_.emplace(stored, id);
+    size_.store(index + 1, std::memory_order_release);
+    return id;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file IngredientTable.hpp
+ * @brief This file contains the declaration of the IngredientTable class, a shared symbol table of ingredient names.
+ *
+ * Every distinct ingredient name is stored once and identified by a 32-bit IngredientId, so a Dish only keeps
+ * a compact list of IDs. IDs are dense (0, 1, 2, ...) and never reused, and the string view returned for an ID
+ * stays valid for the lifetime of the table. Each name's stableHash() is computed once when it is interned, so dish
+ * hashes fold in one word per ingredient. Lookups by ID are lock-free; interning takes a mutex.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef INGREDIENT_TABLE_HPP
+#define INGREDIENT_TABLE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+using IngredientId = std::uint32_t;
+
+class IngredientTable {
+public:
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty table. Most code uses the process-wide table returned by global().
+     */
+    IngredientTable();
+
+    IngredientTable(const IngredientTable&) = delete;
+    IngredientTable& operator=(const IngredientTable&) = delete;
+    ~IngredientTable();
+
+    /**
+     * @return The process-wide table shared by every Dish.
+     */
+    static IngredientTable& global();
+
+    // Accessors
+    /**
+     * @param id An ID previously returned by intern().
+     * @return The ingredient name for the ID.
+     */
+    std::string_view lookup(IngredientId id) const {
+        const Entry* chunk = chunks_[id >> kChunkBits].load(std::memory_order_acquire);
+        return chunk[id & kChunkMask].name;
+    }
+
+    /**
+     * @param id An ID previously returned by intern().
+     * @return The stableHash() of the ingredient name, which does not depend on the ID or the order of interning.
+     */
+    std::uint64_t hashOf(IngredientId id) const {
+        const Entry* chunk = chunks_[id >> kChunkBits].load(std::memory_order_acquire);
+        return chunk[id & kChunkMask].hash;
+    }
+
+    /**
+     * Looks up a name without adding it.
+     * @param name The ingredient name.
+     * @param id Set to the ID of the name when it is found.
+     * @return True if the name has been interned.
+     */
+    bool find(std::string_view name, IngredientId& id) const;
+
+    /**
+     * @return The number of distinct ingredient names.
+     */
+    std::size_t size() const { return size_.load(std::memory_order_acquire); }
+
+    /**
+     * @return An estimate of the heap bytes owned by the table (names, lookup entries and hash index).
+     */
+    std::size_t memoryUsage() const;
+
+    // Mutators
+    /**
+     * Returns the ID for a name, adding the name if it has not been seen before.
+     * @param name The ingredient name.
+     * @return The ID of the name.
+     */
+    IngredientId intern(std::string_view name);
+
+private:
+    static constexpr unsigned kChunkBits = 12;
+    static constexpr IngredientId kChunkMask = (IngredientId{1} << kChunkBits) - 1;
+    static constexpr std::size_t kMaxChunks = 4096;  // 16M distinct ingredients
+
+    struct Entry {
+        std::string_view name;
+        std::uint64_t hash;  // stableHash(name)
+    };
+
+    // ID -> name and hash; chunks are allocated on demand and never move, so readers need no lock
+    std::array<std::atomic<Entry*>, kMaxChunks> chunks_;
+    std::atomic<std::size_t> size_;
+
+    // Owned name storage (deque elements never move) and the name -> ID index, guarded by mutex_
+    mutable std::mutex mutex_;
+    std::deque<std::string> names_;
+    std::unordered_map<std::string_view, IngredientId> ids_;
+};
+
+#endif // INGREDIENT_TABLE_HPP
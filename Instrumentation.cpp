@@ -0,0 +1,285 @@
+/**
+ * @file Instrumentation.cpp
+ * @brief This file contains the implementation of the Instrumentation class, optional counters and latency
+ * histograms for the hot paths of the library.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "Instrumentation.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+// A shard is one flat array of counters: the class events, the accessors (calls, allocations, bytes), then per path
+// the count, total, maximum and buckets of its histogram
+constexpr std::size_t kAccessorBase = Instrumentation::kClassCount * Instrumentation::kEventCount;
+constexpr std::size_t kLatencyBase = kAccessorBase + 3 * Instrumentation::kAccessorCount;
+constexpr std::size_t kLatencyStride = 3 + Instrumentation::kBucketCount;
+constexpr std::size_t kSlotCount = kLatencyBase + Instrumentation::kPathCount * kLatencyStride;
+
+using Totals = std::array<std::uint64_t, kSlotCount>;
+
+bool isMaxSlot(std::size_t slot) {
+    return slot >= kLatencyBase && (slot - kLatencyBase) % kLatencyStride == 2;
+}
+
+// Written by its own thread only (plain loads and stores), read under the registry lock by snapshot()
+struct Shard {
+    std::atomic<std::uint64_t> epoch;
+    std::array<std::atomic<std::uint64_t>, kSlotCount> values;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<Shard*> shards;           // of the live threads
+    Totals retired{};                     // the shards of exited threads, folded in
+    std::atomic<std::uint64_t> epoch{0};  // advanced by reset(); a shard of an older epoch counts as zero
+};
+
+Registry& registry() {
+    // Never destroyed, so that threads exiting after main() can still fold their shards in
+    static Registry* const registry = new Registry();
+    return *registry;
+}
+
+void fold(Totals& totals, const Shard& shard) {
+    for (std::size_t slot = 0; slot < kSlotCount; ++slot) {
+        const std::uint64_t value = shard.values[slot].load(std::memory_order_relaxed);
+        totals[slot] = isMaxSlot(slot) ? std::max(totals[slot], value) : totals[slot] + value;
+    }
+}
+
+// Registers the shard of a thread on its first update and folds it into the totals when the thread exits
+struct ShardOwner {
+    Shard* shard;
+
+    ShardOwner() : shard(new Shard()) {
+        for (std::atomic<std::uint64_t>& value : shard->values) {
+            value.store(0, std::memory_order_relaxed);
+        }
+        Registry& all = registry();
+        std::lock_guard<std::mutex> lock(all.mutex);
+        shard->epoch.store(all.epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        all.shards.push_back(shard);
+    }
+
+    ~ShardOwner() {
+        Registry& all = registry();
+        std::lock_guard<std::mutex> lock(all.mutex);
+        if (shard->epoch.load(std::memory_order_relaxed) == all.epoch.load(std::memory_order_relaxed)) {
+            fold(all.retired, *shard);
+        }
+        all.shards.erase(std::find(all.shards.begin(), all.shards.end(), shard));
+        delete shard;
+    }
+};
+
+Shard& localShard() {
+    thread_local ShardOwner owner;
+    Shard& shard = *owner.shard;
+    const std::uint64_t epoch = registry().epoch.load(std::memory_order_acquire);
+    if (shard.epoch.load(std::memory_order_relaxed) != epoch) {
+        for (std::atomic<std::uint64_t>& value : shard.values) {
+            value.store(0, std::memory_order_relaxed);
+        }
+        shard.epoch.store(epoch, std::memory_order_release);
+    }
+    return shard;
+}
+
+void bump(Shard& shard, std::size_t slot, std::uint64_t n) {
+    std::atomic<std::uint64_t>& value = shard.values[slot];
+    value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+// 0-3 ns have a bucket each; above, the 4 buckets of a power of two split it by the two bits after the leading one
+std::size_t bucketOf(std::uint64_t nanoseconds) {
+    if (nanoseconds < 4) {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+    const int leading = 63 - __builtin_clzll(nanoseconds);
+    return 4 + static_cast<std::size_t>(leading - 2) * 4 + static_cast<std::size_t>((nanoseconds >> (leading - 2)) & 3u);
+}
+
+std::uint64_t bucketUpper(std::size_t bucket) {
+    if (bucket < 4) {
+        return bucket;
+    }
+    const int shift = static_cast<int>((bucket - 4) / 4);
+    const std::uint64_t lower = static_cast<std::uint64_t>(4 + (bucket - 4) % 4) << shift;
+    return lower + ((std::uint64_t{1} << shift) - 1);
+}
+
+const char* const kClassNames[] = {"Dish", "Appetizer", "MainCourse", "Dessert"};
+const char* const kEventNames[] = {"constructions", "copies", "moves", "allocations"};
+const char* const kAccessorNames[] = {"getName", "getIngredients", "getCuisineType", "getProteinType", "getSideDishes"};
+const char* const kPathNames[] = {"render", "import", "ingredient_query", "name_query", "range_query", "dietary_query"};
+
+void appendLine(std::string& out, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+void appendLine(std::string& out, const char* format, ...) {
+    char line[200];
+    va_list arguments;
+    va_start(arguments, format);
+    const int length = std::vsnprintf(line, sizeof(line), format, arguments);
+    va_end(arguments);
+    out.append(line, static_cast<std::size_t>(std::clamp<int>(length, 0, sizeof(line) - 1)));
+}
+
+} // namespace
+
+// Latency
+
+double Instrumentation::Latency::meanNs() const {
+    return count == 0 ? 0.0 : static_cast<double>(total_ns) / static_cast<double>(count);
+}
+
+std::uint64_t Instrumentation::Latency::quantileNs(double fraction) const {
+    if (count == 0) {
+        return 0;
+    }
+    const double clamped = std::clamp(fraction, 0.0, 1.0);
+    const std::uint64_t rank = static_cast<std::uint64_t>(clamped * static_cast<double>(count - 1) + 0.5);
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < kBucketCount; ++bucket) {
+        seen += buckets[bucket];
+        if (seen > rank) {
+            return std::min(bucketUpper(bucket), max_ns);
+        }
+    }
+    return max_ns;
+}
+
+// Snapshot
+
+std::string Instrumentation::Snapshot::toText() const {
+    std::string out;
+    appendLine(out, "%-16s %14s %14s %14s %14s\n", "class", kEventNames[0], kEventNames[1], kEventNames[2], kEventNames[3]);
+    for (std::size_t type = 0; type < kClassCount; ++type) {
+        const std::array<std::uint64_t, kEventCount>& row = events[type];
+        appendLine(out, "%-16s %14llu %14llu %14llu %14llu\n", kClassNames[type], static_cast<unsigned long long>(row[0]),
+                   static_cast<unsigned long long>(row[1]), static_cast<unsigned long long>(row[2]), static_cast<unsigned long long>(row[3]));
+    }
+    appendLine(out, "\n%-16s %14s %14s %14s\n", "accessor", "calls", "allocations", "bytes");
+    for (std::size_t accessor = 0; accessor < kAccessorCount; ++accessor) {
+        const AccessorStats& stats = accessors[accessor];
+        appendLine(out, "%-16s %14llu %14llu %14llu\n", kAccessorNames[accessor], static_cast<unsigned long long>(stats.calls),
+                   static_cast<unsigned long long>(stats.allocations), static_cast<unsigned long long>(stats.bytes));
+    }
+    appendLine(out, "\n%-16s %14s %10s %10s %10s %10s %10s\n", "path", "count", "mean_ns", "p50_ns", "p90_ns", "p99_ns", "max_ns");
+    for (std::size_t path = 0; path < kPathCount; ++path) {
+        const Latency& latency = latencies[path];
+        appendLine(out, "%-16s %14llu %10.1f %10llu %10llu %10llu %10llu\n", kPathNames[path], static_cast<unsigned long long>(latency.count),
+                   latency.meanNs(), static_cast<unsigned long long>(latency.quantileNs(0.5)), static_cast<unsigned long long>(latency.quantileNs(0.9)),
+                   static_cast<unsigned long long>(latency.quantileNs(0.99)), static_cast<unsigned long long>(latency.max_ns));
+    }
+    return out;
+}
+
+std::string Instrumentation::Snapshot::toJson() const {
+    std::string out = kEnabled ? "{\"enabled\":true,\"classes\":{" : "{\"enabled\":false,\"classes\":{";
+    for (std::size_t type = 0; type < kClassCount; ++type) {
+        appendLine(out, "%s\"%s\":{", type == 0 ? "" : ",", kClassNames[type]);
+        for (std::size_t event = 0; event < kEventCount; ++event) {
+            appendLine(out, "%s\"%s\":%llu", event == 0 ? "" : ",", kEventNames[event], static_cast<unsigned long long>(events[type][event]));
+        }
+        out += '}';
+    }
+    out += "},\"accessors\":{";
+    for (std::size_t accessor = 0; accessor < kAccessorCount; ++accessor) {
+        const AccessorStats& stats = accessors[accessor];
+        appendLine(out, "%s\"%s\":{\"calls\":%llu,\"allocations\":%llu,\"bytes\":%llu}", accessor == 0 ? "" : ",", kAccessorNames[accessor],
+                   static_cast<unsigned long long>(stats.calls), static_cast<unsigned long long>(stats.allocations),
+                   static_cast<unsigned long long>(stats.bytes));
+    }
+    out += "},\"latencies\":{";
+    for (std::size_t path = 0; path < kPathCount; ++path) {
+        const Latency& latency = latencies[path];
+        appendLine(out, "%s\"%s\":{\"count\":%llu,\"mean_ns\":%.1f,\"p50_ns\":%llu,\"p90_ns\":%llu,\"p99_ns\":%llu,\"max_ns\":%llu}",
+                   path == 0 ? "" : ",", kPathNames[path], static_cast<unsigned long long>(latency.count), latency.meanNs(),
+                   static_cast<unsigned long long>(latency.quantileNs(0.5)), static_cast<unsigned long long>(latency.quantileNs(0.9)),
+                   static_cast<unsigned long long>(latency.quantileNs(0.99)), static_cast<unsigned long long>(latency.max_ns));
+    }
+    out += "}}";
+    return out;
+}
+
+// Collection
+
+Instrumentation::Snapshot Instrumentation::snapshot() {
+    Snapshot snapshot{};
+    if constexpr (!kEnabled) {
+        return snapshot;
+    }
+    Totals totals{};
+    {
+        Registry& all = registry();
+        std::lock_guard<std::mutex> lock(all.mutex);
+        totals = all.retired;
+        const std::uint64_t epoch = all.epoch.load(std::memory_order_relaxed);
+        for (const Shard* shard : all.shards) {
+            if (shard->epoch.load(std::memory_order_acquire) == epoch) {
+                fold(totals, *shard);
+            }
+        }
+    }
+    for (std::size_t type = 0; type < kClassCount; ++type) {
+        for (std::size_t event = 0; event < kEventCount; ++event) {
+            snapshot.events[type][event] = totals[type * kEventCount + event];
+        }
+    }
+    for (std::size_t accessor = 0; accessor < kAccessorCount; ++accessor) {
+        const std::size_t base = kAccessorBase + 3 * accessor;
+        snapshot.accessors[accessor] = {totals[base], totals[base + 1], totals[base + 2]};
+    }
+    for (std::size_t path = 0; path < kPathCount; ++path) {
+        const std::size_t base = kLatencyBase + path * kLatencyStride;
+        Latency& latency = snapshot.latencies[path];
+        latency.count = totals[base];
+        latency.total_ns = totals[base + 1];
+        latency.max_ns = totals[base + 2];
+        std::copy(totals.begin() + static_cast<std::ptrdiff_t>(base + 3), totals.begin() + static_cast<std::ptrdiff_t>(base + kLatencyStride),
+                  latency.buckets.begin());
+    }
+    return snapshot;
+}
+
+void Instrumentation::reset() {
+    Registry& all = registry();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    all.retired.fill(0);
+    all.epoch.fetch_add(1, std::memory_order_release);
+}
+
+// Helper functions
+
+void Instrumentation::add(std::size_t slot, std::uint64_t n) {
+    bump(localShard(), slot, n);
+}
+
+void Instrumentation::addAccessor(std::size_t accessor, std::uint64_t allocations, std::uint64_t bytes) {
+    Shard& shard = localShard();
+    const std::size_t base = kAccessorBase + 3 * accessor;
+    bump(shard, base, 1);
+    bump(shard, base + 1, allocations);
+    bump(shard, base + 2, bytes);
+}
+
+void Instrumentation::addLatency(std::size_t path, std::uint64_t nanoseconds) {
+    Shard& shard = localShard();
+    const std::size_t base = kLatencyBase + path * kLatencyStride;
+    bump(shard, base, 1);
+    bump(shard, base + 1, nanoseconds);
+    std::atomic<std::uint64_t>& max = shard.values[base + 2];
+    if (nanoseconds > max.load(std::memory_order_relaxed)) {
+        max.store(nanoseconds, std::memory_order_relaxed);
+    }
+    bump(shard, base + 3 + bucketOf(nanoseconds), 1);
+}
@@ -0,0 +1,175 @@
+/**
+ * @file Instrumentation.hpp
+ * @brief This file contains the declaration of the Instrumentation class, optional counters and latency histograms
+ * for the hot paths of the library.
+ *
+ * Instrumentation is switched at compile time with BISTRO_INSTRUMENTATION (`make clean && make INSTRUMENTATION=1`).
+ * When it is 0, the default, every hook is an empty inline function and ScopedTimer an empty object, so the
+ * instrumented code compiles to what it was without them; `./bench instrumentation` run on both builds shows the
+ * difference. When it is 1, the library counts:
+ * - per class, the constructions, copies and moves of dishes, and the heap blocks the copies allocate. Dish counts
+ *   every dish, since each subclass constructs a Dish; a subclass counts its own objects;
+ * - per copying accessor (getName, getIngredients, getCuisineType, getProteinType, getSideDishes), the calls and
+ *   the heap blocks and bytes of the copies they return;
+ * - per path (rendering a record, importing, and the queries of the indexes), a histogram of the latencies in
+ *   nanoseconds, with 4 sub-buckets per power of two, so quantiles are within 25%.
+ * Heap blocks are estimated from the sizes copied and the inline capacities of the containers (std::string keeps
+ * 15 characters inline, SmallString kInlineCapacity), as the library cannot see the allocator.
+ *
+ * Each thread updates its own shard without atomic read-modify-writes; snapshot() adds up the shards of the live
+ * threads and the totals of the threads that exited. A snapshot exports as aligned text or as one JSON object.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+#ifndef BISTRO_INSTRUMENTATION
+#define BISTRO_INSTRUMENTATION 0
+#endif
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class Instrumentation {
+public:
+    static constexpr bool kEnabled = BISTRO_INSTRUMENTATION != 0;
+
+    // Characters std::string (libstdc++) keeps without allocating
+    static constexpr std::size_t kStringInlineCapacity = 15;
+
+    // What is counted per class
+    enum class Class : std::uint8_t { DISH, APPETIZER, MAIN_COURSE, DESSERT };
+    enum class Event : std::uint8_t { CONSTRUCTION, COPY, MOVE, ALLOCATION };
+    static constexpr std::size_t kClassCount = 4;
+    static constexpr std::size_t kEventCount = 4;
+
+    // The accessors that return copies
+    enum class Accessor : std::uint8_t { GET_NAME, GET_INGREDIENTS, GET_CUISINE_TYPE, GET_PROTEIN_TYPE, GET_SIDE_DISHES };
+    static constexpr std::size_t kAccessorCount = 5;
+
+    // The timed paths
+    enum class Path : std::uint8_t { RENDER, IMPORT, INGREDIENT_QUERY, NAME_QUERY, RANGE_QUERY, DIETARY_QUERY };
+    static constexpr std::size_t kPathCount = 6;
+
+    // Latency buckets: 0-3 ns exactly, then 4 per power of two up to 2^64 ns
+    static constexpr std::size_t kBucketCount = 252;
+
+    struct AccessorStats {
+        std::uint64_t calls;
+        std::uint64_t allocations;
+        std::uint64_t bytes;
+    };
+
+    struct Latency {
+        std::uint64_t count;
+        std::uint64_t total_ns;
+        std::uint64_t max_ns;
+        std::array<std::uint64_t, kBucketCount> buckets;
+
+        /**
+         * @return The mean latency in nanoseconds, or 0 if nothing was timed.
+         */
+        double meanNs() const;
+
+        /**
+         * @param fraction The quantile, in [0, 1].
+         * @return The upper end of the bucket holding the quantile (at most max_ns), or 0 if nothing was timed.
+         */
+        std::uint64_t quantileNs(double fraction) const;
+    };
+
+    // The counters at one point in time
+    struct Snapshot {
+        std::array<std::array<std::uint64_t, kEventCount>, kClassCount> events;
+        std::array<AccessorStats, kAccessorCount> accessors;
+        std::array<Latency, kPathCount> latencies;
+
+        std::uint64_t count(Class type, Event event) const { return events[static_cast<std::size_t>(type)][static_cast<std::size_t>(event)]; }
+        const AccessorStats& accessor(Accessor accessor) const { return accessors[static_cast<std::size_t>(accessor)]; }
+        const Latency& latency(Path path) const { return latencies[static_cast<std::size_t>(path)]; }
+
+        /**
+         * @return The counters as aligned tables, one line per class, accessor and path.
+         */
+        std::string toText() const;
+
+        /**
+         * @return The counters as one JSON object with "enabled", "classes", "accessors" and "latencies" members.
+         */
+        std::string toJson() const;
+    };
+
+    /**
+     * @return The counters of every thread since the start or the last reset(); all zero when disabled.
+     */
+    static Snapshot snapshot();
+
+    /**
+     * Sets every counter to zero. Threads that are counting start over from their next update.
+     */
+    static void reset();
+
+    // Hooks called by the library; they compile to nothing when disabled
+    static void count(Class type, Event event, std::uint64_t n = 1) {
+        if constexpr (kEnabled) {
+            add(eventSlot(type, event), n);
+        }
+    }
+
+    static void accessorCall(Accessor accessor, std::uint64_t allocations, std::uint64_t bytes) {
+        if constexpr (kEnabled) {
+            addAccessor(static_cast<std::size_t>(accessor), allocations, bytes);
+        }
+    }
+
+    static void recordLatency(Path path, std::uint64_t nanoseconds) {
+        if constexpr (kEnabled) {
+            addLatency(static_cast<std::size_t>(path), nanoseconds);
+        }
+    }
+
+    /**
+     * @param length The length of a string.
+     * @return The heap blocks copying it into a std::string allocates (0 or 1).
+     */
+    static constexpr std::uint64_t stringBlocks(std::size_t length) { return length > kStringInlineCapacity ? 1 : 0; }
+
+    // Times the scope it lives in as one call of a path
+#if BISTRO_INSTRUMENTATION
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(Path path) : path_(path), start_(std::chrono::steady_clock::now()) {}
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+        ~ScopedTimer() {
+            const auto elapsed = std::chrono::steady_clock::now() - start_;
+            recordLatency(path_, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+
+    private:
+        Path path_;
+        std::chrono::steady_clock::time_point start_;
+    };
+#else
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(Path) {}
+    };
+#endif
+
+private:
+    static std::size_t eventSlot(Class type, Event event) { return static_cast<std::size_t>(type) * kEventCount + static_cast<std::size_t>(event); }
+
+    // Helper functions: update the calling thread's shard
+    static void add(std::size_t slot, std::uint64_t n);
+    static void addAccessor(std::size_t accessor, std::uint64_t allocations, std::uint64_t bytes);
+    static void addLatency(std::size_t path, std::uint64_t nanoseconds);
+};
+
+#endif // INSTRUMENTATION_HPP
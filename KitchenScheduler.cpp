@@ -0,0 +1,187 @@
+/**
+ * @file KitchenScheduler.cpp
+ * @brief This file contains the implementation of the KitchenScheduler class, a discrete-event simulation of
+ * kitchen stations preparing a stream of orders.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "KitchenScheduler.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// One dish waiting for, or being prepared at, a station
+struct Task {
+    std::uint32_t order;  // index into the kitchen's orders
+    int minutes;
+};
+
+// The statistics of one kitchen
+struct KitchenResult {
+    std::vector<double> latencies;
+    std::vector<double> busy;
+    double makespan = 0.0;
+    std::size_t dishes = 0;
+    std::size_t steals = 0;
+};
+
+// Simulates one kitchen on the orders first, first + stride, first + 2 * stride, ...
+void simulateKitchen(Span<const int> prep_times, Span<const KitchenOrder> orders, std::size_t first, std::size_t stride,
+                     std::size_t station_count, KitchenResult& result) {
+    std::vector<std::deque<Task>> queues(station_count);
+    std::vector<Task> current(station_count);
+    std::vector<bool> idle(station_count, true);
+    std::vector<double> arrivals;
+    std::vector<std::uint32_t> remaining;
+    result.busy.assign(station_count, 0.0);
+
+    // Stations that are cooking, ordered by the time their current dish is ready
+    using Event = std::pair<double, std::size_t>;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> cooking;
+
+    // Gives a free station its next dish: the front of its own queue, or else the back of the longest queue
+    auto startNext = [&](std::size_t station, double now) {
+        std::deque<Task>* source = &queues[station];
+        if (source->empty()) {
+            source = nullptr;
+            std::size_t longest = 0;
+            for (std::deque<Task>& queue : queues) {
+                if (queue.size() > longest) {
+                    longest = queue.size();
+                    source = &queue;
+                }
+            }
+            if (source == nullptr) {
+                idle[station] = true;
+                return;
+            }
+            current[station] = source->back();
+            source->pop_back();
+            ++result.steals;
+        } else {
+            current[station] = source->front();
+            source->pop_front();
+        }
+        idle[station] = false;
+        result.busy[station] += current[station].minutes;
+        cooking.emplace(now + current[station].minutes, station);
+    };
+
+    std::size_t next = first;
+    std::size_t home = 0;
+    while (next < orders.size() || !cooking.empty()) {
+        // A dish finishing at the same time as an order arrives frees its station first
+        if (!cooking.empty() && (next >= orders.size() || cooking.top().first <= orders[next].arrival)) {
+            const auto [now, station] = cooking.top();
+            cooking.pop();
+            const std::uint32_t order = current[station].order;
+            if (--remaining[order] == 0) {
+                result.latencies.push_back(now - arrivals[order]);
+            }
+            result.makespan = std::max(result.makespan, now);
+            startNext(station, now);
+            continue;
+        }
+
+        const KitchenOrder& order = orders[next];
+        next += stride;
+        if (order.dishes.empty()) {
+            result.latencies.push_back(0.0);
+            continue;
+        }
+        const auto index = static_cast<std::uint32_t>(arrivals.size());
+        arrivals.push_back(order.arrival);
+        remaining.push_back(static_cast<std::uint32_t>(order.dishes.size()));
+        for (DishId dish : order.dishes) {
+            queues[home].push_back({index, std::max(0, prep_times[dish])});
+        }
+        result.dishes += order.dishes.size();
+
+        // The home station takes its own order first; any other idle station steals from it
+        for (std::size_t k = 0; k < station_count; ++k) {
+            const std::size_t station = (home + k) % station_count;
+            if (idle[station]) {
+                startNext(station, order.arrival);
+            }
+        }
+        home = (home + 1) % station_count;
+    }
+}
+
+// Nearest-rank percentile of an unsorted sample; reorders the sample
+double percentile(std::vector<double>& sample, double fraction) {
+    if (sample.empty()) {
+        return 0.0;
+    }
+    const auto rank = static_cast<std::size_t>(fraction * static_cast<double>(sample.size() - 1) + 0.5);
+    std::nth_element(sample.begin(), sample.begin() + static_cast<std::ptrdiff_t>(rank), sample.end());
+    return sample[rank];
+}
+
+} // namespace
+
+// Parameterized Constructor
+KitchenScheduler::KitchenScheduler(std::size_t stations, std::size_t kitchens, std::size_t threads)
+        : stations_(stations), kitchens_(kitchens), pool_(new ThreadPool(threads)) {
+    if (stations == 0 || kitchens == 0) {
+        throw std::invalid_argument("KitchenScheduler: stations and kitchens must be at least 1");
+    }
+}
+
+KitchenScheduler::Report KitchenScheduler::schedule(const Menu& menu, Span<const KitchenOrder> orders) const {
+    std::vector<int> prep_times(menu.size());
+    for (std::size_t position = 0; position < menu.size(); ++position) {
+        prep_times[position] = menu[position].getPrepTime();
+    }
+    return schedule(prep_times, orders);
+}
+
+KitchenScheduler::Report KitchenScheduler::schedule(Span<const int> prep_times, Span<const KitchenOrder> orders) const {
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+        if (i != 0 && orders[i].arrival < orders[i - 1].arrival) {
+            throw std::invalid_argument("KitchenScheduler::schedule: orders are not sorted by arrival");
+        }
+        for (DishId dish : orders[i].dishes) {
+            if (dish >= prep_times.size()) {
+                throw std::out_of_range("KitchenScheduler::schedule: order refers to an unknown dish");
+            }
+        }
+    }
+
+    std::vector<KitchenResult> kitchens(kitchens_);
+    pool_->parallelFor(kitchens_, [&](std::size_t k) {
+        simulateKitchen(prep_times, orders, k, kitchens_, stations_, kitchens[k]);
+    });
+
+    Report report;
+    report.orders = orders.size();
+    report.station_busy.reserve(kitchens_ * stations_);
+    std::vector<double> latencies;
+    latencies.reserve(orders.size());
+    for (KitchenResult& kitchen : kitchens) {
+        report.dishes += kitchen.dishes;
+        report.steals += kitchen.steals;
+        report.makespan = std::max(report.makespan, kitchen.makespan);
+        report.station_busy.insert(report.station_busy.end(), kitchen.busy.begin(), kitchen.busy.end());
+        latencies.insert(latencies.end(), kitchen.latencies.begin(), kitchen.latencies.end());
+    }
+
+    double total = 0.0;
+    for (double latency : latencies) {
+        total += latency;
+        report.max_latency = std::max(report.max_latency, latency);
+    }
+    report.mean_latency = latencies.empty() ? 0.0 : total / static_cast<double>(latencies.size());
+    report.p50_latency = percentile(latencies, 0.50);
+    report.p90_latency = percentile(latencies, 0.90);
+    report.p99_latency = percentile(latencies, 0.99);
+    return report;
+}
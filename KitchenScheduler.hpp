@@ -0,0 +1,112 @@
+/**
+ * @file KitchenScheduler.hpp
+ * @brief This file contains the declaration of the KitchenScheduler class, a discrete-event simulation of kitchen
+ * stations preparing a stream of orders, timed by Dish::getPrepTime().
+ *
+ * Each order is a list of menu positions arriving at a point in simulated time (minutes since the start of
+ * service). An arriving order is queued on one station in turn; a station works through its own queue from the
+ * front, and a station with nothing left steals a dish from the back of the longest queue in its kitchen, so busy
+ * stations are relieved by idle ones the way a work-stealing pool balances tasks. Every dish occupies one station
+ * for its preparation time, and an order is ready when its last dish is.
+ *
+ * The schedule reports the makespan, the busy time and utilization of every station, and percentiles of the order
+ * latency (ready time minus arrival). Orders can be spread round-robin over several independent kitchens; the
+ * kitchens are simulated concurrently on a ThreadPool, and the simulation is deterministic for any thread count.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef KITCHEN_SCHEDULER_HPP
+#define KITCHEN_SCHEDULER_HPP
+
+#include "DishObserver.hpp"
+#include "Menu.hpp"
+#include "Span.hpp"
+#include "ThreadPool.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// A customer order: dishes from a menu, arriving at a point in simulated time
+struct KitchenOrder {
+    double arrival = 0.0;        // minutes since the start of service
+    std::vector<DishId> dishes;  // menu positions
+};
+
+class KitchenScheduler {
+public:
+    // The outcome of one schedule
+    struct Report {
+        std::size_t orders = 0;
+        std::size_t dishes = 0;
+        std::size_t steals = 0;              // dishes prepared by a station other than the one they were queued on
+        double makespan = 0.0;               // minutes from the start of service until the last dish is ready
+        std::vector<double> station_busy;    // minutes each station spent cooking, kitchen by kitchen
+        double mean_latency = 0.0;           // order latencies in minutes
+        double p50_latency = 0.0;
+        double p90_latency = 0.0;
+        double p99_latency = 0.0;
+        double max_latency = 0.0;
+
+        /**
+         * @param station A station index (kitchen * stations per kitchen + station).
+         * @return The fraction of the makespan the station spent cooking.
+         */
+        double utilization(std::size_t station) const { return makespan > 0.0 ? station_busy[station] / makespan : 0.0; }
+    };
+
+    // Constructors
+    /**
+     * Parameterized constructor.
+     * @param stations The number of stations in each kitchen (at least 1).
+     * @param kitchens The number of independent kitchens the orders are spread over (default is 1).
+     * @param threads The number of simulation threads; 0 (the default) uses every hardware thread.
+     * @throw std::invalid_argument if stations or kitchens is 0.
+     */
+    explicit KitchenScheduler(std::size_t stations, std::size_t kitchens = 1, std::size_t threads = 0);
+
+    // Accessors
+    /**
+     * @return The number of stations in each kitchen.
+     */
+    std::size_t stationCount() const { return stations_; }
+
+    /**
+     * @return The number of kitchens.
+     */
+    std::size_t kitchenCount() const { return kitchens_; }
+
+    /**
+     * @return The number of simulation threads.
+     */
+    std::size_t threadCount() const { return pool_->size(); }
+
+    // Scheduling
+    /**
+     * Simulates the preparation of a stream of orders from a menu.
+     * @param menu The menu the orders refer to; preparation times come from Dish::getPrepTime().
+     * @param orders The orders, in non-decreasing order of arrival.
+     * @return The schedule statistics.
+     * @throw std::invalid_argument if the orders are not sorted by arrival.
+     * @throw std::out_of_range if an order refers to a position past the end of the menu.
+     */
+    Report schedule(const Menu& menu, Span<const KitchenOrder> orders) const;
+
+    /**
+     * Simulates the preparation of a stream of orders.
+     * @param prep_times The preparation time in minutes of every dish, indexed by the DishIds the orders use.
+     * @param orders The orders, in non-decreasing order of arrival.
+     * @return The schedule statistics.
+     * @throw std::invalid_argument if the orders are not sorted by arrival.
+     * @throw std::out_of_range if an order refers to an ID past the end of prep_times.
+     */
+    Report schedule(Span<const int> prep_times, Span<const KitchenOrder> orders) const;
+
+private:
+    std::size_t stations_;
+    std::size_t kitchens_;
+    std::unique_ptr<ThreadPool> pool_;
+};
+
+#endif // KITCHEN_SCHEDULER_HPP
@@ -11,13 +11,39 @@
  */
 
 #include "MainCourse.hpp"
+#include "StableHash.hpp"
+#include <utility>
+
+namespace {
+
+// Counts a copy of the main course's own fields and the heap blocks it allocates: the protein type and side dish
+// names past SmallString's inline buffer, and the side dish list
+void countCopy(const MainCourse& main_course) {
+    if constexpr (Instrumentation::kEnabled) {
+        const Span<const MainCourse::SideDish> side_dishes = main_course.getSideDishesView();
+        std::uint64_t blocks = (main_course.getProteinTypeView().size() > SmallString::kInlineCapacity ? 1 : 0) +
+                               (side_dishes.empty() ? 0 : 1);
+        for (const MainCourse::SideDish& side_dish : side_dishes) {
+            blocks += side_dish.name.isInline() ? 0 : 1;
+        }
+        Instrumentation::count(Instrumentation::Class::MAIN_COURSE, Instrumentation::Event::COPY);
+        Instrumentation::count(Instrumentation::Class::MAIN_COURSE, Instrumentation::Event::ALLOCATION, blocks);
+    }
+}
+
+} // namespace
 
 /**
  * Default constructor.
  * Initializes all private members with default values.
  */
-MainCourse::MainCourse()
-        : Dish("UNKNOWN", {}, 0, 0.0, CuisineType::OTHER), cooking_method_(CookingMethod::GRILLED), protein_type_("UNKNOWN"), gluten_free_(false), side_dishes_({}) {}
+MainCourse::MainCourse() : MainCourse(allocator_type()) {}
+
+MainCourse::MainCourse(const allocator_type& allocator)
+        : Dish(allocator), cooking_method_(GRILLED), protein_type_("UNKNOWN", allocator), side_dishes_(allocator) {
+    setDietaryAttribute(GLUTEN_FREE, false);
+    Instrumentation::count(Instrumentation::Class::MAIN_COURSE, Instrumentation::Event::CONSTRUCTION);
+}
 
 /**
    * Parameterized constructor.
@@ -33,23 +59,85 @@ course.
 course.
    * @param gluten_free Boolean flag indicating if the main course is
 gluten-free.
+   * @param allocator The allocator for the name, ingredients, protein type and side dishes.
    */
-MainCourse::MainCourse(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type,
-                       CookingMethod cooking_method, const std::string& protein_type, const std::vector<SideDish>& side_dishes, bool gluten_free)
-        : Dish(name, ingredients, prep_time, price, cuisine_type), cooking_method_(cooking_method), protein_type_(protein_type), side_dishes_(side_dishes), gluten_free_(gluten_free) {}
+MainCourse::MainCourse(std::string_view name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type,
+                       CookingMethod cooking_method, std::string_view protein_type, const std::vector<SideDish>& side_dishes, bool gluten_free,
+                       const allocator_type& allocator)
+        : Dish(name, ingredients, prep_time, price, cuisine_type, allocator), cooking_method_(toEnumBits(cooking_method, RAW, GRILLED)), protein_type_(protein_type, allocator),
+          side_dishes_(side_dishes.begin(), side_dishes.end(), allocator) {
+    setDietaryAttribute(GLUTEN_FREE, gluten_free);
+    Instrumentation::count(Instrumentation::Class::MAIN_COURSE, Instrumentation::Event::CONSTRUCTION);
+}
+
+// Allocator-extended copy and move constructors
+MainCourse::MainCourse(const MainCourse& other, const allocator_type& allocator)
+        : Dish(other, allocator), cooking_method_(other.cooking_method_), protein_type_(other.protein_type_, allocator),
+          side_dishes_(other.side_dishes_, allocator) {
+    countCopy(other);
+}
+
+MainCourse::MainCourse(MainCourse&& other, const allocator_type& allocator)
+        : Dish(std::move(other), allocator), cooking_method_(other.cooking_method_), protein_type_(std::move(other.protein_type_), allocator),
+          side_dishes_(std::move(other.side_dishes_), allocator) {
+    Instrumentation::count(Instrumentation::Class::MAIN_COURSE, Instrumentation::Event::MOVE);
+}
+
+#if BISTRO_INSTRUMENTATION
+// Copy and move constructors and assignment, counted
+MainCourse::MainCourse(const MainCourse& other)
+        : Dish(other), cooking_method_(other.cooking_method_), protein_type_(other.protein_type_), side_dishes_(other.side_dishes_) {
+    countCopy(other);
+}
+
+MainCourse::MainCourse(MainCourse&& other) noexcept
+        : Dish(std::move(other)), cooking_method_(other.cooking_method_), protein_type_(std::move(other.protein_type_)),
+          side_dishes_(std::move(other.side_dishes_)) {
+    Instrumentation::count(Instrumentation::Class::MAIN_COURSE, Instrumentation::Event::MOVE);
+}
+
+MainCourse& MainCourse::operator=(const MainCourse& other) {
+    countCopy(other);
+    Dish::operator=(other);
+    cooking_method_ = other.cooking_method_;
+    protein_type_ = other.protein_type_;
+    side_dishes_ = other.side_dishes_;
+    return *this;
+}
+
+MainCourse& MainCourse::operator=(MainCourse&& other) {
+    Instrumentation::count(Instrumentation::Class::MAIN_COURSE, Instrumentation::Event::MOVE);
+    Dish::operator=(std::move(other));
+    cooking_method_ = other.cooking_method_;
+    protein_type_ = std::move(other.protein_type_);
+    side_dishes_ = std::move(other.side_dishes_);
+    return *this;
+}
+#endif
+
 // Accessor functions
 
 /**
  * @return The cooking method of the main course (as an enum).
  */
 MainCourse::CookingMethod MainCourse::getCookingMethod() const {
-    return cooking_method_;
+    return static_cast<CookingMethod>(cooking_method_);
 }
 
 /**
  * @return The type of protein in the main course.
  */
 std::string MainCourse::getProteinType() const {
+    Instrumentation::accessorCall(Instrumentation::Accessor::GET_PROTEIN_TYPE, Instrumentation::stringBlocks(protein_type_.size()),
+                                  Instrumentation::stringBlocks(protein_type_.size()) * (protein_type_.size() + 1));
+    return std::string(protein_type_);
+}
+
+/**
+ * @return A view of the type of protein, valid until it is changed or
+the main course is destroyed.
+ */
+std::string_view MainCourse::getProteinTypeView() const {
     return protein_type_;
 }
 
@@ -58,7 +146,7 @@ std::string MainCourse::getProteinType() const {
  */
 
 bool MainCourse::isGlutenFree() const {
-    return gluten_free_;
+    return (getDietaryAttributes() & GLUTEN_FREE) != 0;
 }
 
 /**
@@ -66,6 +154,25 @@ bool MainCourse::isGlutenFree() const {
 served with the main course.
  */
 std::vector<MainCourse::SideDish> MainCourse::getSideDishes() const {
+    if constexpr (Instrumentation::kEnabled) {
+        std::uint64_t blocks = side_dishes_.empty() ? 0 : 1;
+        std::uint64_t bytes = side_dishes_.size() * sizeof(SideDish);
+        for (const SideDish& side_dish : side_dishes_) {
+            if (!side_dish.name.isInline()) {
+                ++blocks;
+                bytes += side_dish.name.size() + 1;
+            }
+        }
+        Instrumentation::accessorCall(Instrumentation::Accessor::GET_SIDE_DISHES, blocks, bytes);
+    }
+    return std::vector<SideDish>(side_dishes_.begin(), side_dishes_.end());
+}
+
+/**
+ * @return A view of the side dishes, valid until they are changed or
+the main course is destroyed.
+ */
+Span<const MainCourse::SideDish> MainCourse::getSideDishesView() const {
     return side_dishes_;
 }
 
@@ -75,10 +182,12 @@ std::vector<MainCourse::SideDish> MainCourse::getSideDishes() const {
  * Sets the cooking method of the main course.
  * @param cooking_method The new cooking method.
  * @post Sets the private member `cooking_method_` to the value of the
-parameter.
+parameter; a value outside the enum is stored as GRILLED.
  */
 void MainCourse::setCookingMethod(const CookingMethod& cooking_method) {
-    cooking_method_ = cooking_method;
+    notifyChanging(DishField::COOKING_METHOD);
+    cooking_method_ = toEnumBits(cooking_method, RAW, GRILLED);
+    notifyChanged(DishField::COOKING_METHOD);
 }
 
 /**
@@ -87,27 +196,61 @@ void MainCourse::setCookingMethod(const CookingMethod& cooking_method) {
  * @post Sets the private member `protein_type_` to the value of the
 parameter.
  */
-void MainCourse::setProteinType(const std::string& protein_type) {
+void MainCourse::setProteinType(std::string_view protein_type) {
+    notifyChanging(DishField::PROTEIN_TYPE);
     protein_type_ = protein_type;
+    notifyChanged(DishField::PROTEIN_TYPE);
 }
 
 /**
  * Sets the gluten-free flag of the main course.
  * @param gluten_free A boolean indicating if the main course is gluten-
 free.
- * @post Sets the private member `gluten_free_` to the value of the
+ * @post Records GLUTEN_FREE in the dish's dietary attributes with the value of the
 parameter.
  */
 void MainCourse::setGlutenFree(const bool& gluten_free) {
-    gluten_free_ = gluten_free;
+    notifyChanging(DishField::GLUTEN_FREE);
+    setDietaryAttribute(GLUTEN_FREE, gluten_free);
+    notifyChanged(DishField::GLUTEN_FREE);
 }
 
 /**
  * Adds a side dish to the main course.
  * @param side_dish A SideDish struct containing the name and category
-of the side dish.
+of the side dish, moved into place if it uses the same allocator.
 * @post Adds the side dish to the `side_dishes_` vector.
 */
-void MainCourse::addSideDish(const SideDish& side_dish) {
-    side_dishes_.push_back(side_dish);
+void MainCourse::addSideDish(SideDish side_dish) {
+    notifyChanging(DishField::SIDE_DISHES);
+    side_dishes_.push_back(std::move(side_dish));
+    notifyChanged(DishField::SIDE_DISHES);
+}
+
+/**
+ * Replaces the side dishes of the main course.
+ * @param side_dishes The new side dishes, copied into the main course's allocator.
+ * @post Sets the private member `side_dishes_` to the value of the
+parameter.
+ */
+void MainCourse::setSideDishes(Span<const SideDish> side_dishes) {
+    notifyChanging(DishField::SIDE_DISHES);
+    side_dishes_.assign(side_dishes.begin(), side_dishes.end());
+    notifyChanged(DishField::SIDE_DISHES);
+}
+
+// Comparison and hashing
+bool MainCourse::operator==(const MainCourse& other) const {
+    return cooking_method_ == other.cooking_method_ && side_dishes_ == other.side_dishes_ && protein_type_ == other.protein_type_ &&
+           Dish::operator==(other);
+}
+
+std::uint64_t MainCourse::hash() const {
+    // The leading 2 tags the class (1 for Appetizer, 3 for Dessert); side dishes are hashed in order
+    std::uint64_t hash = hashCombine(Dish::hash(), 2u | static_cast<unsigned>(cooking_method_) << 8);
+    hash = hashCombine(hash, stableHash(protein_type_));
+    for (const SideDish& side_dish : side_dishes_) {
+        hash = hashCombine(hash, stableHash(side_dish.name) ^ static_cast<std::uint64_t>(side_dish.category));
+    }
+    return hashCombine(hash, side_dishes_.size());
 }
@@ -5,6 +5,11 @@
  * The MainCourse class includes attributes such as cooking method, protein type, side dishes
  * and if gluten free.
  * It provides constructors, accessor and mutator functions, and inherits the Dish class properties.
+ * The protein type and side dishes come from the same allocator as the rest of the dish. Names up to
+ * SmallString::kInlineCapacity characters are stored inline without allocating; the side dish list is one
+ * allocation, which keeps the record small for the scans over the menu.
+ * The cooking method is a bit-field in the tail padding of Dish. Equality and the hash cover the protein type and
+ * the side dishes, in order.
  *
  * @date 09/20/2024
  * @author Mitchell Lipyansky
@@ -14,21 +19,42 @@
 #define MAIN_COURSE_HPP
 
 #include "Dish.hpp"
+#include "Instrumentation.hpp"
+#include "SmallString.hpp"
+#include <memory_resource>
 #include <vector>
 #include <string>
+#include <string_view>
 
 class MainCourse : public Dish {
 public:
     // Enum for CookingMethod
     enum CookingMethod { GRILLED, BAKED, FRIED, STEAMED, RAW };
 
+    // Upper bound on sizeof(MainCourse) (64-bit libstdc++)
+    static constexpr std::size_t kSizeBudget = 184;
+
     // Enum for SideDish Category
     enum Category { GRAIN, PASTA, LEGUME, BREAD, SALAD, SOUP, STARCHES, VEGETABLE };
 
-    // Struct for SideDish
+    // Struct for SideDish; allocator-aware so that a side dish inside a main course shares its allocator. Names up
+    // to SmallString::kInlineCapacity characters are stored inline.
     struct SideDish {
-        std::string name;
+        using allocator_type = Dish::allocator_type;
+
+        SmallString name;
         Category category;
+
+        SideDish(std::string_view name, Category category, const allocator_type& allocator = {}) : name(name, allocator), category(category) {}
+        SideDish(const SideDish& other) = default;
+        SideDish(SideDish&& other) noexcept = default;
+        SideDish(const SideDish& other, const allocator_type& allocator) : name(other.name, allocator), category(other.category) {}
+        SideDish(SideDish&& other, const allocator_type& allocator) : name(std::move(other.name), allocator), category(other.category) {}
+        SideDish& operator=(const SideDish& other) = default;
+        SideDish& operator=(SideDish&& other) = default;
+
+        bool operator==(const SideDish& other) const { return category == other.category && name == other.name; }
+        bool operator!=(const SideDish& other) const { return !(*this == other); }
     };
 
     // Constructors
@@ -39,6 +65,12 @@ public:
     */
     MainCourse();
 
+    /**
+    * Default constructor with an allocator.
+    * @param allocator The allocator for the name, ingredients, protein type and side dishes.
+    */
+    explicit MainCourse(const allocator_type& allocator);
+
     /**
    * Parameterized constructor.
    * @param name The name of the main course.
@@ -53,9 +85,29 @@ public:
     course.
    * @param gluten_free Boolean flag indicating if the main course is
     gluten-free.
+   * @param allocator The allocator for the name, ingredients, protein type and side dishes (default is the
+    default memory resource).
    */
-    MainCourse(const std::string& name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type,
-               CookingMethod cooking_method, const std::string& protein_type, const std::vector<SideDish>& side_dishes, bool gluten_free);
+    MainCourse(std::string_view name, const std::vector<std::string>& ingredients, int prep_time, double price, CuisineType cuisine_type,
+               CookingMethod cooking_method, std::string_view protein_type, const std::vector<SideDish>& side_dishes, bool gluten_free,
+               const allocator_type& allocator = {});
+
+    /**
+    * Copy and move constructors that place the copy in the given allocator (used by std::pmr containers).
+    */
+    MainCourse(const MainCourse& other, const allocator_type& allocator);
+    MainCourse(MainCourse&& other, const allocator_type& allocator);
+
+#if BISTRO_INSTRUMENTATION
+    /**
+    * Copy and move constructors and assignment, declared so that Instrumentation counts them; without
+    * instrumentation the implicit ones are used.
+    */
+    MainCourse(const MainCourse& other);
+    MainCourse(MainCourse&& other) noexcept;
+    MainCourse& operator=(const MainCourse& other);
+    MainCourse& operator=(MainCourse&& other);
+#endif
 
     // Accessors
     /**
@@ -68,6 +120,12 @@ public:
     */
     std::string getProteinType() const;
 
+    /**
+    * @return A view of the type of protein, valid until it is changed or
+    the main course is destroyed.
+    */
+    std::string_view getProteinTypeView() const;
+
     /**
     * @return True if the main course is gluten-free, false otherwise.
     */
@@ -79,12 +137,18 @@ public:
     */
     std::vector<SideDish> getSideDishes() const;
 
+    /**
+    * @return A view of the side dishes, valid until they are changed or
+    the main course is destroyed.
+    */
+    Span<const SideDish> getSideDishesView() const;
+
     // Mutators
     /**
     * Sets the cooking method of the main course.
     * @param cooking_method The new cooking method.
     * @post Sets the private member `cooking_method_` to the value of the
-    parameter.
+    parameter; a value outside the enum is stored as GRILLED.
     */
     void setCookingMethod(const CookingMethod& cooking_method);
 
@@ -94,13 +158,13 @@ public:
     * @post Sets the private member `protein_type_` to the value of the
     parameter.
     */
-    void setProteinType(const std::string& protein_type);
+    void setProteinType(std::string_view protein_type);
 
     /**
     * Sets the gluten-free flag of the main course.
     * @param gluten_free A boolean indicating if the main course is gluten-
     free.
-    * @post Sets the private member `gluten_free_` to the value of the
+    * @post Records GLUTEN_FREE in the dish's dietary attributes with the value of the
     parameter.
     */
     void setGlutenFree(const bool& gluten_free);
@@ -108,17 +172,48 @@ public:
     /**
     * Adds a side dish to the main course.
     * @param side_dish A SideDish struct containing the name and category
-    of the side dish.
+    of the side dish, moved into place if it uses the same allocator.
     * @post Adds the side dish to the `side_dishes_` vector.
     */
-    void addSideDish(const SideDish& side_dish);
+    void addSideDish(SideDish side_dish);
+
+    /**
+    * Replaces the side dishes of the main course.
+    * @param side_dishes The new side dishes, copied into the main course's allocator.
+    * @post Sets the private member `side_dishes_` to the value of the
+    parameter.
+    */
+    void setSideDishes(Span<const SideDish> side_dishes);
+
+    // Comparison and hashing
+    /**
+    * Compares every field of two main courses, including the dish parts (see Dish::operator==).
+    * @param other The main course to compare with.
+    * @return True if every compared field is equal.
+    */
+    bool operator==(const MainCourse& other) const;
+    bool operator!=(const MainCourse& other) const { return !(*this == other); }
+
+    /**
+    * @return The stable 64-bit hash of the fields compared by operator==; it differs from Dish::hash() of the same
+    dish, so main courses and other dishes with equal dish parts rarely collide.
+    */
+    std::uint64_t hash() const;
 
 private:
-    CookingMethod cooking_method_;
-    std::string protein_type_;
-    std::vector<SideDish> side_dishes_;
-    bool gluten_free_;
+    std::uint8_t cooking_method_ : 3;  // a CookingMethod
+    SmallString protein_type_;
+    std::pmr::vector<SideDish> side_dishes_;  // out of line: inline side dishes would cost 56 bytes each in every main course
+};
+
+static_assert(sizeof(MainCourse) <= MainCourse::kSizeBudget, "MainCourse exceeds its size budget; pack the new field or raise kSizeBudget");
+
+namespace std {
+template <>
+struct hash<MainCourse> {
+    std::size_t operator()(const MainCourse& dish) const { return static_cast<std::size_t>(dish.hash()); }
 };
+} // namespace std
 
 #endif // MAIN_COURSE_HPP
 
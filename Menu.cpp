@@ -0,0 +1,95 @@
+/**
+ * @file Menu.cpp
+ * @brief This file contains the implementation of the Menu class, a mixed collection of appetizers, main courses
+ * and desserts stored by value.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "Menu.hpp"
+#include <iostream>
+#include <stdexcept>
+
+// Default Constructor
+Menu::Menu(const Dish::allocator_type& allocator)
+        : appetizers_(allocator), main_courses_(allocator), desserts_(allocator), order_(allocator), observers_(new ObserverList()),
+          stats_(new MenuStats()) {
+    observers_->add(stats_.get());
+}
+
+// Accessor Functions
+std::size_t Menu::count(Kind kind) const {
+    switch (kind) {
+        case Kind::APPETIZER: return appetizers_.size();
+        case Kind::MAIN_COURSE: return main_courses_.size();
+        default: return desserts_.size();
+    }
+}
+
+const Dish& Menu::operator[](std::size_t position) const {
+    return visit(position, [](const Dish& dish) -> const Dish& { return dish; });
+}
+
+MenuItem Menu::item(std::size_t position) const {
+    return visit(position, [](const auto& dish) { return MenuItem(dish); });
+}
+
+// Output Functions
+void Menu::render(const MenuRenderer& renderer, std::string& out) const {
+    forEach([&](const auto& dish) { renderer.render(dish, out); });
+}
+
+void Menu::display() const {
+    std::string buffer;
+    render(MenuRenderer(), buffer);
+    std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+// Mutator Functions
+std::size_t Menu::add(Appetizer appetizer) {
+    appetizers_.push_back(std::move(appetizer));
+    return registerLast(Kind::APPETIZER, appetizers_.size() - 1, appetizers_.back());
+}
+
+std::size_t Menu::add(MainCourse main_course) {
+    main_courses_.push_back(std::move(main_course));
+    return registerLast(Kind::MAIN_COURSE, main_courses_.size() - 1, main_courses_.back());
+}
+
+std::size_t Menu::add(Dessert dessert) {
+    desserts_.push_back(std::move(dessert));
+    return registerLast(Kind::DESSERT, desserts_.size() - 1, desserts_.back());
+}
+
+std::size_t Menu::add(MenuItem item) {
+    return std::visit([this](auto& dish) { return add(std::move(dish)); }, item);
+}
+
+void Menu::reserve(std::size_t appetizers, std::size_t main_courses, std::size_t desserts) {
+    appetizers_.reserve(appetizers);
+    main_courses_.reserve(main_courses);
+    desserts_.reserve(desserts);
+    order_.reserve(appetizers + main_courses + desserts);
+}
+
+void Menu::clear() {
+    appetizers_.clear();
+    main_courses_.clear();
+    desserts_.clear();
+    order_.clear();
+    observers_->dishesCleared();  // includes stats_
+}
+
+// Helper function to record the menu position of a newly added dish
+std::size_t Menu::registerLast(Kind kind, std::size_t index, Dish& dish) {
+    const std::size_t position = order_.size();
+    if (position >= kNoDishId) {
+        throw std::length_error("Menu: too many dishes for a DishId");
+    }
+    order_.push_back({static_cast<std::uint32_t>(index), kind});
+    dish.setId(static_cast<DishId>(position));
+    dish.setObserver(observers_.get());
+    stats_->add(dish);
+    return position;
+}
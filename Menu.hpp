@@ -0,0 +1,279 @@
+/**
+ * @file Menu.hpp
+ * @brief This file contains the declaration of the Menu class, a mixed collection of appetizers, main courses and
+ * desserts stored by value.
+ *
+ * Each kind of dish lives in its own contiguous vector, and a compact order index of (kind, slot) entries records
+ * the menu order. Algorithms over the whole menu dispatch on the kind with a switch (visit(), forEach(), filter(),
+ * accumulate()), so the concrete type and its own fields are reachable without virtual functions or a heap
+ * allocation per dish; tight loops over one kind use appetizers(), mainCourses() and desserts() directly.
+ *
+ * Every dish added to a menu gets its menu position as its DishId and the menu's ObserverList as its observer, so
+ * indexes registered with addObserver() follow changes made through the menu. The menu itself keeps MenuStats
+ * that way, so aggregates such as the total price are O(1) queries. Dishes are never removed one at a time, which
+ * keeps positions and IDs stable; clear() removes them all and tells the observers with dishesCleared(), since the
+ * IDs then start over from 0. The vectors use the menu's allocator, so a menu can live in a MenuArena.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef MENU_HPP
+#define MENU_HPP
+
+#include "Appetizer.hpp"
+#include "Dessert.hpp"
+#include "Dish.hpp"
+#include "DishObserver.hpp"
+#include "MainCourse.hpp"
+#include "MenuRenderer.hpp"
+#include "MenuStats.hpp"
+#include "Span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// A single menu item of any kind, held by value
+using MenuItem = std::variant<Appetizer, MainCourse, Dessert>;
+
+class Menu {
+public:
+    // The kind of a menu item; the values match the MenuItem alternatives
+    enum class Kind : std::uint8_t { APPETIZER, MAIN_COURSE, DESSERT };
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty menu.
+     * @param allocator The allocator for the dishes and the order index (default is the default memory resource).
+     */
+    explicit Menu(const Dish::allocator_type& allocator = {});
+
+    Menu(const Menu&) = delete;
+    Menu& operator=(const Menu&) = delete;
+    Menu(Menu&&) = default;
+    Menu& operator=(Menu&&) = default;
+
+    // Accessors
+    /**
+     * @return The number of dishes on the menu.
+     */
+    std::size_t size() const { return order_.size(); }
+
+    /**
+     * @return True if the menu has no dishes.
+     */
+    bool empty() const { return order_.empty(); }
+
+    /**
+     * @return The number of dishes of one kind.
+     */
+    std::size_t count(Kind kind) const;
+
+    /**
+     * @return The running statistics of the dishes on the menu, kept up to date by add() and the dish setters.
+     */
+    const MenuStats& stats() const { return *stats_; }
+
+    /**
+     * Recomputes the statistics with a full scan and compares them with the running ones.
+     * @return True if they match (see MenuStats::matches).
+     */
+    bool verifyStats() const { return stats_->matches(MenuStats::compute(*this)); }
+
+    /**
+     * @param position A menu position (which is also the dish's DishId).
+     * @return The kind of the dish at that position.
+     */
+    Kind kindAt(std::size_t position) const { return order_[position].kind; }
+
+    /**
+     * @param position A menu position.
+     * @return The common Dish part of the dish at that position.
+     */
+    const Dish& operator[](std::size_t position) const;
+
+    /**
+     * @param position A menu position.
+     * @return A copy of the dish at that position.
+     */
+    MenuItem item(std::size_t position) const;
+
+    /**
+     * @return Read-only contiguous views of the dishes of one kind, in the order they were added. Dishes are changed
+     * through visit() and the setters, which the observers follow; assigning to a dish would bypass them.
+     */
+    Span<const Appetizer> appetizers() const { return appetizers_; }
+    Span<const MainCourse> mainCourses() const { return main_courses_; }
+    Span<const Dessert> desserts() const { return desserts_; }
+
+    // Visitation
+    /**
+     * Calls visitor with the dish at a position as its concrete type (const Appetizer&, const MainCourse& or
+     * const Dessert&). The non-const overload passes mutable references; changes are reported to the observers.
+     * @return What the visitor returns.
+     */
+    template <typename Visitor>
+    decltype(auto) visit(std::size_t position, Visitor&& visitor) const {
+        return visitAt(*this, position, std::forward<Visitor>(visitor));
+    }
+
+    template <typename Visitor>
+    decltype(auto) visit(std::size_t position, Visitor&& visitor) {
+        return visitAt(*this, position, std::forward<Visitor>(visitor));
+    }
+
+    /**
+     * Calls visitor with every dish as its concrete type, in menu order.
+     */
+    template <typename Visitor>
+    void forEach(Visitor&& visitor) const {
+        for (std::size_t position = 0; position < order_.size(); ++position) {
+            visitAt(*this, position, visitor);
+        }
+    }
+
+    /**
+     * @param predicate Called with each dish as its concrete type; returns true to keep the dish.
+     * @return The positions of the dishes kept, in menu order.
+     */
+    template <typename Predicate>
+    std::vector<std::size_t> filter(Predicate&& predicate) const {
+        std::vector<std::size_t> positions;
+        for (std::size_t position = 0; position < order_.size(); ++position) {
+            if (visitAt(*this, position, predicate)) {
+                positions.push_back(position);
+            }
+        }
+        return positions;
+    }
+
+    /**
+     * Folds the menu in menu order: value = combine(value, dish) for every dish as its concrete type.
+     * @return The final value.
+     */
+    template <typename T, typename Combine>
+    T accumulate(T value, Combine&& combine) const {
+        for (std::size_t position = 0; position < order_.size(); ++position) {
+            value = visitAt(*this, position, [&](const auto& dish) { return combine(std::move(value), dish); });
+        }
+        return value;
+    }
+
+    // Output
+    /**
+     * Appends every dish, in menu order, to a buffer.
+     * @param renderer The renderer that selects the format.
+     * @param out The buffer to append to.
+     */
+    void render(const MenuRenderer& renderer, std::string& out) const;
+
+    /**
+     * Prints every dish in menu order with a single write to std::cout.
+     */
+    void display() const;
+
+    // Mutators
+    /**
+     * Adds a dish at the end of the menu. The dish is moved into the menu's storage and gets its position as ID
+     * and the menu's observer list as observer.
+     * @return The position of the new dish.
+     */
+    std::size_t add(Appetizer appetizer);
+    std::size_t add(MainCourse main_course);
+    std::size_t add(Dessert dessert);
+    std::size_t add(MenuItem item);
+
+    /**
+     * Constructs a dish of type T in place at the end of the menu, passing the menu's allocator last.
+     * @return The position of the new dish.
+     */
+    template <typename T, typename... Args>
+    std::size_t emplace(Args&&... args) {
+        auto& dishes = dishesOf<T>(*this);
+        dishes.emplace_back(std::forward<Args>(args)...);
+        return registerLast(kindOf<T>(), dishes.size() - 1, dishes.back());
+    }
+
+    /**
+     * Reserves room for the given numbers of dishes of each kind.
+     */
+    void reserve(std::size_t appetizers, std::size_t main_courses, std::size_t desserts);
+
+    /**
+     * Removes every dish and notifies the observers (DishObserver::dishesCleared()), so that indexes follow.
+     */
+    void clear();
+
+    // Observers
+    /**
+     * Registers an observer for changes to any dish on the menu.
+     * @param observer The observer; it must outlive its registration.
+     */
+    void addObserver(DishObserver* observer) { observers_->add(observer); }
+
+    /**
+     * Unregisters an observer.
+     * @param observer The observer to remove.
+     */
+    void removeObserver(DishObserver* observer) { observers_->remove(observer); }
+
+private:
+    // One menu position: the kind of the dish and its slot in that kind's vector
+    struct Entry {
+        std::uint32_t index;
+        Kind kind;
+    };
+
+    std::pmr::vector<Appetizer> appetizers_;
+    std::pmr::vector<MainCourse> main_courses_;
+    std::pmr::vector<Dessert> desserts_;
+    std::pmr::vector<Entry> order_;
+    std::unique_ptr<ObserverList> observers_;  // heap-allocated so that dishes keep a valid observer when the menu moves
+    std::unique_ptr<MenuStats> stats_;         // registered with observers_, so heap-allocated for the same reason
+
+    // Helper function: dispatch on the kind of one entry, for both const and non-const menus
+    template <typename Self, typename Visitor>
+    static decltype(auto) visitAt(Self& self, std::size_t position, Visitor&& visitor) {
+        const Entry entry = self.order_[position];
+        switch (entry.kind) {
+            case Kind::APPETIZER: return visitor(self.appetizers_[entry.index]);
+            case Kind::MAIN_COURSE: return visitor(self.main_courses_[entry.index]);
+            default: return visitor(self.desserts_[entry.index]);
+        }
+    }
+
+    template <typename T>
+    static constexpr Kind kindOf() {
+        if constexpr (std::is_same_v<T, Appetizer>) {
+            return Kind::APPETIZER;
+        } else if constexpr (std::is_same_v<T, MainCourse>) {
+            return Kind::MAIN_COURSE;
+        } else {
+            static_assert(std::is_same_v<T, Dessert>, "Menu holds Appetizer, MainCourse and Dessert");
+            return Kind::DESSERT;
+        }
+    }
+
+    template <typename T>
+    static std::pmr::vector<T>& dishesOf(Menu& menu) {
+        if constexpr (kindOf<T>() == Kind::APPETIZER) {
+            return menu.appetizers_;
+        } else if constexpr (kindOf<T>() == Kind::MAIN_COURSE) {
+            return menu.main_courses_;
+        } else {
+            return menu.desserts_;
+        }
+    }
+
+    // Helper function: append an order entry for the last dish of a kind and attach the ID and observer
+    std::size_t registerLast(Kind kind, std::size_t index, Dish& dish);
+};
+
+#endif // MENU_HPP
@@ -0,0 +1,245 @@
+/**
+ * @file MenuAnalytics.cpp
+ * @brief This file contains the implementation of the MenuAnalytics class, which computes price and preparation
+ * time statistics of a menu, overall and grouped by cuisine and by the subclass enums.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "MenuAnalytics.hpp"
+#include "QuantileSketch.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// Dishes per parallel task
+constexpr std::size_t kBlock = std::size_t(1) << 16;
+
+constexpr std::size_t kCuisines = EnumTraits<Dish::CuisineType>::names.size();
+constexpr std::size_t kServingStyles = EnumTraits<Appetizer::ServingStyle>::names.size();
+constexpr std::size_t kCookingMethods = EnumTraits<MainCourse::CookingMethod>::names.size();
+constexpr std::size_t kFlavorProfiles = EnumTraits<Dessert::FlavorProfile>::names.size();
+
+// Groups in a flat array: the cuisines, then the subclass enums. The overall group is the merge of the cuisines.
+constexpr std::size_t kServingBase = kCuisines;
+constexpr std::size_t kCookingBase = kServingBase + kServingStyles;
+constexpr std::size_t kFlavorBase = kCookingBase + kCookingMethods;
+constexpr std::size_t kGroups = kFlavorBase + kFlavorProfiles;
+
+// The partial statistics of one measure over one group
+struct Accumulator {
+    std::size_t count = 0;
+    double sum = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    QuantileSketch sketch;
+    std::vector<double> values;  // only for exact quantiles
+
+    explicit Accumulator(double relative_error) : sketch(relative_error) {}
+
+    void add(double value, bool exact) {
+        min = count == 0 ? value : std::min(min, value);
+        max = count == 0 ? value : std::max(max, value);
+        ++count;
+        sum += value;
+        if (exact) {
+            values.push_back(value);
+        } else {
+            sketch.add(value);
+        }
+    }
+
+    void merge(const Accumulator& other) {
+        if (other.count == 0) {
+            return;
+        }
+        min = count == 0 ? other.min : std::min(min, other.min);
+        max = count == 0 ? other.max : std::max(max, other.max);
+        count += other.count;
+        sum += other.sum;
+        sketch.merge(other.sketch);
+        values.insert(values.end(), other.values.begin(), other.values.end());
+    }
+
+    MenuAnalytics::Summary summarize(bool exact) {
+        MenuAnalytics::Summary summary;
+        if (count == 0) {
+            return summary;
+        }
+        summary.count = count;
+        summary.mean = sum / static_cast<double>(count);
+        summary.min = min;
+        summary.max = max;
+        summary.median = exact ? percentile(0.50) : sketch.quantile(0.50);
+        summary.p95 = exact ? percentile(0.95) : sketch.quantile(0.95);
+        return summary;
+    }
+
+    // Nearest-rank percentile of the values, as in KitchenScheduler; reorders the values
+    double percentile(double fraction) {
+        const auto rank = static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1) + 0.5);
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(rank), values.end());
+        return values[rank];
+    }
+};
+
+// The price and prep time accumulators of every group
+struct Partial {
+    std::vector<Accumulator> price;
+    std::vector<Accumulator> prep_time;
+
+    explicit Partial(double relative_error)
+            : price(kGroups, Accumulator(relative_error)), prep_time(kGroups, Accumulator(relative_error)) {}
+
+    void merge(const Partial& other) {
+        for (std::size_t group = 0; group < kGroups; ++group) {
+            price[group].merge(other.price[group]);
+            prep_time[group].merge(other.prep_time[group]);
+        }
+    }
+};
+
+// Adds dishes[begin, end) to a partial; subgroup maps a dish to its subclass group, or kGroups for none
+template <typename T, typename Subgroup>
+void reduce(Span<const T> dishes, std::size_t begin, std::size_t end, Subgroup subgroup, bool exact, Partial& partial) {
+    for (std::size_t i = begin; i < end; ++i) {
+        const T& dish = dishes[i];
+        const auto price = dish.getPrice();
+        const auto prep_time = static_cast<double>(dish.getPrepTime());
+        auto cuisine = static_cast<std::size_t>(dish.getCuisine());
+        if (cuisine >= kCuisines) {
+            cuisine = static_cast<std::size_t>(Dish::CuisineType::OTHER);
+        }
+        partial.price[cuisine].add(price, exact);
+        partial.prep_time[cuisine].add(prep_time, exact);
+        const std::size_t group = subgroup(dish);
+        if (group < kGroups) {
+            partial.price[group].add(price, exact);
+            partial.prep_time[group].add(prep_time, exact);
+        }
+    }
+}
+
+// The flat group of a subclass enum value, or kGroups if the value is out of range
+std::size_t groupOf(std::size_t base, std::size_t count, int value) {
+    return value >= 0 && static_cast<std::size_t>(value) < count ? base + static_cast<std::size_t>(value) : kGroups;
+}
+
+void appendSummary(std::string& out, std::string_view group, std::string_view measure, const MenuAnalytics::Summary& summary) {
+    char line[160];
+    const int length = std::snprintf(line, sizeof(line), "%-24.*s %-9.*s %10zu %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+                                     static_cast<int>(group.size()), group.data(), static_cast<int>(measure.size()),
+                                     measure.data(), summary.count, summary.mean, summary.min, summary.median,
+                                     summary.p95, summary.max);
+    out.append(line, static_cast<std::size_t>(std::min<int>(length, sizeof(line) - 1)));
+}
+
+void appendGroup(std::string& out, std::string_view group, const MenuAnalytics::GroupStats& stats) {
+    if (stats.price.count == 0) {
+        return;
+    }
+    appendSummary(out, group, "price", stats.price);
+    appendSummary(out, group, "prep_time", stats.prep_time);
+}
+
+template <typename Enum, std::size_t N>
+void appendGroups(std::string& out, std::string_view prefix, const std::array<MenuAnalytics::GroupStats, N>& groups) {
+    for (std::size_t value = 0; value < N; ++value) {
+        appendGroup(out, std::string(prefix).append(EnumTraits<Enum>::names[value]), groups[value]);
+    }
+}
+
+} // namespace
+
+// Report
+
+void MenuAnalytics::Report::render(std::string& out) const {
+    char header[160];
+    const int length = std::snprintf(header, sizeof(header), "%-24s %-9s %10s %10s %10s %10s %10s %10s\n", "group",
+                                     "measure", "count", "mean", "min", "median", "p95", "max");
+    out.append(header, static_cast<std::size_t>(length));
+    appendGroup(out, "overall", overall);
+    appendGroups<Dish::CuisineType>(out, "cuisine ", by_cuisine);
+    appendGroups<Appetizer::ServingStyle>(out, "serving ", by_serving_style);
+    appendGroups<MainCourse::CookingMethod>(out, "cooking ", by_cooking_method);
+    appendGroups<Dessert::FlavorProfile>(out, "flavor ", by_flavor_profile);
+}
+
+// Parameterized Constructor
+MenuAnalytics::MenuAnalytics(std::size_t threads, double relative_error)
+        : pool_(new ThreadPool(threads)), relative_error_(relative_error) {
+    if (!(relative_error > 0.0 && relative_error < 1.0)) {
+        throw std::invalid_argument("MenuAnalytics: relative error must be in (0, 1)");
+    }
+}
+
+// Analysis
+
+MenuAnalytics::Report MenuAnalytics::analyze(const Menu& menu, Quantiles quantiles) const {
+    const bool exact = quantiles == Quantiles::EXACT;
+
+    // One task per block of each kind
+    struct Task {
+        Menu::Kind kind;
+        std::size_t begin;
+        std::size_t end;
+    };
+    std::vector<Task> tasks;
+    for (Menu::Kind kind : {Menu::Kind::APPETIZER, Menu::Kind::MAIN_COURSE, Menu::Kind::DESSERT}) {
+        const std::size_t count = menu.count(kind);
+        for (std::size_t begin = 0; begin < count; begin += kBlock) {
+            tasks.push_back({kind, begin, std::min(begin + kBlock, count)});
+        }
+    }
+
+    std::vector<Partial> partials(tasks.size(), Partial(relative_error_));
+    pool_->parallelFor(tasks.size(), [&](std::size_t t) {
+        const Task& task = tasks[t];
+        switch (task.kind) {
+            case Menu::Kind::APPETIZER:
+                reduce(menu.appetizers(), task.begin, task.end, [](const Appetizer& dish) {
+                    return groupOf(kServingBase, kServingStyles, dish.getServingStyle());
+                }, exact, partials[t]);
+                break;
+            case Menu::Kind::MAIN_COURSE:
+                reduce(menu.mainCourses(), task.begin, task.end, [](const MainCourse& dish) {
+                    return groupOf(kCookingBase, kCookingMethods, dish.getCookingMethod());
+                }, exact, partials[t]);
+                break;
+            case Menu::Kind::DESSERT:
+                reduce(menu.desserts(), task.begin, task.end, [](const Dessert& dish) {
+                    return groupOf(kFlavorBase, kFlavorProfiles, dish.getFlavorProfile());
+                }, exact, partials[t]);
+                break;
+        }
+    });
+
+    Partial total(relative_error_);
+    for (const Partial& partial : partials) {
+        total.merge(partial);
+    }
+    Accumulator overall_price(relative_error_);
+    Accumulator overall_prep_time(relative_error_);
+    for (std::size_t cuisine = 0; cuisine < kCuisines; ++cuisine) {
+        overall_price.merge(total.price[cuisine]);
+        overall_prep_time.merge(total.prep_time[cuisine]);
+    }
+
+    Report report;
+    report.overall = {overall_price.summarize(exact), overall_prep_time.summarize(exact)};
+    auto fill = [&](auto& groups, std::size_t base) {
+        for (std::size_t value = 0; value < groups.size(); ++value) {
+            groups[value] = {total.price[base + value].summarize(exact), total.prep_time[base + value].summarize(exact)};
+        }
+    };
+    fill(report.by_cuisine, 0);
+    fill(report.by_serving_style, kServingBase);
+    fill(report.by_cooking_method, kCookingBase);
+    fill(report.by_flavor_profile, kFlavorBase);
+    return report;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file MenuAnalytics.hpp
+ * @brief This file contains the declaration of the MenuAnalytics class, which computes price and preparation time
+ * statistics of a menu, overall and grouped by cuisine and by the subclass enums.
+ *
+ * The dishes of each kind are split into fixed-size blocks that a ThreadPool reduces in parallel, reading the raw
+ * enum and numeric accessors only. Each block produces per-group partial results (count, sum, min, max, and a
+ * QuantileSketch or the values themselves), which are merged in block order, so a report does not depend on the
+ * number of threads. With Quantiles::SKETCH the median and p95 are estimates within the sketch's relative error
+ * and the memory is independent of the menu size; Quantiles::EXACT keeps every value and selects the exact nearest
+ * ranks, which suits smaller menus.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef MENU_ANALYTICS_HPP
+#define MENU_ANALYTICS_HPP
+
+#include "EnumNames.hpp"
+#include "Menu.hpp"
+#include "ThreadPool.hpp"
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+class MenuAnalytics {
+public:
+    // How the median and p95 are computed
+    enum class Quantiles { EXACT, SKETCH };
+
+    // Statistics of one measure over one group of dishes; all 0 for an empty group
+    struct Summary {
+        std::size_t count = 0;
+        double mean = 0.0;
+        double min = 0.0;
+        double max = 0.0;
+        double median = 0.0;
+        double p95 = 0.0;
+    };
+
+    // Statistics of one group of dishes
+    struct GroupStats {
+        Summary price;
+        Summary prep_time;
+    };
+
+    // Every group, indexed by enum value; out-of-range cuisines count as OTHER
+    struct Report {
+        GroupStats overall;
+        std::array<GroupStats, EnumTraits<Dish::CuisineType>::names.size()> by_cuisine;
+        std::array<GroupStats, EnumTraits<Appetizer::ServingStyle>::names.size()> by_serving_style;
+        std::array<GroupStats, EnumTraits<MainCourse::CookingMethod>::names.size()> by_cooking_method;
+        std::array<GroupStats, EnumTraits<Dessert::FlavorProfile>::names.size()> by_flavor_profile;
+
+        /**
+         * Appends the report as a plain-text table, one row per non-empty group.
+         * @param out The buffer to append to.
+         */
+        void render(std::string& out) const;
+    };
+
+    // Constructors
+    /**
+     * Parameterized constructor.
+     * @param threads The number of worker threads; 0 (the default) uses std::thread::hardware_concurrency().
+     * @param relative_error The relative error of the sketched quantiles (default is 1%).
+     * @throw std::invalid_argument if relative_error is outside (0, 1).
+     */
+    explicit MenuAnalytics(std::size_t threads = 0, double relative_error = 0.01);
+
+    // Analysis
+    /**
+     * Computes the statistics of a menu. The menu must not change during the call.
+     * @param menu The menu.
+     * @param quantiles How to compute the median and p95 (default is SKETCH).
+     * @return The report.
+     */
+    Report analyze(const Menu& menu, Quantiles quantiles = Quantiles::SKETCH) const;
+
+private:
+    std::unique_ptr<ThreadPool> pool_;
+    double relative_error_;
+};
+
+#endif // MENU_ANALYTICS_HPP
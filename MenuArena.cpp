@@ -0,0 +1,42 @@
+/**
+ * @file MenuArena.cpp
+ * @brief This file contains the implementation of the MenuArena class, a memory resource that holds the strings
+ * and lists of one whole menu.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "MenuArena.hpp"
+
+// Parameterized Constructor
+MenuArena::MenuArena(std::size_t initial_bytes, std::pmr::memory_resource* upstream)
+        : blocks_(upstream), buffer_(initial_bytes == 0 ? 1 : initial_bytes, &blocks_), bytes_allocated_(0) {
+}
+
+// Mutator Functions
+void MenuArena::release() {
+    buffer_.release();
+    bytes_allocated_ = 0;
+}
+
+// Memory resource interface: allocation is a pointer bump inside the current block, deallocation does nothing
+void* MenuArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    void* pointer = buffer_.allocate(bytes, alignment);
+    bytes_allocated_ += bytes;
+    return pointer;
+}
+
+void MenuArena::do_deallocate(void*, std::size_t, std::size_t) {
+}
+
+void* MenuArena::BlockSource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    void* pointer = upstream_->allocate(bytes, alignment);
+    bytes_reserved_ += bytes;
+    return pointer;
+}
+
+void MenuArena::BlockSource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+    upstream_->deallocate(pointer, bytes, alignment);
+    bytes_reserved_ -= bytes;
+}
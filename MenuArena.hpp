@@ -0,0 +1,90 @@
+/**
+ * @file MenuArena.hpp
+ * @brief This file contains the declaration of the MenuArena class, a memory resource that holds the strings and
+ * lists of one whole menu.
+ *
+ * A MenuArena hands out memory from a few large blocks and ignores individual frees, so building a menu costs a
+ * handful of upstream allocations and tearing it down costs none until release() or the arena's destructor frees
+ * every block at once. Dishes, and std::pmr containers of dishes, use it through allocator():
+ *
+ *     MenuArena arena;
+ *     std::pmr::vector<MainCourse> mains(arena.allocator());
+ *     mains.emplace_back(name, ingredients, 30, 18.99, cuisine, MainCourse::GRILLED, protein, sides, true);
+ *
+ * Every object allocated from an arena must be destroyed before the arena is released or destroyed. Copies made
+ * with a copy constructor go to the default resource, not the arena. An arena is not thread-safe.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef MENU_ARENA_HPP
+#define MENU_ARENA_HPP
+
+#include "Dish.hpp"
+#include <cstddef>
+#include <memory_resource>
+
+class MenuArena : public std::pmr::memory_resource {
+public:
+    // Constructors
+    /**
+     * Parameterized constructor.
+     * @param initial_bytes The size of the first block; later blocks grow geometrically (default is 64 KiB).
+     * @param upstream The resource the blocks are allocated from (default is operator new).
+     */
+    explicit MenuArena(std::size_t initial_bytes = std::size_t{64} << 10,
+                       std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+    MenuArena(const MenuArena&) = delete;
+    MenuArena& operator=(const MenuArena&) = delete;
+
+    // Accessors
+    /**
+     * @return An allocator for dishes and std::pmr containers that allocate from this arena.
+     */
+    Dish::allocator_type allocator() { return Dish::allocator_type(this); }
+
+    /**
+     * @return The bytes handed out to dishes and containers since construction or the last release().
+     */
+    std::size_t bytesAllocated() const { return bytes_allocated_; }
+
+    /**
+     * @return The bytes currently held in blocks obtained from the upstream resource.
+     */
+    std::size_t bytesReserved() const { return blocks_.bytesReserved(); }
+
+    // Mutators
+    /**
+     * Frees every block at once.
+     * @pre Nothing allocated from the arena is still alive.
+     */
+    void release();
+
+private:
+    // Forwards block allocations to the upstream resource and counts the bytes held
+    class BlockSource : public std::pmr::memory_resource {
+    public:
+        explicit BlockSource(std::pmr::memory_resource* upstream) : upstream_(upstream), bytes_reserved_(0) {}
+        std::size_t bytesReserved() const { return bytes_reserved_; }
+
+    private:
+        std::pmr::memory_resource* upstream_;
+        std::size_t bytes_reserved_;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    BlockSource blocks_;
+    std::pmr::monotonic_buffer_resource buffer_;
+    std::size_t bytes_allocated_;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+#endif // MENU_ARENA_HPP
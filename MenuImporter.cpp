@@ -0,0 +1,719 @@
+/**
+ * @file MenuImporter.cpp
+ * @brief This file contains the implementation of the MenuImporter class, a parallel streaming loader for menus written
+ * as CSV or JSON Lines.
+ *
+ * Each line is first parsed into a RawRow of string views (pointing into the input, or into a per-chunk scratch
+ * area when a value had to be unescaped); the RawRows of a chunk then have their names validated in one batch and
+ * are converted into dish objects.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "MenuImporter.hpp"
+#include "EnumNames.hpp"
+#include "Instrumentation.hpp"
+#include "NameValidator.hpp"
+#include <algorithm>
+#include <charconv>
+#include <deque>
+#include <stdexcept>
+#include <utility>
+#include <fcntl.h>     // For open
+#include <sys/mman.h>  // For mmap, munmap
+#include <sys/stat.h>  // For fstat
+#include <unistd.h>    // For close
+
+namespace {
+
+// Field positions, in CSV column order
+enum Field {
+    KIND, NAME, INGREDIENTS, PREP_TIME, PRICE, CUISINE_TYPE, SERVING_STYLE, SPICINESS_LEVEL, VEGETARIAN,
+    COOKING_METHOD, PROTEIN_TYPE, SIDE_DISHES, GLUTEN_FREE, FLAVOR_PROFILE, SWEETNESS_LEVEL, CONTAINS_NUTS,
+    FIELD_COUNT
+};
+
+constexpr std::string_view kFieldNames[FIELD_COUNT] = {
+    "kind", "name", "ingredients", "prep_time", "price", "cuisine_type", "serving_style", "spiciness_level",
+    "vegetarian", "cooking_method", "protein_type", "side_dishes", "gluten_free", "flavor_profile",
+    "sweetness_level", "contains_nuts"};
+
+// One parsed line, before conversion into a dish
+struct RawRow {
+    std::size_t line = 0;
+    std::string_view fields[FIELD_COUNT];
+    bool present[FIELD_COUNT] = {};
+    std::vector<std::string_view> ingredients;
+    std::vector<std::pair<std::string_view, std::string_view>> side_dishes;  // name, category
+};
+
+// Everything one chunk produces; merged in chunk order afterwards
+struct ChunkResult {
+    MenuImporter::Result result;
+    std::size_t lines = 0;
+};
+
+// Storage for values that had to be unescaped; deque elements never move, so views into them stay valid
+class Scratch {
+public:
+    std::string& fresh() {
+        strings_.emplace_back();
+        return strings_.back();
+    }
+
+private:
+    std::deque<std::string> strings_;
+};
+
+// CSV
+
+// True when the character at pos is preceded by an odd number of backslashes
+bool escapedAt(std::string_view text, std::size_t pos) {
+    std::size_t backslashes = 0;
+    while (backslashes < pos && text[pos - backslashes - 1] == '\\') {
+        ++backslashes;
+    }
+    return backslashes % 2 == 1;
+}
+
+// Removes the next item of a CSV list column, up to the first unescaped ';', and returns it still escaped
+std::string_view takeListItem(std::string_view& list) {
+    std::size_t end = 0;
+    while (end < list.size() && list[end] != ';') {
+        end += list[end] == '\\' && end + 1 < list.size() ? 2 : 1;
+    }
+    const std::string_view item = list.substr(0, end);
+    list.remove_prefix(std::min(end + 1, list.size()));
+    return item;
+}
+
+// Drops the escaping backslashes of a list item; items without any are returned as they are
+std::string_view unescapeListItem(std::string_view item, Scratch& scratch) {
+    if (item.find('\\') == std::string_view::npos) {
+        return item;
+    }
+    std::string& value = scratch.fresh();
+    for (std::size_t i = 0; i < item.size(); ++i) {
+        if (item[i] == '\\' && i + 1 < item.size()) {
+            ++i;
+        }
+        value.push_back(item[i]);
+    }
+    return value;
+}
+
+bool parseCsvLine(std::string_view line, RawRow& row, Scratch& scratch, std::string& error) {
+    std::size_t pos = 0;
+    for (int field = 0; field < FIELD_COUNT; ++field) {
+        if (pos < line.size() && line[pos] == '"') {
+            std::string& value = scratch.fresh();
+            ++pos;
+            for (;;) {
+                if (pos >= line.size()) {
+                    error = "unterminated quoted field '" + std::string(kFieldNames[field]) + "'";
+                    return false;
+                }
+                if (line[pos] == '"') {
+                    if (pos + 1 < line.size() && line[pos + 1] == '"') {
+                        value.push_back('"');
+                        pos += 2;
+                        continue;
+                    }
+                    ++pos;
+                    break;
+                }
+                value.push_back(line[pos++]);
+            }
+            row.fields[field] = value;
+        } else {
+            const std::size_t end = std::min(line.find(',', pos), line.size());
+            row.fields[field] = line.substr(pos, end - pos);
+            pos = end;
+        }
+        row.present[field] = true;  // the row has every column, so an empty one is an empty string, not a missing field
+
+        if (field + 1 < FIELD_COUNT) {
+            if (pos >= line.size() || line[pos] != ',') {
+                error = "expected " + std::to_string(FIELD_COUNT) + " columns";
+                return false;
+            }
+            ++pos;
+        }
+    }
+    if (pos != line.size()) {
+        error = "expected " + std::to_string(FIELD_COUNT) + " columns";
+        return false;
+    }
+
+    // List columns: "a;b;c" and "name:CATEGORY;name:CATEGORY", with separators inside items escaped
+    for (std::string_view list = row.fields[INGREDIENTS]; !list.empty();) {
+        row.ingredients.push_back(unescapeListItem(takeListItem(list), scratch));
+    }
+    for (std::string_view list = row.fields[SIDE_DISHES]; !list.empty();) {
+        const std::string_view item = takeListItem(list);
+        const std::size_t colon = item.rfind(':');
+        if (colon == std::string_view::npos || escapedAt(item, colon)) {
+            error = "side dish '" + std::string(item) + "' has no category";
+            return false;
+        }
+        row.side_dishes.emplace_back(unescapeListItem(item.substr(0, colon), scratch), item.substr(colon + 1));
+    }
+    return true;
+}
+
+// JSON Lines: a flat object whose values are strings, numbers, booleans, arrays of strings, or arrays of
+// {"name": ..., "category": ...} objects
+
+class JsonCursor {
+public:
+    JsonCursor(std::string_view text, Scratch& scratch, std::string& error) : text_(text), pos_(0), scratch_(scratch), error_(error) {}
+
+    void skipSpace() {
+        while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\r')) {
+            ++pos_;
+        }
+    }
+
+    bool consume(char c) {
+        skipSpace();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool expect(char c) {
+        if (consume(c)) {
+            return true;
+        }
+        error_ = std::string("expected '") + c + "' at column " + std::to_string(pos_ + 1);
+        return false;
+    }
+
+    bool atEnd() {
+        skipSpace();
+        return pos_ == text_.size();
+    }
+
+    bool peek(char c) {
+        skipSpace();
+        return pos_ < text_.size() && text_[pos_] == c;
+    }
+
+    bool string(std::string_view& out) {
+        if (!expect('"')) {
+            return false;
+        }
+        const std::size_t start = pos_;
+        while (pos_ < text_.size() && text_[pos_] != '"' && text_[pos_] != '\\') {
+            ++pos_;
+        }
+        if (pos_ < text_.size() && text_[pos_] == '"') {
+            out = text_.substr(start, pos_ - start);  // no escapes: view the input directly
+            ++pos_;
+            return true;
+        }
+        std::string& value = scratch_.fresh();
+        value.assign(text_.substr(start, pos_ - start));
+        while (pos_ < text_.size() && text_[pos_] != '"') {
+            char c = text_[pos_++];
+            if (c == '\\') {
+                if (pos_ >= text_.size()) {
+                    break;
+                }
+                c = text_[pos_++];
+                switch (c) {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case 'r': c = '\r'; break;
+                    case 'b': c = '\b'; break;
+                    case 'f': c = '\f'; break;
+                    case 'u': {
+                        unsigned code = 0;
+                        if (pos_ + 4 > text_.size()
+                            || std::from_chars(text_.data() + pos_, text_.data() + pos_ + 4, code, 16).ptr != text_.data() + pos_ + 4) {
+                            error_ = "bad \\u escape";
+                            return false;
+                        }
+                        pos_ += 4;
+                        appendUtf8(value, code);
+                        continue;
+                    }
+                    default: break;  // '"', '\\', '/'
+                }
+            }
+            value.push_back(c);
+        }
+        if (pos_ >= text_.size()) {
+            error_ = "unterminated string";
+            return false;
+        }
+        ++pos_;
+        out = value;
+        return true;
+    }
+
+    // A number, true, false or null, returned as its raw text
+    bool scalar(std::string_view& out) {
+        skipSpace();
+        const std::size_t start = pos_;
+        while (pos_ < text_.size() && text_[pos_] != ',' && text_[pos_] != '}' && text_[pos_] != ']'
+               && text_[pos_] != ' ' && text_[pos_] != '\t' && text_[pos_] != '\r') {
+            ++pos_;
+        }
+        out = text_.substr(start, pos_ - start);
+        if (out.empty()) {
+            error_ = "expected a value at column " + std::to_string(start + 1);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    std::string_view text_;
+    std::size_t pos_;
+    Scratch& scratch_;
+    std::string& error_;
+
+    static void appendUtf8(std::string& out, unsigned code) {
+        if (code < 0x80) {
+            out.push_back(static_cast<char>(code));
+        } else if (code < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+    }
+};
+
+int fieldIndex(std::string_view key) {
+    for (int i = 0; i < FIELD_COUNT; ++i) {
+        if (kFieldNames[i] == key) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool parseJsonLine(std::string_view line, RawRow& row, Scratch& scratch, std::string& error) {
+    JsonCursor json(line, scratch, error);
+    if (!json.expect('{')) {
+        return false;
+    }
+    if (json.consume('}')) {
+        return json.atEnd() || (error = "trailing characters after object", false);
+    }
+    do {
+        std::string_view key;
+        if (!json.string(key) || !json.expect(':')) {
+            return false;
+        }
+        const int field = fieldIndex(key);
+        if (field == INGREDIENTS || field == SIDE_DISHES) {
+            if (!json.expect('[')) {
+                return false;
+            }
+            if (!json.consume(']')) {
+                do {
+                    if (field == INGREDIENTS) {
+                        std::string_view ingredient;
+                        if (!json.string(ingredient)) {
+                            return false;
+                        }
+                        row.ingredients.push_back(ingredient);
+                        continue;
+                    }
+                    std::string_view name;
+                    std::string_view category;
+                    if (!json.expect('{')) {
+                        return false;
+                    }
+                    do {
+                        std::string_view side_key;
+                        std::string_view value;
+                        if (!json.string(side_key) || !json.expect(':') || !json.string(value)) {
+                            return false;
+                        }
+                        if (side_key == "name") {
+                            name = value;
+                        } else if (side_key == "category") {
+                            category = value;
+                        }
+                    } while (json.consume(','));
+                    if (!json.expect('}')) {
+                        return false;
+                    }
+                    row.side_dishes.emplace_back(name, category);
+                } while (json.consume(','));
+                if (!json.expect(']')) {
+                    return false;
+                }
+            }
+            row.present[field] = true;
+        } else {
+            std::string_view value;
+            if (!(json.peek('"') ? json.string(value) : json.scalar(value))) {
+                return false;
+            }
+            if (field >= 0) {  // unknown keys are ignored
+                row.fields[field] = value;
+                row.present[field] = true;
+            }
+        }
+    } while (json.consume(','));
+    if (!json.expect('}')) {
+        return false;
+    }
+    if (!json.atEnd()) {
+        error = "trailing characters after object";
+        return false;
+    }
+    return true;
+}
+
+// Conversion of a RawRow into a dish
+
+class RowConverter {
+public:
+    RowConverter(const RawRow& row, std::string& error) : row_(row), error_(error) {}
+
+    bool require(Field field) {
+        if (!row_.present[field]) {
+            error_ = "missing field '" + std::string(kFieldNames[field]) + "'";
+            return false;
+        }
+        return true;
+    }
+
+    bool integer(Field field, int& out) {
+        if (!require(field)) {
+            return false;
+        }
+        const std::string_view text = row_.fields[field];
+        const auto result = std::from_chars(text.data(), text.data() + text.size(), out);
+        if (result.ec != std::errc() || result.ptr != text.data() + text.size()) {
+            error_ = "field '" + std::string(kFieldNames[field]) + "' is not an integer: " + std::string(text);
+            return false;
+        }
+        return true;
+    }
+
+    bool number(Field field, double& out) {
+        if (!require(field)) {
+            return false;
+        }
+        const std::string_view text = row_.fields[field];
+        const auto result = std::from_chars(text.data(), text.data() + text.size(), out);
+        if (result.ec != std::errc() || result.ptr != text.data() + text.size()) {
+            error_ = "field '" + std::string(kFieldNames[field]) + "' is not a number: " + std::string(text);
+            return false;
+        }
+        return true;
+    }
+
+    bool boolean(Field field, bool& out) {
+        if (!require(field)) {
+            return false;
+        }
+        const std::string_view text = row_.fields[field];
+        if (text == "true" || text == "True" || text == "1") {
+            out = true;
+        } else if (text == "false" || text == "False" || text == "0") {
+            out = false;
+        } else {
+            error_ = "field '" + std::string(kFieldNames[field]) + "' is not a boolean: " + std::string(text);
+            return false;
+        }
+        return true;
+    }
+
+    template <typename Enum>
+    bool enumeration(Field field, Enum& out) {
+        if (!require(field)) {
+            return false;
+        }
+        if (!fromString(row_.fields[field], out)) {
+            error_ = "field '" + std::string(kFieldNames[field]) + "' has unknown value " + std::string(row_.fields[field]);
+            return false;
+        }
+        return true;
+    }
+
+    // The fields every dish has
+    bool common(int& prep_time, double& price, Dish::CuisineType& cuisine_type) {
+        return require(NAME) && integer(PREP_TIME, prep_time) && number(PRICE, price) && enumeration(CUISINE_TYPE, cuisine_type);
+    }
+
+    std::vector<IngredientId> ingredientIds() const {
+        std::vector<IngredientId> ids;
+        ids.reserve(row_.ingredients.size());
+        for (std::string_view ingredient : row_.ingredients) {
+            ids.push_back(IngredientTable::global().intern(ingredient));
+        }
+        return ids;
+    }
+
+private:
+    const RawRow& row_;
+    std::string& error_;
+};
+
+// Converts one row whose name has already been validated; returns false and sets error on failure
+bool convertRow(const RawRow& row, MenuImporter::Result& out, std::string& error) {
+    RowConverter convert(row, error);
+    int prep_time = 0;
+    double price = 0.0;
+    Dish::CuisineType cuisine_type = Dish::CuisineType::OTHER;
+    if (!convert.common(prep_time, price, cuisine_type)) {
+        return false;
+    }
+    const std::string_view kind = row.fields[KIND];
+    const std::string name(row.fields[NAME]);
+
+    if (kind == "Dish") {
+        out.dishes.emplace_back(name, std::vector<std::string>{}, prep_time, price, cuisine_type);
+        const std::vector<IngredientId> ids = convert.ingredientIds();
+        out.dishes.back().setIngredientIds(ids);
+    } else if (kind == "Appetizer") {
+        Appetizer::ServingStyle serving_style;
+        int spiciness_level;
+        bool vegetarian;
+        if (!convert.enumeration(SERVING_STYLE, serving_style) || !convert.integer(SPICINESS_LEVEL, spiciness_level)
+            || !convert.boolean(VEGETARIAN, vegetarian)) {
+            return false;
+        }
+        out.appetizers.emplace_back(name, std::vector<std::string>{}, prep_time, price, cuisine_type, serving_style,
+                                    spiciness_level, vegetarian);
+        const std::vector<IngredientId> ids = convert.ingredientIds();
+        out.appetizers.back().setIngredientIds(ids);
+    } else if (kind == "MainCourse") {
+        MainCourse::CookingMethod cooking_method;
+        bool gluten_free;
+        if (!convert.enumeration(COOKING_METHOD, cooking_method) || !convert.require(PROTEIN_TYPE)
+            || !convert.boolean(GLUTEN_FREE, gluten_free)) {
+            return false;
+        }
+        std::vector<MainCourse::SideDish> sides;
+        sides.reserve(row.side_dishes.size());
+        for (const auto& side : row.side_dishes) {
+            MainCourse::Category category;
+            if (!fromString(side.second, category)) {
+                error = "side dish '" + std::string(side.first) + "' has unknown category " + std::string(side.second);
+                return false;
+            }
+            sides.push_back({std::string(side.first), category});
+        }
+        out.main_courses.emplace_back(name, std::vector<std::string>{}, prep_time, price, cuisine_type, cooking_method,
+                                      std::string(row.fields[PROTEIN_TYPE]), std::move(sides), gluten_free);
+        const std::vector<IngredientId> ids = convert.ingredientIds();
+        out.main_courses.back().setIngredientIds(ids);
+    } else if (kind == "Dessert") {
+        Dessert::FlavorProfile flavor_profile;
+        int sweetness_level;
+        bool contains_nuts;
+        if (!convert.enumeration(FLAVOR_PROFILE, flavor_profile) || !convert.integer(SWEETNESS_LEVEL, sweetness_level)
+            || !convert.boolean(CONTAINS_NUTS, contains_nuts)) {
+            return false;
+        }
+        out.desserts.emplace_back(name, std::vector<std::string>{}, prep_time, price, cuisine_type, flavor_profile,
+                                  sweetness_level, contains_nuts);
+        const std::vector<IngredientId> ids = convert.ingredientIds();
+        out.desserts.back().setIngredientIds(ids);
+    } else {
+        error = "unknown kind '" + std::string(kind) + "'";
+        return false;
+    }
+    return true;
+}
+
+// Parses one chunk of whole lines; line numbers in the result are relative to the chunk (1-based)
+void parseChunk(std::string_view chunk, MenuRenderer::Format format, ChunkResult& out) {
+    Scratch scratch;
+    std::vector<RawRow> rows;
+    std::string error;
+    std::size_t line_number = 0;
+
+    while (!chunk.empty()) {
+        const std::size_t end = std::min(chunk.find('\n'), chunk.size());
+        std::string_view line = chunk.substr(0, end);
+        chunk.remove_prefix(std::min(end + 1, chunk.size()));
+        ++line_number;
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty() || (format == MenuRenderer::Format::CSV && line.substr(0, 5) == "kind,")) {
+            continue;  // blank line or CSV header
+        }
+
+        ++out.result.rows;
+        RawRow row;
+        row.line = line_number;
+        const bool parsed = format == MenuRenderer::Format::CSV ? parseCsvLine(line, row, scratch, error)
+                                                                : parseJsonLine(line, row, scratch, error);
+        if (!parsed) {
+            out.result.errors.push_back({line_number, error});
+            continue;
+        }
+        if (!row.present[KIND]) {
+            out.result.errors.push_back({line_number, "missing field 'kind'"});
+            continue;
+        }
+        rows.push_back(std::move(row));
+    }
+    out.lines = line_number;
+
+    // Bulk name validation for the whole chunk
+    std::vector<std::string_view> names;
+    names.reserve(rows.size());
+    for (const RawRow& row : rows) {
+        names.push_back(row.fields[NAME]);
+    }
+    const Bitmap invalid = validateDishNames(names);
+
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        if (invalid.test(i)) {
+            out.result.errors.push_back({rows[i].line, "invalid dish name '" + std::string(rows[i].fields[NAME]) + "'"});
+        } else if (!convertRow(rows[i], out.result, error)) {
+            out.result.errors.push_back({rows[i].line, error});
+        }
+    }
+    std::sort(out.result.errors.begin(), out.result.errors.end(),
+              [](const MenuImporter::RowError& a, const MenuImporter::RowError& b) { return a.line < b.line; });
+}
+
+template <typename T>
+void appendMoved(std::vector<T>& to, std::vector<T>& from) {
+    to.insert(to.end(), std::make_move_iterator(from.begin()), std::make_move_iterator(from.end()));
+}
+
+} // namespace
+
+// Parameterized Constructor
+MenuImporter::MenuImporter(MenuRenderer::Format format, std::size_t threads, std::size_t chunk_bytes)
+        : format_(format), chunk_bytes_(chunk_bytes == 0 ? 1 : chunk_bytes), pool_(new ThreadPool(threads)) {
+    if (format == MenuRenderer::Format::TEXT) {
+        throw std::invalid_argument("MenuImporter: the TEXT format cannot be imported");
+    }
+}
+
+MenuImporter::Result MenuImporter::importBuffer(std::string_view data) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::IMPORT);
+    Result result;
+    importWindow(data, 1, result);
+    return result;
+}
+
+MenuImporter::Result MenuImporter::importStream(std::istream& input) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::IMPORT);
+    Result result;
+    const std::size_t window = chunk_bytes_ * pool_->size();
+    std::string buffer;
+    std::size_t line = 1;
+    for (;;) {
+        const std::size_t kept = buffer.size();
+        buffer.resize(kept + window);
+        input.read(&buffer[kept], static_cast<std::streamsize>(window));
+        buffer.resize(kept + static_cast<std::size_t>(input.gcount()));
+        if (input.bad()) {
+            throw std::runtime_error("MenuImporter: cannot read the input stream");
+        }
+        const bool at_end = !input;  // eofbit, and failbit for the short read
+
+        // Hand over whole lines only; the partial last line waits for the next read
+        const std::size_t cut = at_end ? buffer.size() : buffer.rfind('\n') + 1;
+        if (cut == 0 && !at_end) {
+            continue;  // no line break yet: keep reading
+        }
+        const std::string_view lines(buffer.data(), cut);
+        importWindow(lines, line, result);
+        line += static_cast<std::size_t>(std::count(lines.begin(), lines.end(), '\n'));
+        buffer.erase(0, cut);
+        if (at_end) {
+            return result;
+        }
+    }
+}
+
+MenuImporter::Result MenuImporter::importFile(const std::string& path) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::IMPORT);
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("MenuImporter: cannot open " + path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("MenuImporter: cannot stat " + path);
+    }
+    const std::size_t size = static_cast<std::size_t>(info.st_size);
+    if (size == 0) {
+        ::close(fd);
+        return Result();
+    }
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("MenuImporter: cannot map " + path);
+    }
+    ::madvise(mapping, size, MADV_SEQUENTIAL);
+    Result result;
+    try {
+        importWindow(std::string_view(static_cast<const char*>(mapping), size), 1, result);
+    } catch (...) {
+        ::munmap(mapping, size);
+        throw;
+    }
+    ::munmap(mapping, size);
+    return result;
+}
+
+// Helper function: split at line boundaries, parse the chunks in parallel, merge in order
+void MenuImporter::importWindow(std::string_view data, std::size_t first_line, Result& result) const {
+    std::vector<std::string_view> chunks;
+    while (!data.empty()) {
+        std::size_t end = std::min(chunk_bytes_, data.size());
+        if (end < data.size()) {
+            const std::size_t newline = data.find('\n', end - 1);
+            end = newline == std::string_view::npos ? data.size() : newline + 1;
+        }
+        chunks.push_back(data.substr(0, end));
+        data.remove_prefix(end);
+    }
+
+    std::vector<ChunkResult> parsed(chunks.size());
+    pool_->parallelFor(chunks.size(), [&](std::size_t i) { parseChunk(chunks[i], format_, parsed[i]); });
+
+    // Reserve once so that the merge moves every dish exactly once
+    std::size_t sizes[4] = {result.dishes.size(), result.appetizers.size(), result.main_courses.size(), result.desserts.size()};
+    for (const ChunkResult& chunk : parsed) {
+        sizes[0] += chunk.result.dishes.size();
+        sizes[1] += chunk.result.appetizers.size();
+        sizes[2] += chunk.result.main_courses.size();
+        sizes[3] += chunk.result.desserts.size();
+    }
+    result.dishes.reserve(sizes[0]);
+    result.appetizers.reserve(sizes[1]);
+    result.main_courses.reserve(sizes[2]);
+    result.desserts.reserve(sizes[3]);
+
+    std::size_t line = first_line;
+    for (std::size_t i = 0; i < parsed.size(); ++i) {
+        Result& chunk = parsed[i].result;
+        for (RowError& error : chunk.errors) {
+            error.line += line - 1;
+            result.errors.push_back(std::move(error));
+        }
+        appendMoved(result.dishes, chunk.dishes);
+        appendMoved(result.appetizers, chunk.appetizers);
+        appendMoved(result.main_courses, chunk.main_courses);
+        appendMoved(result.desserts, chunk.desserts);
+        result.rows += chunk.rows;
+        result.bytes += chunks[i].size();
+        line += parsed[i].lines;
+    }
+}
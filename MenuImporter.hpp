@@ -0,0 +1,108 @@
+/**
+ * @file MenuImporter.hpp
+ * @brief This file contains the declaration of the MenuImporter class, a parallel streaming loader for menus written
+ * as CSV or JSON Lines.
+ *
+ * The accepted formats are the ones MenuRenderer writes: CSV rows with the columns of MenuRenderer::csvHeader()
+ * (the header line itself is optional and skipped), or one JSON object per line with the same keys. Every field of
+ * Dish, Appetizer, MainCourse and Dessert is covered, including side dishes with their Category.
+ *
+ * Input is cut into chunks at line boundaries; chunks are parsed concurrently on a ThreadPool, dish names are
+ * validated per chunk with validateDishNames(), and the per-chunk results are concatenated in input order.
+ * A malformed row is reported as a RowError with its 1-based line number and skipped; the import continues.
+ * Records must not contain raw line breaks (quoted CSV fields with embedded newlines are not supported).
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef MENU_IMPORTER_HPP
+#define MENU_IMPORTER_HPP
+
+#include "Appetizer.hpp"
+#include "Dessert.hpp"
+#include "Dish.hpp"
+#include "MainCourse.hpp"
+#include "MenuRenderer.hpp"
+#include "ThreadPool.hpp"
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class MenuImporter {
+public:
+    // A row that could not be imported
+    struct RowError {
+        std::size_t line;
+        std::string message;
+    };
+
+    // The dishes and errors of one import, in input order
+    struct Result {
+        std::vector<Dish> dishes;
+        std::vector<Appetizer> appetizers;
+        std::vector<MainCourse> main_courses;
+        std::vector<Dessert> desserts;
+        std::vector<RowError> errors;
+        std::size_t rows = 0;   // data rows seen (header and blank lines excluded)
+        std::size_t bytes = 0;  // input bytes consumed
+
+        /**
+         * @return The number of dishes imported successfully.
+         */
+        std::size_t imported() const { return dishes.size() + appetizers.size() + main_courses.size() + desserts.size(); }
+    };
+
+    // Constructors
+    /**
+     * Parameterized constructor.
+     * @param format The input format: MenuRenderer::Format::CSV or MenuRenderer::Format::JSON_LINES.
+     * @param threads The number of parser threads; 0 (the default) uses every hardware thread.
+     * @param chunk_bytes The target size of the chunks handed to each parser task (default is 1 MiB).
+     * @throw std::invalid_argument if the format is TEXT.
+     */
+    explicit MenuImporter(MenuRenderer::Format format, std::size_t threads = 0, std::size_t chunk_bytes = std::size_t{1} << 20);
+
+    // Accessors
+    /**
+     * @return The number of parser threads.
+     */
+    std::size_t threadCount() const { return pool_->size(); }
+
+    // Importing
+    /**
+     * Imports every row of an in-memory buffer.
+     * @param data The CSV or JSON Lines text.
+     * @return The imported dishes and the per-row errors.
+     */
+    Result importBuffer(std::string_view data) const;
+
+    /**
+     * Imports a stream, reading it in windows of threadCount() chunks so that memory use stays bounded.
+     * @param input The stream to read until end of file.
+     * @return The imported dishes and the per-row errors.
+     * @throw std::runtime_error if the stream fails (badbit) before its end; no partial result is returned.
+     */
+    Result importStream(std::istream& input) const;
+
+    /**
+     * Imports a file by mapping it into memory.
+     * @param path The file to import.
+     * @return The imported dishes and the per-row errors.
+     * @throw std::runtime_error if the file cannot be opened.
+     */
+    Result importFile(const std::string& path) const;
+
+private:
+    MenuRenderer::Format format_;
+    std::size_t chunk_bytes_;
+    std::unique_ptr<ThreadPool> pool_;
+
+    // Parses [data) whose first line has the given 1-based number, appending to result
+    void importWindow(std::string_view data, std::size_t first_line, Result& result) const;
+};
+
+#endif // MENU_IMPORTER_HPP
@@ -0,0 +1,322 @@
+/**
+ * @file MenuRenderer.cpp
+ * @brief This file contains the implementation of the MenuRenderer class, which formats dishes into a caller-supplied
+ * buffer.
+ *
+ * Numbers are formatted with std::to_chars (fixed notation with precision 2 produces the same digits as
+ * std::fixed << std::setprecision(2)), so rendering needs no stream and leaves no formatting state behind.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "MenuRenderer.hpp"
+#include "EnumNames.hpp"
+#include "Instrumentation.hpp"
+#include <charconv>
+#include <cstdio>
+
+namespace {
+
+void appendInt(std::string& out, long long value) {
+    char buffer[24];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+void appendPrice(std::string& out, double price) {
+    char buffer[400];  // large enough for any double in fixed notation
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), price, std::chars_format::fixed, 2);
+    out.append(buffer, result.ptr);
+}
+
+void appendBool(std::string& out, bool value, std::string_view yes, std::string_view no) {
+    out.append(value ? yes : no);
+}
+
+// Text format: "a, b, c"
+void appendIngredientText(std::string& out, const Dish& dish) {
+    for (std::size_t i = 0; i < dish.getIngredientCount(); ++i) {
+        if (i != 0) {
+            out.append(", ");
+        }
+        out.append(dish.getIngredient(i));
+    }
+}
+
+// CSV list item: the separators ';' and ':' and the escape character itself are preceded by a backslash
+void appendListItem(std::string& out, std::string_view item) {
+    for (char c : item) {
+        if (c == ';' || c == ':' || c == '\\') {
+            out.push_back('\\');
+        }
+        out.push_back(c);
+    }
+}
+
+// Writes the fields of one CSV row or JSON object; the field order is the CSV column order
+class RecordWriter {
+public:
+    // `first` is false when continuing a record whose common fields were already written
+    RecordWriter(MenuRenderer::Format format, std::string& out, bool first) : format_(format), out_(out), first_(first) {}
+
+    void string(std::string_view key, std::string_view value) {
+        field(key);
+        quoted(value);
+    }
+
+    void integer(std::string_view key, long long value) {
+        field(key);
+        appendInt(out_, value);
+    }
+
+    void price(std::string_view key, double value) {
+        field(key);
+        appendPrice(out_, value);
+    }
+
+    void boolean(std::string_view key, bool value) {
+        field(key);
+        appendBool(out_, value, "true", "false");
+    }
+
+    void ingredients(std::string_view key, const Dish& dish) {
+        field(key);
+        if (format_ == MenuRenderer::Format::JSON_LINES) {
+            out_.push_back('[');
+            for (std::size_t i = 0; i < dish.getIngredientCount(); ++i) {
+                if (i != 0) {
+                    out_.push_back(',');
+                }
+                quoted(dish.getIngredient(i));
+            }
+            out_.push_back(']');
+        } else {
+            std::string joined;
+            for (std::size_t i = 0; i < dish.getIngredientCount(); ++i) {
+                if (i != 0) {
+                    joined.push_back(';');
+                }
+                appendListItem(joined, dish.getIngredient(i));
+            }
+            quoted(joined);
+        }
+    }
+
+    void sideDishes(std::string_view key, Span<const MainCourse::SideDish> sides) {
+        field(key);
+        if (format_ == MenuRenderer::Format::JSON_LINES) {
+            out_.push_back('[');
+            for (std::size_t i = 0; i < sides.size(); ++i) {
+                out_.append(i == 0 ? "{\"name\":" : ",{\"name\":");
+                quoted(sides[i].name);
+                out_.append(",\"category\":\"");
+                out_.append(toString(sides[i].category));
+                out_.append("\"}");
+            }
+            out_.push_back(']');
+        } else {
+            std::string joined;
+            for (std::size_t i = 0; i < sides.size(); ++i) {
+                if (i != 0) {
+                    joined.push_back(';');
+                }
+                appendListItem(joined, sides[i].name);
+                joined.push_back(':');
+                joined.append(toString(sides[i].category));
+            }
+            quoted(joined);
+        }
+    }
+
+    // Leaves a CSV column empty (JSON objects simply omit the key)
+    void skip(int columns) {
+        if (format_ == MenuRenderer::Format::CSV) {
+            out_.append(static_cast<std::size_t>(columns), ',');
+        }
+    }
+
+private:
+    MenuRenderer::Format format_;
+    std::string& out_;
+    bool first_;
+
+    void field(std::string_view key) {
+        if (format_ == MenuRenderer::Format::JSON_LINES) {
+            out_.append(first_ ? "\"" : ",\"");
+            out_.append(key);
+            out_.append("\":");
+        } else if (!first_) {
+            out_.push_back(',');
+        }
+        first_ = false;
+    }
+
+    void quoted(std::string_view value) {
+        if (format_ == MenuRenderer::Format::JSON_LINES) {
+            out_.push_back('"');
+            for (char c : value) {
+                switch (c) {
+                    case '"': out_.append("\\\""); break;
+                    case '\\': out_.append("\\\\"); break;
+                    case '\n': out_.append("\\n"); break;
+                    case '\r': out_.append("\\r"); break;
+                    case '\t': out_.append("\\t"); break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            char escape[8];
+                            std::snprintf(escape, sizeof(escape), "\\u%04x", static_cast<unsigned>(c));
+                            out_.append(escape);
+                        } else {
+                            out_.push_back(c);
+                        }
+                }
+            }
+            out_.push_back('"');
+        } else if (value.find_first_of(",\"\n\r") == std::string_view::npos) {
+            out_.append(value);
+        } else {
+            out_.push_back('"');
+            for (char c : value) {
+                if (c == '"') {
+                    out_.push_back('"');
+                }
+                out_.push_back(c);
+            }
+            out_.push_back('"');
+        }
+    }
+};
+
+} // namespace
+
+// Parameterized Constructor
+MenuRenderer::MenuRenderer(Format format) : format_(format) {}
+
+std::string_view MenuRenderer::csvHeader() {
+    return "kind,name,ingredients,prep_time,price,cuisine_type,serving_style,spiciness_level,vegetarian,"
+           "cooking_method,protein_type,side_dishes,gluten_free,flavor_profile,sweetness_level,contains_nuts\n";
+}
+
+void MenuRenderer::render(const Dish& dish, std::string& out) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::RENDER);
+    beginRecord("Dish", dish, out);
+    if (format_ == Format::CSV) {
+        RecordWriter(format_, out, false).skip(10);
+    }
+    endRecord(out);
+}
+
+void MenuRenderer::render(const Appetizer& appetizer, std::string& out) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::RENDER);
+    beginRecord("Appetizer", appetizer, out);
+    if (format_ == Format::TEXT) {
+        out.append("Spiciness Level: ");
+        appendInt(out, appetizer.getSpicinessLevel());
+        out.append("\nServing Style: ");
+        out.append(toString(appetizer.getServingStyle()));
+        out.append("\nVegetarian: ");
+        appendBool(out, appetizer.isVegetarian(), "True", "False");
+        out.push_back('\n');
+        return;
+    }
+    RecordWriter writer(format_, out, false);
+    writer.string("serving_style", toString(appetizer.getServingStyle()));
+    writer.integer("spiciness_level", appetizer.getSpicinessLevel());
+    writer.boolean("vegetarian", appetizer.isVegetarian());
+    writer.skip(7);
+    endRecord(out);
+}
+
+void MenuRenderer::render(const MainCourse& main_course, std::string& out) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::RENDER);
+    beginRecord("MainCourse", main_course, out);
+    const Span<const MainCourse::SideDish> sides = main_course.getSideDishesView();
+    if (format_ == Format::TEXT) {
+        out.append("Cooking Method: ");
+        out.append(toString(main_course.getCookingMethod()));
+        out.append("\nProtein Type: ");
+        out.append(main_course.getProteinTypeView());
+        out.append("\nSide Dishes: ");
+        for (std::size_t i = 0; i < sides.size(); ++i) {
+            if (i != 0) {
+                out.append(", ");
+            }
+            out.append(sides[i].name);
+            out.append(" (");
+            out.append(toDisplayString(sides[i].category));
+            out.push_back(')');
+        }
+        out.append("\nGluten-Free: ");
+        appendBool(out, main_course.isGlutenFree(), "True", "False");
+        out.push_back('\n');
+        return;
+    }
+    RecordWriter writer(format_, out, false);
+    writer.skip(3);
+    writer.string("cooking_method", toString(main_course.getCookingMethod()));
+    writer.string("protein_type", main_course.getProteinTypeView());
+    writer.sideDishes("side_dishes", sides);
+    writer.boolean("gluten_free", main_course.isGlutenFree());
+    writer.skip(3);
+    endRecord(out);
+}
+
+void MenuRenderer::render(const Dessert& dessert, std::string& out) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::RENDER);
+    beginRecord("Dessert", dessert, out);
+    if (format_ == Format::TEXT) {
+        out.append("Flavor Profile: ");
+        out.append(toString(dessert.getFlavorProfile()));
+        out.append("\nSweetness Level: ");
+        appendInt(out, dessert.getSweetnessLevel());
+        out.append("\nContains Nuts: ");
+        appendBool(out, dessert.containsNuts(), "True", "False");
+        out.push_back('\n');
+        return;
+    }
+    RecordWriter writer(format_, out, false);
+    writer.skip(7);
+    writer.string("flavor_profile", toString(dessert.getFlavorProfile()));
+    writer.integer("sweetness_level", dessert.getSweetnessLevel());
+    writer.boolean("contains_nuts", dessert.containsNuts());
+    endRecord(out);
+}
+
+// Helper functions
+
+void MenuRenderer::beginRecord(std::string_view kind, const Dish& dish, std::string& out) const {
+    if (format_ == Format::TEXT) {
+        out.append("Dish Name: ");
+        out.append(dish.getNameView());
+        out.append("\nIngredients: ");
+        appendIngredientText(out, dish);
+        out.append("\nPreparation Time: ");
+        appendInt(out, dish.getPrepTime());
+        out.append(" minutes\nPrice: $");
+        appendPrice(out, dish.getPrice());
+        out.append("\nCuisine Type: ");
+        out.append(toString(dish.getCuisine()));
+        out.push_back('\n');
+        return;
+    }
+    RecordWriter writer(format_, out, true);
+    if (format_ == Format::JSON_LINES) {
+        out.push_back('{');
+    }
+    writer.string("kind", kind);
+    writer.string("name", dish.getNameView());
+    writer.ingredients("ingredients", dish);
+    writer.integer("prep_time", dish.getPrepTime());
+    writer.price("price", dish.getPrice());
+    writer.string("cuisine_type", toString(dish.getCuisine()));
+}
+
+void MenuRenderer::endRecord(std::string& out) const {
+    if (format_ == Format::JSON_LINES) {
+        out.push_back('}');
+    }
+    if (format_ != Format::TEXT) {
+        out.push_back('\n');
+    }
+}
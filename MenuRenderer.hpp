@@ -0,0 +1,97 @@
+/**
+ * @file MenuRenderer.hpp
+ * @brief This file contains the declaration of the MenuRenderer class, which formats dishes into a caller-supplied
+ * buffer instead of writing to a stream line by line.
+ *
+ * Three formats are supported:
+ * - TEXT: the format of Dish::display(), byte for byte, followed by the subclass-specific lines
+ *   ("Spiciness Level: 7", "Side Dishes: Mashed Potatoes (Starches), ...") for Appetizer, MainCourse and Dessert.
+ * - CSV: one row per dish with the columns of csvHeader(); list fields are joined with ';' and side dishes are
+ *   written as name:CATEGORY. Inside a list item, ';', ':' and '\\' are escaped with a backslash.
+ * - JSON_LINES: one JSON object per line.
+ * Rendering only appends to the buffer and never touches stream formatting flags; renderMenu() then hands the
+ * whole menu to the sink in a single write.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef MENU_RENDERER_HPP
+#define MENU_RENDERER_HPP
+
+#include "Appetizer.hpp"
+#include "Dessert.hpp"
+#include "Dish.hpp"
+#include "MainCourse.hpp"
+#include <ostream>
+#include <string>
+#include <string_view>
+
+class MenuRenderer {
+public:
+    // Output formats
+    enum class Format { TEXT, CSV, JSON_LINES };
+
+    // Constructors
+    /**
+     * Parameterized constructor.
+     * @param format The output format (default is TEXT).
+     */
+    explicit MenuRenderer(Format format = Format::TEXT);
+
+    // Accessors
+    /**
+     * @return The output format of the renderer.
+     */
+    Format getFormat() const { return format_; }
+
+    /**
+     * @return The CSV header line (with a trailing newline) naming the columns written in CSV format.
+     */
+    static std::string_view csvHeader();
+
+    // Rendering
+    /**
+     * Appends one dish to a buffer. Overloads exist for each subclass so that its own fields are included.
+     * @param dish The dish to render.
+     * @param out The buffer to append to.
+     */
+    void render(const Dish& dish, std::string& out) const;
+    void render(const Appetizer& appetizer, std::string& out) const;
+    void render(const MainCourse& main_course, std::string& out) const;
+    void render(const Dessert& dessert, std::string& out) const;
+
+    /**
+     * Appends every dish in [first, last) to a buffer, preceded by the header line in CSV format.
+     */
+    template <typename It>
+    void renderMenu(It first, It last, std::string& out) const {
+        if (format_ == Format::CSV) {
+            out.append(csvHeader());
+        }
+        for (; first != last; ++first) {
+            render(*first, out);
+        }
+    }
+
+    /**
+     * Renders every dish in [first, last) and writes the result to a stream with a single write.
+     * @return The number of bytes written.
+     */
+    template <typename It>
+    std::size_t renderMenu(It first, It last, std::ostream& sink) const {
+        std::string buffer;
+        renderMenu(first, last, buffer);
+        sink.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        return buffer.size();
+    }
+
+private:
+    Format format_;
+
+    // Helper functions for the per-format pieces shared by all subclasses
+    void beginRecord(std::string_view kind, const Dish& dish, std::string& out) const;
+    void endRecord(std::string& out) const;
+};
+
+#endif // MENU_RENDERER_HPP
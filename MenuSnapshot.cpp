@@ -0,0 +1,356 @@
+/**
+ * @file MenuSnapshot.cpp
+ * @brief This file contains the implementation of the MenuSnapshot class, a versioned binary menu file that is
+ * memory-mapped and read in place.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "MenuSnapshot.hpp"
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>     // For open
+#include <sys/mman.h>  // For mmap, munmap
+#include <sys/stat.h>  // For fstat
+#include <unistd.h>    // For close
+
+namespace {
+
+constexpr char kMagic[8] = {'B', 'S', 'T', 'R', 'S', 'N', 'A', 'P'};
+
+struct Section {
+    std::uint64_t offset;
+    std::uint64_t count;  // bytes for the string pool, records otherwise
+};
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_size;
+    std::uint64_t file_size;
+    std::uint32_t record_sizes[5];  // guards against reading a file written with a different record layout
+    std::uint32_t reserved;
+    Section strings;
+    Section ingredients;
+    Section side_dishes;
+    Section appetizers;
+    Section main_courses;
+    Section desserts;
+};
+
+void expectedRecordSizes(std::uint32_t (&sizes)[5]) {
+    sizes[0] = sizeof(MenuSnapshot::StringRef);
+    sizes[1] = sizeof(MenuSnapshot::SideDishRecord);
+    sizes[2] = sizeof(MenuSnapshot::AppetizerRecord);
+    sizes[3] = sizeof(MenuSnapshot::MainCourseRecord);
+    sizes[4] = sizeof(MenuSnapshot::DessertRecord);
+}
+
+// Accumulates the sections of a snapshot while it is being written
+class SnapshotBuilder {
+public:
+    MenuSnapshot::StringRef intern(std::string_view value) {
+        auto it = refs_.find(std::string(value));
+        if (it != refs_.end()) {
+            return it->second;
+        }
+        if (pool_.size() + value.size() > UINT32_MAX) {
+            throw std::runtime_error("MenuSnapshot: string pool exceeds 4 GiB");
+        }
+        const MenuSnapshot::StringRef ref = {static_cast<std::uint32_t>(pool_.size()), static_cast<std::uint32_t>(value.size())};
+        pool_.append(value);
+        refs_.emplace(std::string(value), ref);
+        return ref;
+    }
+
+    MenuSnapshot::DishRecord dish(const Dish& dish) {
+        MenuSnapshot::DishRecord record = {};
+        record.name = intern(dish.getNameView());
+        record.ingredients_begin = static_cast<std::uint32_t>(ingredients_.size());
+        record.ingredient_count = static_cast<std::uint32_t>(dish.getIngredientCount());
+        for (std::size_t i = 0; i < dish.getIngredientCount(); ++i) {
+            ingredients_.push_back(intern(dish.getIngredient(i)));
+        }
+        record.price = dish.getPrice();
+        record.prep_time = dish.getPrepTime();
+        record.cuisine_type = static_cast<std::uint8_t>(dish.getCuisine());
+        return record;
+    }
+
+    std::string pool_;
+    std::unordered_map<std::string, MenuSnapshot::StringRef> refs_;
+    std::vector<MenuSnapshot::StringRef> ingredients_;
+    std::vector<MenuSnapshot::SideDishRecord> side_dishes_;
+};
+
+// Appends a section to the output buffer at the next 8-byte boundary
+template <typename T>
+Section appendSection(std::vector<unsigned char>& out, const T* data, std::size_t count, std::size_t bytes) {
+    out.resize((out.size() + 7) & ~std::size_t{7}, 0);
+    const Section section = {out.size(), count};
+    const unsigned char* begin = reinterpret_cast<const unsigned char*>(data);
+    out.insert(out.end(), begin, begin + bytes);
+    return section;
+}
+
+template <typename T>
+Section appendRecords(std::vector<unsigned char>& out, const std::vector<T>& records) {
+    return appendSection(out, records.data(), records.size(), records.size() * sizeof(T));
+}
+
+bool sectionFits(const Section& section, std::size_t element_size, std::size_t file_size) {
+    return section.offset % 8 == 0 && section.offset <= file_size
+           && section.count <= (file_size - section.offset) / element_size;
+}
+
+} // namespace
+
+// Views
+
+void MenuSnapshot::DishView::fill(Dish& dish) const {
+    dish.setName(getName());
+    std::vector<IngredientId> ids;
+    ids.reserve(getIngredientCount());
+    for (std::size_t i = 0; i < getIngredientCount(); ++i) {
+        ids.push_back(IngredientTable::global().intern(getIngredient(i)));
+    }
+    dish.setIngredientIds(ids);
+    dish.setPrepTime(getPrepTime());
+    dish.setPrice(getPrice());
+    dish.setCuisineType(getCuisine());
+}
+
+Appetizer MenuSnapshot::AppetizerView::materialize(const Dish::allocator_type& allocator) const {
+    Appetizer appetizer(allocator);
+    fill(appetizer);
+    appetizer.setServingStyle(getServingStyle());
+    appetizer.setSpicinessLevel(getSpicinessLevel());
+    appetizer.setVegetarian(isVegetarian());
+    return appetizer;
+}
+
+MainCourse MenuSnapshot::MainCourseView::materialize(const Dish::allocator_type& allocator) const {
+    MainCourse main_course(allocator);
+    fill(main_course);
+    main_course.setCookingMethod(getCookingMethod());
+    main_course.setProteinType(getProteinType());
+    main_course.setGlutenFree(isGlutenFree());
+    for (std::size_t i = 0; i < getSideDishCount(); ++i) {
+        main_course.addSideDish(MainCourse::SideDish(getSideDishName(i), getSideDishCategory(i), allocator));
+    }
+    return main_course;
+}
+
+Dessert MenuSnapshot::DessertView::materialize(const Dish::allocator_type& allocator) const {
+    Dessert dessert(allocator);
+    fill(dessert);
+    dessert.setFlavorProfile(getFlavorProfile());
+    dessert.setSweetnessLevel(getSweetnessLevel());
+    dessert.setContainsNuts(containsNuts());
+    return dessert;
+}
+
+// MenuSnapshot
+
+// Default Constructor
+MenuSnapshot::MenuSnapshot()
+        : data_(nullptr), size_(0), strings_(nullptr), ingredients_(nullptr), side_dishes_(nullptr), appetizers_(nullptr),
+          main_courses_(nullptr), desserts_(nullptr), appetizer_count_(0), main_course_count_(0), dessert_count_(0) {}
+
+// Move Constructor
+MenuSnapshot::MenuSnapshot(MenuSnapshot&& other) noexcept : MenuSnapshot() {
+    *this = std::move(other);
+}
+
+// Move Assignment
+MenuSnapshot& MenuSnapshot::operator=(MenuSnapshot&& other) noexcept {
+    if (this != &other) {
+        close();
+        data_ = other.data_;
+        size_ = other.size_;
+        strings_ = other.strings_;
+        ingredients_ = other.ingredients_;
+        side_dishes_ = other.side_dishes_;
+        appetizers_ = other.appetizers_;
+        main_courses_ = other.main_courses_;
+        desserts_ = other.desserts_;
+        appetizer_count_ = other.appetizer_count_;
+        main_course_count_ = other.main_course_count_;
+        dessert_count_ = other.dessert_count_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.appetizer_count_ = other.main_course_count_ = other.dessert_count_ = 0;
+    }
+    return *this;
+}
+
+// Destructor
+MenuSnapshot::~MenuSnapshot() {
+    close();
+}
+
+void MenuSnapshot::write(const std::string& path, Span<const Appetizer> appetizers, Span<const MainCourse> main_courses,
+                         Span<const Dessert> desserts) {
+    SnapshotBuilder builder;
+    std::vector<AppetizerRecord> appetizer_records;
+    std::vector<MainCourseRecord> main_course_records;
+    std::vector<DessertRecord> dessert_records;
+
+    for (const Appetizer& appetizer : appetizers) {
+        AppetizerRecord record = {};
+        record.dish = builder.dish(appetizer);
+        record.spiciness_level = appetizer.getSpicinessLevel();
+        record.serving_style = static_cast<std::uint8_t>(appetizer.getServingStyle());
+        record.vegetarian = appetizer.isVegetarian();
+        appetizer_records.push_back(record);
+    }
+    for (const MainCourse& main_course : main_courses) {
+        MainCourseRecord record = {};
+        record.dish = builder.dish(main_course);
+        record.protein_type = builder.intern(main_course.getProteinTypeView());
+        record.side_dishes_begin = static_cast<std::uint32_t>(builder.side_dishes_.size());
+        record.side_dish_count = static_cast<std::uint32_t>(main_course.getSideDishesView().size());
+        for (const MainCourse::SideDish& side : main_course.getSideDishesView()) {
+            builder.side_dishes_.push_back({builder.intern(side.name), static_cast<std::uint32_t>(side.category)});
+        }
+        record.cooking_method = static_cast<std::uint8_t>(main_course.getCookingMethod());
+        record.gluten_free = main_course.isGlutenFree();
+        main_course_records.push_back(record);
+    }
+    for (const Dessert& dessert : desserts) {
+        DessertRecord record = {};
+        record.dish = builder.dish(dessert);
+        record.sweetness_level = dessert.getSweetnessLevel();
+        record.flavor_profile = static_cast<std::uint8_t>(dessert.getFlavorProfile());
+        record.contains_nuts = dessert.containsNuts();
+        dessert_records.push_back(record);
+    }
+
+    std::vector<unsigned char> out(sizeof(Header), 0);
+    Header header = {};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.header_size = sizeof(Header);
+    expectedRecordSizes(header.record_sizes);
+    header.strings = appendSection(out, builder.pool_.data(), builder.pool_.size(), builder.pool_.size());
+    header.ingredients = appendRecords(out, builder.ingredients_);
+    header.side_dishes = appendRecords(out, builder.side_dishes_);
+    header.appetizers = appendRecords(out, appetizer_records);
+    header.main_courses = appendRecords(out, main_course_records);
+    header.desserts = appendRecords(out, dessert_records);
+    header.file_size = out.size();
+    std::memcpy(out.data(), &header, sizeof(Header));
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        throw std::runtime_error("MenuSnapshot: cannot create " + path);
+    }
+    const bool written = std::fwrite(out.data(), 1, out.size(), file) == out.size();
+    if (std::fclose(file) != 0 || !written) {
+        throw std::runtime_error("MenuSnapshot: cannot write " + path);
+    }
+}
+
+MenuSnapshot MenuSnapshot::open(const std::string& path, bool verify) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("MenuSnapshot: cannot open " + path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(Header)) {
+        ::close(fd);
+        throw std::runtime_error("MenuSnapshot: " + path + " is too small to be a snapshot");
+    }
+    const std::size_t size = static_cast<std::size_t>(info.st_size);
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("MenuSnapshot: cannot map " + path);
+    }
+
+    MenuSnapshot snapshot;
+    snapshot.data_ = static_cast<const unsigned char*>(mapping);
+    snapshot.size_ = size;
+
+    Header header;
+    std::memcpy(&header, snapshot.data_, sizeof(Header));
+    std::uint32_t sizes[5];
+    expectedRecordSizes(sizes);
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("MenuSnapshot: " + path + " is not a menu snapshot");
+    }
+    if (header.version != kVersion || header.header_size != sizeof(Header) || std::memcmp(header.record_sizes, sizes, sizeof(sizes)) != 0) {
+        throw std::runtime_error("MenuSnapshot: " + path + " has an unsupported version or layout");
+    }
+    if (header.file_size != size
+        || !sectionFits(header.strings, 1, size)
+        || !sectionFits(header.ingredients, sizeof(StringRef), size)
+        || !sectionFits(header.side_dishes, sizeof(SideDishRecord), size)
+        || !sectionFits(header.appetizers, sizeof(AppetizerRecord), size)
+        || !sectionFits(header.main_courses, sizeof(MainCourseRecord), size)
+        || !sectionFits(header.desserts, sizeof(DessertRecord), size)) {
+        throw std::runtime_error("MenuSnapshot: " + path + " is truncated or corrupt");
+    }
+
+    snapshot.strings_ = reinterpret_cast<const char*>(snapshot.data_ + header.strings.offset);
+    snapshot.ingredients_ = reinterpret_cast<const StringRef*>(snapshot.data_ + header.ingredients.offset);
+    snapshot.side_dishes_ = reinterpret_cast<const SideDishRecord*>(snapshot.data_ + header.side_dishes.offset);
+    snapshot.appetizers_ = reinterpret_cast<const AppetizerRecord*>(snapshot.data_ + header.appetizers.offset);
+    snapshot.main_courses_ = reinterpret_cast<const MainCourseRecord*>(snapshot.data_ + header.main_courses.offset);
+    snapshot.desserts_ = reinterpret_cast<const DessertRecord*>(snapshot.data_ + header.desserts.offset);
+    snapshot.appetizer_count_ = header.appetizers.count;
+    snapshot.main_course_count_ = header.main_courses.count;
+    snapshot.dessert_count_ = header.desserts.count;
+
+    if (verify) {
+        snapshot.verifyRecords(header.strings.count, header.ingredients.count, header.side_dishes.count);
+    }
+    return snapshot;
+}
+
+// Helper functions
+
+void MenuSnapshot::close() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<unsigned char*>(data_), size_);
+        data_ = nullptr;
+    }
+}
+
+void MenuSnapshot::verifyRecords(std::size_t string_bytes, std::size_t ingredient_count, std::size_t side_dish_count) const {
+    auto checkString = [string_bytes](StringRef ref) {
+        if (ref.offset > string_bytes || ref.length > string_bytes - ref.offset) {
+            throw std::runtime_error("MenuSnapshot: string reference out of bounds");
+        }
+    };
+    auto checkDish = [&](const DishRecord& record) {
+        checkString(record.name);
+        if (record.ingredients_begin > ingredient_count || record.ingredient_count > ingredient_count - record.ingredients_begin) {
+            throw std::runtime_error("MenuSnapshot: ingredient list out of bounds");
+        }
+    };
+    for (std::size_t i = 0; i < ingredient_count; ++i) {
+        checkString(ingredients_[i]);
+    }
+    for (std::size_t i = 0; i < side_dish_count; ++i) {
+        checkString(side_dishes_[i].name);
+    }
+    for (std::size_t i = 0; i < appetizer_count_; ++i) {
+        checkDish(appetizers_[i].dish);
+    }
+    for (std::size_t i = 0; i < main_course_count_; ++i) {
+        checkDish(main_courses_[i].dish);
+        checkString(main_courses_[i].protein_type);
+        if (main_courses_[i].side_dishes_begin > side_dish_count
+            || main_courses_[i].side_dish_count > side_dish_count - main_courses_[i].side_dishes_begin) {
+            throw std::runtime_error("MenuSnapshot: side-dish list out of bounds");
+        }
+    }
+    for (std::size_t i = 0; i < dessert_count_; ++i) {
+        checkDish(desserts_[i].dish);
+    }
+}
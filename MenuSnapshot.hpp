@@ -0,0 +1,226 @@
+/**
+ * @file MenuSnapshot.hpp
+ * @brief This file contains the declaration of the MenuSnapshot class, a versioned binary menu file that is memory-mapped
+ * and read in place.
+ *
+ * File layout (native byte order, every section 8-byte aligned):
+ * - Header: magic "BSTRSNAP", format version, file size and the offset/count of every section.
+ * - String pool: the bytes of every distinct name, ingredient, protein type and side-dish name, stored once.
+ * - Ingredient lists: StringRef entries; each dish record points at a run of them.
+ * - Side dishes: SideDishRecord entries; each main-course record points at a run of them.
+ * - Appetizer, main-course and dessert sections: fixed-layout records, one per dish.
+ * Opening a snapshot maps the file and checks the header and section bounds; the views returned by
+ * appetizer(), mainCourse() and dessert() read the mapped records directly without building any object.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef MENU_SNAPSHOT_HPP
+#define MENU_SNAPSHOT_HPP
+
+#include "Appetizer.hpp"
+#include "Dessert.hpp"
+#include "Dish.hpp"
+#include "MainCourse.hpp"
+#include "Span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class MenuSnapshot {
+public:
+    static constexpr std::uint32_t kVersion = 1;
+
+    // On-disk records
+    struct StringRef {
+        std::uint32_t offset;  // into the string pool
+        std::uint32_t length;
+    };
+
+    struct DishRecord {
+        StringRef name;
+        std::uint32_t ingredients_begin;  // index into the ingredient-list section
+        std::uint32_t ingredient_count;
+        double price;
+        std::int32_t prep_time;
+        std::uint8_t cuisine_type;
+        std::uint8_t reserved[3];
+    };
+
+    struct AppetizerRecord {
+        DishRecord dish;
+        std::int32_t spiciness_level;
+        std::uint8_t serving_style;
+        std::uint8_t vegetarian;
+        std::uint8_t reserved[2];
+    };
+
+    struct MainCourseRecord {
+        DishRecord dish;
+        StringRef protein_type;
+        std::uint32_t side_dishes_begin;  // index into the side-dish section
+        std::uint32_t side_dish_count;
+        std::uint8_t cooking_method;
+        std::uint8_t gluten_free;
+        std::uint8_t reserved[6];
+    };
+
+    struct DessertRecord {
+        DishRecord dish;
+        std::int32_t sweetness_level;
+        std::uint8_t flavor_profile;
+        std::uint8_t contains_nuts;
+        std::uint8_t reserved[2];
+    };
+
+    struct SideDishRecord {
+        StringRef name;
+        std::uint32_t category;
+    };
+
+    // Read-only views of mapped records; valid while the snapshot is open
+    class DishView {
+    public:
+        std::string_view getName() const { return snapshot_->string(record_->name); }
+        std::size_t getIngredientCount() const { return record_->ingredient_count; }
+        std::string_view getIngredient(std::size_t index) const {
+            return snapshot_->string(snapshot_->ingredients_[record_->ingredients_begin + index]);
+        }
+        int getPrepTime() const { return record_->prep_time; }
+        double getPrice() const { return record_->price; }
+        Dish::CuisineType getCuisine() const { return static_cast<Dish::CuisineType>(record_->cuisine_type); }
+
+    protected:
+        DishView(const MenuSnapshot* snapshot, const DishRecord* record) : snapshot_(snapshot), record_(record) {}
+        const MenuSnapshot* snapshot_;
+        const DishRecord* record_;
+
+        // Copies the common fields into a Dish (or subclass) object
+        void fill(Dish& dish) const;
+    };
+
+    class AppetizerView : public DishView {
+    public:
+        Appetizer::ServingStyle getServingStyle() const { return static_cast<Appetizer::ServingStyle>(record()->serving_style); }
+        int getSpicinessLevel() const { return record()->spiciness_level; }
+        bool isVegetarian() const { return record()->vegetarian != 0; }
+
+        /**
+         * @param allocator The allocator for the new object's strings and lists (default is the default memory resource).
+         * @return A full Appetizer object holding the same values.
+         */
+        Appetizer materialize(const Dish::allocator_type& allocator = {}) const;
+
+    private:
+        friend class MenuSnapshot;
+        AppetizerView(const MenuSnapshot* snapshot, const AppetizerRecord* record) : DishView(snapshot, &record->dish) {}
+        const AppetizerRecord* record() const { return reinterpret_cast<const AppetizerRecord*>(record_); }
+    };
+
+    class MainCourseView : public DishView {
+    public:
+        MainCourse::CookingMethod getCookingMethod() const { return static_cast<MainCourse::CookingMethod>(record()->cooking_method); }
+        std::string_view getProteinType() const { return snapshot_->string(record()->protein_type); }
+        bool isGlutenFree() const { return record()->gluten_free != 0; }
+        std::size_t getSideDishCount() const { return record()->side_dish_count; }
+        std::string_view getSideDishName(std::size_t index) const {
+            return snapshot_->string(snapshot_->side_dishes_[record()->side_dishes_begin + index].name);
+        }
+        MainCourse::Category getSideDishCategory(std::size_t index) const {
+            return static_cast<MainCourse::Category>(snapshot_->side_dishes_[record()->side_dishes_begin + index].category);
+        }
+
+        /**
+         * @param allocator The allocator for the new object's strings and lists (default is the default memory resource).
+         * @return A full MainCourse object holding the same values.
+         */
+        MainCourse materialize(const Dish::allocator_type& allocator = {}) const;
+
+    private:
+        friend class MenuSnapshot;
+        MainCourseView(const MenuSnapshot* snapshot, const MainCourseRecord* record) : DishView(snapshot, &record->dish) {}
+        const MainCourseRecord* record() const { return reinterpret_cast<const MainCourseRecord*>(record_); }
+    };
+
+    class DessertView : public DishView {
+    public:
+        Dessert::FlavorProfile getFlavorProfile() const { return static_cast<Dessert::FlavorProfile>(record()->flavor_profile); }
+        int getSweetnessLevel() const { return record()->sweetness_level; }
+        bool containsNuts() const { return record()->contains_nuts != 0; }
+
+        /**
+         * @param allocator The allocator for the new object's strings and lists (default is the default memory resource).
+         * @return A full Dessert object holding the same values.
+         */
+        Dessert materialize(const Dish::allocator_type& allocator = {}) const;
+
+    private:
+        friend class MenuSnapshot;
+        DessertView(const MenuSnapshot* snapshot, const DessertRecord* record) : DishView(snapshot, &record->dish) {}
+        const DessertRecord* record() const { return reinterpret_cast<const DessertRecord*>(record_); }
+    };
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates a closed snapshot with no dishes.
+     */
+    MenuSnapshot();
+
+    MenuSnapshot(const MenuSnapshot&) = delete;
+    MenuSnapshot& operator=(const MenuSnapshot&) = delete;
+    MenuSnapshot(MenuSnapshot&& other) noexcept;
+    MenuSnapshot& operator=(MenuSnapshot&& other) noexcept;
+    ~MenuSnapshot();
+
+    /**
+     * Writes a snapshot file.
+     * @param path The file to create or overwrite.
+     * @param appetizers, main_courses, desserts The dishes to store, in order.
+     * @throw std::runtime_error if the file cannot be written.
+     */
+    static void write(const std::string& path, Span<const Appetizer> appetizers, Span<const MainCourse> main_courses,
+                      Span<const Dessert> desserts);
+
+    /**
+     * Maps a snapshot file read-only.
+     * @param path The file to open.
+     * @param verify When true, every record's string and list references are bounds-checked as well (default false:
+     *        only the header and section bounds are checked, which keeps opening independent of the menu size).
+     * @throw std::runtime_error if the file cannot be mapped or is not a valid snapshot of this version.
+     */
+    static MenuSnapshot open(const std::string& path, bool verify = false);
+
+    // Accessors
+    bool isOpen() const { return data_ != nullptr; }
+    std::size_t appetizerCount() const { return appetizer_count_; }
+    std::size_t mainCourseCount() const { return main_course_count_; }
+    std::size_t dessertCount() const { return dessert_count_; }
+
+    AppetizerView appetizer(std::size_t index) const { return AppetizerView(this, appetizers_ + index); }
+    MainCourseView mainCourse(std::size_t index) const { return MainCourseView(this, main_courses_ + index); }
+    DessertView dessert(std::size_t index) const { return DessertView(this, desserts_ + index); }
+
+private:
+    const unsigned char* data_;
+    std::size_t size_;
+    const char* strings_;
+    const StringRef* ingredients_;
+    const SideDishRecord* side_dishes_;
+    const AppetizerRecord* appetizers_;
+    const MainCourseRecord* main_courses_;
+    const DessertRecord* desserts_;
+    std::size_t appetizer_count_;
+    std::size_t main_course_count_;
+    std::size_t dessert_count_;
+
+    std::string_view string(StringRef ref) const { return std::string_view(strings_ + ref.offset, ref.length); }
+
+    // Helper functions to release the mapping and to check every record reference
+    void close();
+    void verifyRecords(std::size_t string_bytes, std::size_t ingredient_count, std::size_t side_dish_count) const;
+};
+
+#endif // MENU_SNAPSHOT_HPP
@@ -0,0 +1,74 @@
+/**
+ * @file MenuStats.cpp
+ * @brief This file contains the implementation of the MenuStats class, running aggregates of a menu that are
+ * updated in constant time on every change instead of being recomputed by a scan.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "MenuStats.hpp"
+#include "Menu.hpp"
+
+// Default Constructor
+MenuStats::MenuStats() : dish_count_(0), total_price_cents_(0), total_prep_time_(0), cuisine_counts_() {}
+
+MenuStats MenuStats::compute(const Menu& menu) {
+    MenuStats stats;
+    menu.forEach([&stats](const Dish& dish) { stats.add(dish); });
+    return stats;
+}
+
+bool MenuStats::matches(const MenuStats& other) const {
+    return dish_count_ == other.dish_count_ && total_price_cents_ == other.total_price_cents_ &&
+           total_prep_time_ == other.total_prep_time_ && cuisine_counts_ == other.cuisine_counts_;
+}
+
+void MenuStats::add(const Dish& dish) {
+    ++dish_count_;
+    apply(dish, DishField::PRICE, 1);
+    apply(dish, DishField::PREP_TIME, 1);
+    apply(dish, DishField::CUISINE_TYPE, 1);
+}
+
+void MenuStats::remove(const Dish& dish) {
+    --dish_count_;
+    apply(dish, DishField::PRICE, -1);
+    apply(dish, DishField::PREP_TIME, -1);
+    apply(dish, DishField::CUISINE_TYPE, -1);
+}
+
+void MenuStats::clear() {
+    *this = MenuStats();
+}
+
+void MenuStats::dishChanging(const Dish& dish, DishField field) {
+    apply(dish, field, -1);
+}
+
+void MenuStats::dishChanged(const Dish& dish, DishField field) {
+    apply(dish, field, 1);
+}
+
+// Helper functions
+
+std::size_t MenuStats::slotOf(Dish::CuisineType cuisine) {
+    const auto slot = static_cast<std::size_t>(cuisine);
+    return slot < kCuisineCount ? slot : static_cast<std::size_t>(Dish::CuisineType::OTHER);
+}
+
+void MenuStats::apply(const Dish& dish, DishField field, int sign) {
+    switch (field) {
+        case DishField::PRICE:
+            total_price_cents_ += static_cast<std::int64_t>(sign) * dish.getPriceCents();  // in 64 bits: -1 * INT32_MIN overflows int
+            break;
+        case DishField::PREP_TIME:
+            total_prep_time_ += static_cast<std::int64_t>(sign) * dish.getPrepTime();
+            break;
+        case DishField::CUISINE_TYPE:
+            cuisine_counts_[slotOf(dish.getCuisine())] += static_cast<std::size_t>(sign);
+            break;
+        default:
+            break;
+    }
+}
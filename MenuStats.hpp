@@ -0,0 +1,128 @@
+/**
+ * @file MenuStats.hpp
+ * @brief This file contains the declaration of the MenuStats class, running aggregates of a menu that are updated
+ * in constant time on every change instead of being recomputed by a scan.
+ *
+ * MenuStats keeps the dish count, the total price, the total preparation time and the number of dishes per cuisine.
+ * As a DishObserver it retracts a dish's old price, preparation time or cuisine in dishChanging() and adds the new
+ * one in dishChanged(), so a query is a handful of loads whatever the menu size. Every Menu owns one (see
+ * Menu::stats()) that follows the dishes added through it and the changes made through the setters.
+ *
+ * Every aggregate is an integer, the total price included (dishes store their price in cents), so the running
+ * values never drift from a fresh sum however many updates they absorb. Assigning a whole dish over one on the menu
+ * bypasses the setters and is not tracked; compute() and matches() detect such a mismatch.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef MENU_STATS_HPP
+#define MENU_STATS_HPP
+
+#include "Dish.hpp"
+#include "DishObserver.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+class Menu;
+
+class MenuStats : public DishObserver {
+public:
+    static constexpr std::size_t kCuisineCount = static_cast<std::size_t>(Dish::CuisineType::OTHER) + 1;
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates the statistics of an empty menu.
+     */
+    MenuStats();
+
+    /**
+     * Computes the statistics of a menu with a full scan, for checking the running ones.
+     * @param menu The menu.
+     * @return The statistics.
+     */
+    static MenuStats compute(const Menu& menu);
+
+    // Accessors
+    /**
+     * @return The number of dishes.
+     */
+    std::size_t dishCount() const { return dish_count_; }
+
+    /**
+     * @return The sum of the prices of every dish (the total menu value).
+     */
+    double totalPrice() const { return static_cast<double>(total_price_cents_) / 100.0; }
+
+    /**
+     * @return The sum of the prices of every dish in cents, exact.
+     */
+    std::int64_t totalPriceCents() const { return total_price_cents_; }
+
+    /**
+     * @return The mean price, or 0 if there are no dishes.
+     */
+    double meanPrice() const { return dish_count_ == 0 ? 0.0 : totalPrice() / static_cast<double>(dish_count_); }
+
+    /**
+     * @return The sum of the preparation times of every dish, in minutes.
+     */
+    std::int64_t totalPrepTime() const { return total_prep_time_; }
+
+    /**
+     * @return The mean preparation time in minutes, or 0 if there are no dishes.
+     */
+    double meanPrepTime() const {
+        return dish_count_ == 0 ? 0.0 : static_cast<double>(total_prep_time_) / static_cast<double>(dish_count_);
+    }
+
+    /**
+     * @param cuisine A cuisine type; out-of-range values count as OTHER.
+     * @return The number of dishes of that cuisine.
+     */
+    std::size_t cuisineCount(Dish::CuisineType cuisine) const { return cuisine_counts_[slotOf(cuisine)]; }
+
+    /**
+     * Compares with other statistics; every aggregate must be equal.
+     * @param other The statistics to compare with (typically compute() of the same menu).
+     * @return True if they agree.
+     */
+    bool matches(const MenuStats& other) const;
+
+    // Mutators
+    /**
+     * Counts a dish.
+     * @param dish The dish.
+     */
+    void add(const Dish& dish);
+
+    /**
+     * Stops counting a dish.
+     * @param dish The dish, holding the values it was counted with.
+     */
+    void remove(const Dish& dish);
+
+    /**
+     * Resets to the statistics of an empty menu.
+     */
+    void clear();
+
+    // DishObserver
+    void dishChanging(const Dish& dish, DishField field) override;
+    void dishChanged(const Dish& dish, DishField field) override;
+    void dishesCleared() override { clear(); }
+
+private:
+    std::size_t dish_count_;
+    std::int64_t total_price_cents_;
+    std::int64_t total_prep_time_;
+    std::array<std::size_t, kCuisineCount> cuisine_counts_;
+
+    // Helper functions: the counter of a cuisine, and adding (sign 1) or retracting (sign -1) one field of a dish
+    static std::size_t slotOf(Dish::CuisineType cuisine);
+    void apply(const Dish& dish, DishField field, int sign);
+};
+
+#endif // MENU_STATS_HPP
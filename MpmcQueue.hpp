@@ -0,0 +1,139 @@
+/**
+ * @file MpmcQueue.hpp
+ * @brief This file contains the MpmcQueue class template, a bounded lock-free multi-producer multi-consumer queue.
+ *
+ * The queue is a ring of cells, each with a sequence number that tells producers and consumers whose turn the
+ * cell is (Dmitry Vyukov's bounded MPMC design). A push or pop claims a position with one compare-and-swap on the
+ * tail or head counter and then hands the cell over by publishing its sequence number, so threads never wait on
+ * each other except when the queue is full or empty. The two counters live on separate cache lines. Capacity is
+ * rounded up to a power of two.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef MPMC_QUEUE_HPP
+#define MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template <typename T>
+class MpmcQueue {
+public:
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                  "MpmcQueue elements must move without throwing");
+
+    // Constructors
+    /**
+     * Parameterized constructor.
+     * @param capacity The maximum number of queued elements, rounded up to a power of two (at least 2).
+     */
+    explicit MpmcQueue(std::size_t capacity) : mask_(roundUp(capacity) - 1), cells_(new Cell[mask_ + 1]) {
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    // Accessors
+    /**
+     * @return The maximum number of queued elements.
+     */
+    std::size_t capacity() const { return mask_ + 1; }
+
+    /**
+     * @return The number of queued elements; only a snapshot while other threads push or pop.
+     */
+    std::size_t sizeApprox() const {
+        const std::size_t tail = tail_.value.load(std::memory_order_relaxed);
+        const std::size_t head = head_.value.load(std::memory_order_relaxed);
+        return tail >= head ? tail - head : 0;
+    }
+
+    // Queue operations
+    /**
+     * Appends an element unless the queue is full.
+     * @param value The element; it is moved from only on success.
+     * @return True if the element was queued.
+     */
+    bool tryPush(T& value) {
+        std::size_t position = tail_.value.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[position & mask_];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto lag = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (lag == 0) {
+                if (tail_.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (lag < 0) {
+                return false;  // the cell still holds the element pushed one lap ago: full
+            } else {
+                position = tail_.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool tryPush(T&& value) { return tryPush(value); }
+
+    /**
+     * Removes the oldest element unless the queue is empty.
+     * @param value Receives the element on success.
+     * @return True if an element was removed.
+     */
+    bool tryPop(T& value) {
+        std::size_t position = head_.value.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[position & mask_];
+            const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto lag = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+            if (lag == 0) {
+                if (head_.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (lag < 0) {
+                return false;  // the producer for this position has not published yet: empty
+            } else {
+                position = head_.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t kCacheLine = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    // A counter alone on its cache line, so producers and consumers do not invalidate each other's line
+    struct alignas(kCacheLine) Counter {
+        std::atomic<std::size_t> value{0};
+    };
+
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    Counter tail_;  // next position to push
+    Counter head_;  // next position to pop
+
+    static std::size_t roundUp(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        return size;
+    }
+};
+
+#endif // MPMC_QUEUE_HPP
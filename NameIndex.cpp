@@ -0,0 +1,316 @@
+/**
+ * @file NameIndex.cpp
+ * @brief This file contains the implementation of the NameIndex class, a trigram index over dish names for fuzzy
+ * search and prefix autocomplete as the user types.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "NameIndex.hpp"
+#include "Instrumentation.hpp"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+namespace {
+
+// Trigram symbols: 0 for the word padding, 1 to 26 for the letters
+constexpr std::size_t kSymbolCount = 27;
+constexpr std::size_t kTrigramCount = kSymbolCount * kSymbolCount * kSymbolCount;
+
+unsigned symbolOf(char c) {
+    return c == ' ' ? 0u : static_cast<unsigned>(c - 'a') + 1u;
+}
+
+// Returns the lower-case form of an ASCII letter, or 0 for any other character (locale-independent, so every
+// indexed character has a trigram symbol)
+char lowerLetter(char c) {
+    if (c >= 'a' && c <= 'z') {
+        return c;
+    }
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : '\0';
+}
+
+bool startsWith(std::string_view text, std::string_view prefix) {
+    return text.substr(0, prefix.size()) == prefix;
+}
+
+// Inserts a value into a sorted vector, appending directly when it is the largest
+template <typename T>
+void insertSorted(std::vector<T>& values, T value) {
+    if (values.empty() || values.back() < value) {
+        values.push_back(value);
+    } else {
+        values.insert(std::lower_bound(values.begin(), values.end(), value), value);
+    }
+}
+
+template <typename T>
+void eraseSorted(std::vector<T>& values, T value) {
+    auto it = std::lower_bound(values.begin(), values.end(), value);
+    if (it != values.end() && *it == value) {
+        values.erase(it);
+    }
+}
+
+} // namespace
+
+// Default Constructor
+NameIndex::NameIndex() : postings_(kTrigramCount), dish_count_(0) {}
+
+std::vector<NameIndex::Match> NameIndex::search(std::string_view query, std::size_t limit, double min_score) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::NAME_QUERY);
+    const std::vector<std::uint16_t> codes = trigramsOf(normalize(query.substr(0, kMaxQueryLength)));
+    if (codes.empty() || limit == 0) {
+        return {};
+    }
+
+    // Count the trigrams each term shares with the query; a capped query has fewer than 256 trigrams. A term is
+    // appended to `touched` without a branch (the slot is kept only on its first hit), since whether a hit is the
+    // first is unpredictable
+    std::size_t scan_length = 0;
+    for (std::uint16_t code : codes) {
+        scan_length += postings_[code].size();
+    }
+    std::vector<std::uint8_t> shared(term_sizes_.size(), 0);
+    std::unique_ptr<TermId[]> touched(new TermId[std::min(scan_length, term_sizes_.size()) + 1]);
+    std::size_t touched_count = 0;
+    for (std::uint16_t code : codes) {
+        for (TermId term : postings_[code]) {
+            touched[touched_count] = term;
+            touched_count += shared[term]++ == 0 ? 1 : 0;
+        }
+    }
+
+    // Keep the terms with shared / (query + term - shared) >= min_score, tested without dividing; the trigram counts
+    // are read from the dense term_sizes_ rather than from each Term
+    struct Candidate {
+        double score;
+        TermId term;
+    };
+    std::vector<Candidate> candidates;
+    const double query_size = static_cast<double>(codes.size());
+    for (std::size_t i = 0; i < touched_count; ++i) {
+        const TermId term = touched[i];
+        const double common = shared[term];
+        const double union_size = query_size + term_sizes_[term] - common;
+        if (common >= min_score * union_size) {
+            candidates.push_back({common / union_size, term});
+        }
+    }
+
+    // Every term has at least one dish, so the best `limit` terms cover the result
+    const std::size_t keep = std::min(limit, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(keep), candidates.end(),
+                      [this](const Candidate& a, const Candidate& b) {
+                          return a.score != b.score ? a.score > b.score : term_data_[a.term].name < term_data_[b.term].name;
+                      });
+    std::vector<Match> matches;
+    for (std::size_t i = 0; i < keep && matches.size() < limit; ++i) {
+        for (DishId id : term_data_[candidates[i].term].dishes) {
+            if (matches.size() == limit) {
+                break;
+            }
+            matches.push_back({id, candidates[i].score});
+        }
+    }
+    return matches;
+}
+
+std::vector<DishId> NameIndex::complete(std::string_view prefix, std::size_t limit) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::NAME_QUERY);
+    std::string normalized = normalize(prefix.substr(0, kMaxQueryLength));
+    if (normalized.empty() || limit == 0) {
+        return {};
+    }
+    if (lowerLetter(prefix.back()) == '\0') {
+        normalized += ' ';  // a finished word only completes to names that continue after it
+    }
+
+    std::vector<DishId> ids;
+    std::vector<TermId> emitted;
+    auto emit = [&](TermId term) {
+        emitted.push_back(term);
+        for (DishId id : term_data_[term].dishes) {
+            if (ids.size() == limit) {
+                break;
+            }
+            ids.push_back(id);
+        }
+    };
+    for (auto it = terms_.lower_bound(normalized); it != terms_.end() && ids.size() < limit && startsWith(it->first, normalized); ++it) {
+        emit(it->second);
+    }
+    for (auto it = word_starts_.lower_bound({normalized, 0}); it != word_starts_.end() && ids.size() < limit && startsWith(it->first, normalized);
+         ++it) {
+        if (std::find(emitted.begin(), emitted.end(), it->second) == emitted.end()) {
+            emit(it->second);
+        }
+    }
+    return ids;
+}
+
+std::size_t NameIndex::memoryUsage() const {
+    // Red-black tree nodes hold three pointers and a color besides the value
+    constexpr std::size_t kNodeOverhead = 4 * sizeof(void*);
+    std::size_t bytes = postings_.capacity() * sizeof(std::vector<TermId>) + dish_terms_.capacity() * sizeof(TermId) +
+                        term_data_.capacity() * sizeof(Term) + term_sizes_.capacity() * sizeof(std::uint16_t) + free_terms_.capacity() * sizeof(TermId);
+    for (const std::vector<TermId>& postings : postings_) {
+        bytes += postings.capacity() * sizeof(TermId);
+    }
+    for (const Term& term : term_data_) {
+        bytes += term.dishes.capacity() * sizeof(DishId);
+    }
+    for (const auto& entry : terms_) {
+        bytes += kNodeOverhead + sizeof(entry) + (entry.first.capacity() > 15 ? entry.first.capacity() + 1 : 0);
+    }
+    bytes += word_starts_.size() * (kNodeOverhead + sizeof(std::pair<std::string_view, TermId>));
+    return bytes;
+}
+
+void NameIndex::add(const Dish& dish) {
+    const DishId id = dish.getId();
+    if (id == kNoDishId) {
+        throw std::invalid_argument("NameIndex::add: dish has no ID");
+    }
+    if (contains(id)) {
+        return;
+    }
+    if (id >= dish_terms_.size()) {
+        dish_terms_.resize(static_cast<std::size_t>(id) + 1, kNoTerm);
+    }
+    assign(id, dish.getNameView());
+    ++dish_count_;
+}
+
+void NameIndex::remove(const Dish& dish) {
+    if (!contains(dish.getId())) {
+        return;
+    }
+    detach(dish.getId());
+    --dish_count_;
+}
+
+void NameIndex::clear() {
+    word_starts_.clear();  // views into the keys of terms_
+    terms_.clear();
+    term_data_.clear();
+    term_sizes_.clear();
+    free_terms_.clear();
+    for (std::vector<TermId>& postings : postings_) {
+        postings.clear();
+    }
+    dish_terms_.clear();
+    dish_count_ = 0;
+}
+
+void NameIndex::dishChanged(const Dish& dish, DishField field) {
+    if (field == DishField::NAME && contains(dish.getId())) {
+        assign(dish.getId(), dish.getNameView());
+    }
+}
+
+// Helper functions
+
+std::string NameIndex::normalize(std::string_view text) {
+    std::string normalized;
+    normalized.reserve(text.size());
+    for (char c : text) {
+        if (const char letter = lowerLetter(c)) {
+            normalized += letter;
+        } else if (!normalized.empty() && normalized.back() != ' ') {
+            normalized += ' ';
+        }
+    }
+    if (!normalized.empty() && normalized.back() == ' ') {
+        normalized.pop_back();
+    }
+    return normalized;
+}
+
+std::vector<std::uint16_t> NameIndex::trigramsOf(std::string_view normalized) {
+    std::vector<std::uint16_t> codes;
+    std::size_t begin = 0;
+    while (begin < normalized.size()) {
+        const std::size_t end = std::min(normalized.find(' ', begin), normalized.size());
+        // Trigrams of " word ": the padding marks the start and the end of the word
+        unsigned previous = 0;
+        unsigned current = symbolOf(normalized[begin]);
+        for (std::size_t i = begin + 1; i <= end; ++i) {
+            const unsigned next = i < end ? symbolOf(normalized[i]) : 0u;
+            codes.push_back(static_cast<std::uint16_t>((previous * kSymbolCount + current) * kSymbolCount + next));
+            previous = current;
+            current = next;
+        }
+        begin = end + 1;
+    }
+    std::sort(codes.begin(), codes.end());
+    codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+    return codes;
+}
+
+void NameIndex::assign(DishId id, std::string_view name) {
+    std::string normalized = normalize(name);
+    auto it = terms_.find(normalized);
+    const TermId term = it != terms_.end() ? it->second : acquireTerm(std::move(normalized));
+    if (dish_terms_[id] == term) {
+        return;
+    }
+    if (dish_terms_[id] != kNoTerm) {
+        detach(id);
+    }
+    insertSorted(term_data_[term].dishes, id);
+    dish_terms_[id] = term;
+}
+
+void NameIndex::detach(DishId id) {
+    const TermId term = dish_terms_[id];
+    eraseSorted(term_data_[term].dishes, id);
+    dish_terms_[id] = kNoTerm;
+    if (term_data_[term].dishes.empty()) {
+        releaseTerm(term);
+    }
+}
+
+NameIndex::TermId NameIndex::acquireTerm(std::string normalized) {
+    TermId term;
+    if (!free_terms_.empty()) {
+        term = free_terms_.back();
+        free_terms_.pop_back();
+    } else {
+        term = static_cast<TermId>(term_data_.size());
+        term_data_.emplace_back();
+        term_sizes_.push_back(0);
+    }
+    const std::string_view name = terms_.emplace(std::move(normalized), term).first->first;
+    const std::vector<std::uint16_t> codes = trigramsOf(name);
+    for (std::uint16_t code : codes) {
+        insertSorted(postings_[code], term);
+    }
+    for (std::size_t i = 1; i < name.size(); ++i) {
+        if (name[i - 1] == ' ') {
+            word_starts_.emplace(name.substr(i), term);
+        }
+    }
+    term_data_[term].name = name;
+    term_sizes_[term] = static_cast<std::uint16_t>(std::min<std::size_t>(codes.size(), std::numeric_limits<std::uint16_t>::max()));
+    return term;
+}
+
+void NameIndex::releaseTerm(TermId term) {
+    const std::string_view name = term_data_[term].name;
+    for (std::uint16_t code : trigramsOf(name)) {
+        eraseSorted(postings_[code], term);
+    }
+    for (std::size_t i = 1; i < name.size(); ++i) {
+        if (name[i - 1] == ' ') {
+            word_starts_.erase({name.substr(i), term});
+        }
+    }
+    terms_.erase(terms_.find(name));
+    term_data_[term] = Term();
+    term_sizes_[term] = 0;
+    free_terms_.push_back(term);
+}
@@ -0,0 +1,145 @@
+/**
+ * @file NameIndex.hpp
+ * @brief This file contains the declaration of the NameIndex class, a trigram index over dish names for fuzzy
+ * search and prefix autocomplete as the user types.
+ *
+ * Names are normalized (lower case, runs of anything but letters collapsed to one space) and dishes with the same
+ * normalized name share one term. Each term is split into the trigrams of its words, padded as " word ", and the
+ * index keeps a sorted posting list of terms per trigram. search() counts, for every term, the trigrams it shares
+ * with the query and ranks terms by their similarity |shared| / |union|, so misspellings and reordered words still
+ * match; its cost depends on the posting lists of the query's trigrams, not on the number of dishes. complete()
+ * walks an ordered map of the terms for names that start with the prefix, then an ordered set of the later words
+ * of every name, in O(log n + limit).
+ * The index is a DishObserver: once a dish is added and observed by the index (directly or through an
+ * ObserverList), calls to setName keep its term up to date.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef NAME_INDEX_HPP
+#define NAME_INDEX_HPP
+
+#include "Dish.hpp"
+#include "DishObserver.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class NameIndex : public DishObserver {
+public:
+    // A search result: a dish and the trigram similarity of its name to the query, in (0, 1]
+    struct Match {
+        DishId id;
+        double score;
+    };
+
+    // Query characters beyond this are ignored
+    static constexpr std::size_t kMaxQueryLength = 100;
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty index.
+     */
+    NameIndex();
+
+    // Accessors
+    /**
+     * @return The number of dishes in the index.
+     */
+    std::size_t size() const { return dish_count_; }
+
+    /**
+     * @return The number of distinct normalized names in the index.
+     */
+    std::size_t termCount() const { return terms_.size(); }
+
+    /**
+     * @param id A dish ID.
+     * @return True if the dish with that ID has been added.
+     */
+    bool contains(DishId id) const { return id < dish_terms_.size() && dish_terms_[id] != kNoTerm; }
+
+    /**
+     * Ranked fuzzy search.
+     * @param query The text typed by the user; case and punctuation are ignored.
+     * @param limit The maximum number of results (default is 10).
+     * @param min_score The lowest similarity returned (default is 0.3).
+     * @return The matching dishes, best first; equal scores are ordered by name, then by ID.
+     */
+    std::vector<Match> search(std::string_view query, std::size_t limit = 10, double min_score = 0.3) const;
+
+    /**
+     * Prefix autocomplete.
+     * @param prefix The text typed so far; case and punctuation are ignored.
+     * @param limit The maximum number of results (default is 10).
+     * @return The IDs of the dishes whose name starts with the prefix, in name order, followed by those with a later
+     * word that starts with it, in the order of that word.
+     */
+    std::vector<DishId> complete(std::string_view prefix, std::size_t limit = 10) const;
+
+    /**
+     * @return The approximate heap bytes used by the index, including container nodes.
+     */
+    std::size_t memoryUsage() const;
+
+    // Mutators
+    /**
+     * Adds a dish to the index. The dish must have an ID (see Dish::setId).
+     * @param dish The dish to index.
+     */
+    void add(const Dish& dish);
+
+    /**
+     * Removes a dish from the index.
+     * @param dish The dish to remove.
+     */
+    void remove(const Dish& dish);
+
+    /**
+     * Removes every dish from the index.
+     */
+    void clear();
+
+    // DishObserver
+    void dishChanged(const Dish& dish, DishField field) override;
+    void dishesCleared() override { clear(); }
+
+private:
+    using TermId = std::uint32_t;
+    static constexpr TermId kNoTerm = static_cast<TermId>(-1);
+
+    // A distinct normalized name and the dishes that carry it
+    struct Term {
+        std::string_view name;       // the key in terms_
+        std::vector<DishId> dishes;  // sorted
+    };
+
+    std::map<std::string, TermId, std::less<>> terms_;           // normalized name -> term, in name order
+    std::vector<Term> term_data_;                                // indexed by TermId
+    std::vector<std::uint16_t> term_sizes_;                      // trigram count per TermId, dense for the scoring pass
+    std::vector<TermId> free_terms_;                             // released TermIds, reused first
+    std::set<std::pair<std::string_view, TermId>> word_starts_;  // each later word of a term to the end of its name
+    std::vector<std::vector<TermId>> postings_;                  // sorted TermIds, indexed by trigram code
+    std::vector<TermId> dish_terms_;                             // indexed by DishId; kNoTerm if not indexed
+    std::size_t dish_count_;
+
+    // Helper functions: normalize a name or query, and list the sorted, distinct trigram codes of a normalized name
+    static std::string normalize(std::string_view text);
+    static std::vector<std::uint16_t> trigramsOf(std::string_view normalized);
+
+    // Helper functions: move a dish to the term of a name, and create or drop a term
+    void assign(DishId id, std::string_view name);
+    void detach(DishId id);
+    TermId acquireTerm(std::string normalized);
+    void releaseTerm(TermId term);
+};
+
+#endif // NAME_INDEX_HPP
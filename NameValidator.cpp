@@ -0,0 +1,227 @@
+/**
+ * @file NameValidator.cpp
+ * @brief This file contains the implementation of the dish-name validation rules.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "NameValidator.hpp"
+#include <array>
+#include <cctype>   // For std::isalpha, std::isspace
+#include <clocale>  // For std::setlocale
+#include <cstring>
+#include <locale.h>  // For uselocale
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSE2__) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NAME_VALIDATOR_HAS_AVX2 1
+#endif
+
+namespace {
+
+// The reference rules, valid in any locale
+bool validLocale(std::string_view name) {
+    for (char c : name) {
+        if (!std::isalpha(c) && !std::isspace(c)) {  // Check if each character is a letter or space
+            return false;  // Name contains non-alphabetic characters other than spaces
+        }
+    }
+    return true;  // Name is valid
+}
+
+// The same rules in the "C" locale, one table lookup per byte
+constexpr std::array<bool, 256> makeValidByteTable() {
+    std::array<bool, 256> table{};
+    for (int c = 'A'; c <= 'Z'; ++c) {
+        table[c] = true;
+        table[c - 'A' + 'a'] = true;
+    }
+    for (char c : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+        table[static_cast<unsigned char>(c)] = true;
+    }
+    return table;
+}
+
+constexpr std::array<bool, 256> kValidByte = makeValidByteTable();
+
+bool validScalar(std::string_view name) {
+    for (char c : name) {
+        if (!kValidByte[static_cast<unsigned char>(c)]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if defined(__SSE2__)
+
+// 0xFF in every byte that is a letter or whitespace. Unsigned range checks (x - low) < width are done as signed
+// compares after flipping the sign bit, since SSE2 has no unsigned byte compare.
+inline __m128i validBytes(__m128i bytes) {
+    const __m128i sign = _mm_set1_epi8(-128);
+    const __m128i folded = _mm_or_si128(bytes, _mm_set1_epi8(0x20));  // 'A'-'Z' -> 'a'-'z'
+    const __m128i letter = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(folded, _mm_set1_epi8('a')), sign), _mm_set1_epi8(-128 + 26));
+    const __m128i control = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(bytes, _mm_set1_epi8('\t')), sign), _mm_set1_epi8(-128 + 5));
+    const __m128i space = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(' '));
+    return _mm_or_si128(letter, _mm_or_si128(control, space));
+}
+
+inline bool allValid(__m128i bytes) {
+    return _mm_movemask_epi8(validBytes(bytes)) == 0xFFFF;
+}
+
+bool validSse2(std::string_view name) {
+    const char* data = name.data();
+    const std::size_t size = name.size();
+    if (size < 16) {
+        // Pad short names with spaces (which are valid) so they take one vector check without reading past the end
+        alignas(16) char padded[16];
+        std::memset(padded, ' ', sizeof(padded));
+        if (size != 0) {
+            std::memcpy(padded, data, size);
+        }
+        return allValid(_mm_load_si128(reinterpret_cast<const __m128i*>(padded)));
+    }
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        if (!allValid(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)))) {
+            return false;
+        }
+    }
+    // The last partial block is checked as the final 16 bytes, overlapping bytes already checked
+    return i == size || allValid(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + size - 16)));
+}
+
+#endif
+
+#if defined(NAME_VALIDATOR_HAS_AVX2)
+
+__attribute__((target("avx2"))) inline bool allValid256(__m256i bytes) {
+    const __m256i sign = _mm256_set1_epi8(-128);
+    const __m256i folded = _mm256_or_si256(bytes, _mm256_set1_epi8(0x20));
+    const __m256i letter = _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26), _mm256_xor_si256(_mm256_sub_epi8(folded, _mm256_set1_epi8('a')), sign));
+    const __m256i control = _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 5), _mm256_xor_si256(_mm256_sub_epi8(bytes, _mm256_set1_epi8('\t')), sign));
+    const __m256i space = _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' '));
+    return _mm256_movemask_epi8(_mm256_or_si256(letter, _mm256_or_si256(control, space))) == -1;
+}
+
+__attribute__((target("avx2"))) bool validAvx2(std::string_view name) {
+    const char* data = name.data();
+    const std::size_t size = name.size();
+    if (size < 32) {
+        return validSse2(name);
+    }
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        if (!allValid256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)))) {
+            return false;
+        }
+    }
+    return i == size || allValid256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + size - 32)));
+}
+
+bool cpuHasAvx2() {
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return has_avx2;
+}
+
+#endif
+
+// True if std::isalpha / std::isspace accept exactly the bytes of kValidByte in the calling thread's locale
+bool acceptsClassicBytes() {
+    for (int b = 0; b < 256; ++b) {
+        const char c = static_cast<char>(b);  // as validLocale passes it
+        if ((std::isalpha(c) || std::isspace(c)) != kValidByte[b]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Identifies the character classes std::isalpha reads in the calling thread: glibc keeps a per-thread pointer to the
+// ctype table of the thread's locale (set with uselocale) or of the global one; elsewhere the thread's locale_t, or
+// nullptr while the thread follows the global locale
+const void* ctypeKey() {
+#if defined(__GLIBC__)
+    return *__ctype_b_loc();
+#else
+    const locale_t locale = uselocale(static_cast<locale_t>(0));
+    return locale == LC_GLOBAL_LOCALE ? nullptr : static_cast<const void*>(locale);
+#endif
+}
+
+// True if std::isalpha / std::isspace follow the "C" locale rules. The answer is cached per thread for the last
+// locale seen, so validation takes no lock and reads no global locale state
+bool inClassicLocale() {
+    thread_local const void* cached_key = nullptr;
+    thread_local bool cached_classic = false;
+    const void* key = ctypeKey();
+    if (key == nullptr) {
+        const char* locale = std::setlocale(LC_CTYPE, nullptr);
+        return locale != nullptr && (std::strcmp(locale, "C") == 0 || std::strcmp(locale, "POSIX") == 0);
+    }
+    if (key != cached_key) {
+        cached_classic = acceptsClassicBytes();
+        cached_key = key;
+    }
+    return cached_classic;
+}
+
+using Validator = bool (*)(std::string_view);
+
+// The implementation for an instruction set, or the next narrower one this build and CPU support
+Validator validatorFor(NameValidatorIsa isa) {
+#if defined(NAME_VALIDATOR_HAS_AVX2)
+    if (isa == NameValidatorIsa::AVX2 && cpuHasAvx2()) {
+        return validAvx2;
+    }
+#endif
+#if defined(__SSE2__)
+    if (isa == NameValidatorIsa::AVX2 || isa == NameValidatorIsa::SSE2) {
+        return validSse2;
+    }
+#endif
+    return isa == NameValidatorIsa::LOCALE ? validLocale : validScalar;
+}
+
+} // namespace
+
+NameValidatorIsa activeNameValidatorIsa() {
+    if (!inClassicLocale()) {
+        return NameValidatorIsa::LOCALE;
+    }
+#if defined(NAME_VALIDATOR_HAS_AVX2)
+    if (cpuHasAvx2()) {
+        return NameValidatorIsa::AVX2;
+    }
+#endif
+#if defined(__SSE2__)
+    return NameValidatorIsa::SSE2;
+#else
+    return NameValidatorIsa::SCALAR;
+#endif
+}
+
+bool isValidDishName(std::string_view name) {
+    return validatorFor(activeNameValidatorIsa())(name);
+}
+
+Bitmap validateDishNames(Span<const std::string_view> names) {
+    return validateDishNames(names, activeNameValidatorIsa());
+}
+
+Bitmap validateDishNames(Span<const std::string_view> names, NameValidatorIsa isa) {
+    const Validator valid = validatorFor(isa);
+    Bitmap failures(names.size());
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        if (!valid(names[i])) {
+            failures.set(i);
+        }
+    }
+    return failures;
+}
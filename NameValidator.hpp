@@ -0,0 +1,55 @@
+/**
+ * @file NameValidator.hpp
+ * @brief This file contains the dish-name validation rules shared by Dish::setName and the bulk ingest paths.
+ *
+ * A name is valid when every character is alphabetic or whitespace according to std::isalpha / std::isspace
+ * (the empty name is valid). The batch form validates many names in one call and reports the failures as a bitmap.
+ *
+ * In the "C" locale those rules are exactly A-Z, a-z, space, and \t \n \v \f \r, which the validator checks 16 bytes
+ * at a time with SSE2, or 32 at a time with AVX2 when the CPU has it, with a table-driven scalar fallback on other
+ * targets. Under an LC_CTYPE locale that classifies any byte differently the validator calls std::isalpha /
+ * std::isspace byte by byte, so the result always matches the locale-dependent rules. The locale is the calling
+ * thread's (see uselocale), and the decision is cached per thread until that locale changes.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef NAME_VALIDATOR_HPP
+#define NAME_VALIDATOR_HPP
+
+#include "Bitmap.hpp"
+#include "Span.hpp"
+#include <string_view>
+
+// The implementations of the validator, from the reference rules to the widest vector code
+enum class NameValidatorIsa { LOCALE, SCALAR, SSE2, AVX2 };
+
+/**
+ * @return The implementation used by isValidDishName() and validateDishNames() in the current locale on this CPU.
+ */
+NameValidatorIsa activeNameValidatorIsa();
+
+/**
+ * @param name The name to be validated.
+ * @return True if the name contains only alphabetic characters and whitespace; false otherwise.
+ */
+bool isValidDishName(std::string_view name);
+
+/**
+ * Validates a batch of names.
+ * @param names The names to validate.
+ * @return A bitmap with one bit per name, set when the name is NOT valid.
+ */
+Bitmap validateDishNames(Span<const std::string_view> names);
+
+/**
+ * Validates a batch of names with a chosen implementation, for tests and benchmarks. An instruction set the CPU
+ * does not have falls back to the next narrower one; every choice other than LOCALE assumes the "C" locale.
+ * @param names The names to validate.
+ * @param isa The implementation to use.
+ * @return A bitmap with one bit per name, set when the name is NOT valid.
+ */
+Bitmap validateDishNames(Span<const std::string_view> names, NameValidatorIsa isa);
+
+#endif // NAME_VALIDATOR_HPP
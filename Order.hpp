@@ -0,0 +1,129 @@
+/**
+ * @file Order.hpp
+ * @brief This file contains the declaration of the Order class, a customer ticket that refers to menu dishes by
+ * DishId.
+ *
+ * An order holds up to kMaxLines lines of (dish, quantity) inline, so a ticket is a small fixed-size value that
+ * moves through queues without copying any Dish or allocating. The OrderPipeline stages fill in the status, the
+ * total and the station, and stamp the submit and completion times used for latency measurements.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef ORDER_HPP
+#define ORDER_HPP
+
+#include "DishObserver.hpp"
+#include "Span.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Identifier of an order, unique per point-of-sale terminal
+using OrderId = std::uint64_t;
+
+// One line of an order: a dish by menu position, and how many of it
+struct OrderLine {
+    DishId dish;
+    std::uint16_t quantity;
+};
+
+class Order {
+public:
+    static constexpr std::size_t kMaxLines = 12;
+
+    // How far the order has gone through the pipeline
+    enum class Status : std::uint8_t { NEW, VALIDATED, PRICED, ROUTED, REJECTED };
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty order with ID 0 from terminal 0.
+     */
+    Order() : Order(0, 0) {}
+
+    /**
+     * Parameterized constructor.
+     * @param id The ID of the order.
+     * @param terminal The terminal the order was taken on.
+     */
+    Order(OrderId id, std::uint32_t terminal)
+            : id_(id), submitted_ns_(0), completed_ns_(0), total_(0.0), terminal_(terminal), line_count_(0), station_(0),
+              status_(Status::NEW), lines_() {}
+
+    // Accessors
+    /**
+     * @return The ID of the order.
+     */
+    OrderId getId() const { return id_; }
+
+    /**
+     * @return The terminal the order was taken on.
+     */
+    std::uint32_t getTerminal() const { return terminal_; }
+
+    /**
+     * @return The lines of the order, in the order they were added.
+     */
+    Span<const OrderLine> getLines() const { return Span<const OrderLine>(lines_.data(), line_count_); }
+
+    /**
+     * @return The pipeline status of the order.
+     */
+    Status getStatus() const { return status_; }
+
+    /**
+     * @return The price of the order, once priced.
+     */
+    double getTotal() const { return total_; }
+
+    /**
+     * @return The station the order was routed to (the Menu::Kind of its longest-preparation dish), once routed.
+     */
+    std::uint8_t getStation() const { return station_; }
+
+    /**
+     * @return The steady-clock time in nanoseconds at which the order entered the pipeline.
+     */
+    std::uint64_t getSubmittedNs() const { return submitted_ns_; }
+
+    /**
+     * @return The steady-clock time in nanoseconds at which the order left the pipeline.
+     */
+    std::uint64_t getCompletedNs() const { return completed_ns_; }
+
+    // Mutators
+    /**
+     * Appends a line to the order.
+     * @param dish The menu position of the dish.
+     * @param quantity How many of the dish (default is 1).
+     * @return True if the line was added; false if the order already has kMaxLines lines.
+     */
+    bool addLine(DishId dish, std::uint16_t quantity = 1) {
+        if (line_count_ == kMaxLines) {
+            return false;
+        }
+        lines_[line_count_++] = {dish, quantity};
+        return true;
+    }
+
+    void setStatus(Status status) { status_ = status; }
+    void setTotal(double total) { total_ = total; }
+    void setStation(std::uint8_t station) { station_ = station; }
+    void setSubmittedNs(std::uint64_t time) { submitted_ns_ = time; }
+    void setCompletedNs(std::uint64_t time) { completed_ns_ = time; }
+
+private:
+    OrderId id_;
+    std::uint64_t submitted_ns_;
+    std::uint64_t completed_ns_;
+    double total_;
+    std::uint32_t terminal_;
+    std::uint8_t line_count_;
+    std::uint8_t station_;
+    Status status_;
+    std::array<OrderLine, kMaxLines> lines_;
+};
+
+#endif // ORDER_HPP
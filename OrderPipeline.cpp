@@ -0,0 +1,173 @@
+/**
+ * @file OrderPipeline.cpp
+ * @brief This file contains the implementation of the OrderPipeline class, which takes orders from concurrent
+ * point-of-sale terminals through validation, pricing and routing on dedicated threads.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "OrderPipeline.hpp"
+#include <chrono>
+#include <stdexcept>
+
+namespace {
+
+std::uint64_t nowNs() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+// Parameterized Constructors
+OrderPipeline::OrderPipeline(const Menu& menu) : OrderPipeline(menu, Config()) {}
+
+OrderPipeline::OrderPipeline(const Menu& menu, const Config& config)
+        : menu_(menu), incoming_(config.queue_capacity), validated_(config.queue_capacity), priced_(config.queue_capacity),
+          finished_(config.queue_capacity), closed_(false), running_(), submitted_(0), rejected_(0) {
+    const std::size_t threads[kStages] = {config.validators, config.pricers, config.routers};
+    for (std::size_t stage = 0; stage < kStages; ++stage) {
+        if (threads[stage] == 0) {
+            throw std::invalid_argument("OrderPipeline: every stage needs at least one thread");
+        }
+        running_[stage].store(threads[stage]);
+    }
+    for (std::size_t stage = 0; stage < kStages; ++stage) {
+        for (std::size_t i = 0; i < threads[stage]; ++i) {
+            workers_.emplace_back(&OrderPipeline::runStage, this, stage);
+        }
+    }
+}
+
+// Destructor
+OrderPipeline::~OrderPipeline() {
+    close();
+    // Drain the output so routers blocked on a full queue can finish
+    Order order;
+    while (running_[kStages - 1].load(std::memory_order_acquire) != 0) {
+        if (!finished_.tryPop(order)) {
+            std::this_thread::yield();
+        }
+    }
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+bool OrderPipeline::trySubmit(Order& order) {
+    order.setSubmittedNs(nowNs());
+    order.setStatus(Order::Status::NEW);
+    if (!incoming_.tryPush(order)) {
+        return false;
+    }
+    submitted_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void OrderPipeline::submit(Order order) {
+    while (!trySubmit(order)) {
+        std::this_thread::yield();
+    }
+}
+
+void OrderPipeline::close() {
+    closed_.store(true, std::memory_order_release);
+}
+
+bool OrderPipeline::tryTake(Order& order) {
+    return finished_.tryPop(order);
+}
+
+bool OrderPipeline::take(Order& order) {
+    for (;;) {
+        // Every push to the output happens before the last router stops, so checking in this order cannot miss one
+        const bool done = running_[kStages - 1].load(std::memory_order_acquire) == 0;
+        if (finished_.tryPop(order)) {
+            return true;
+        }
+        if (done) {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+}
+
+// Helper functions
+
+void OrderPipeline::runStage(std::size_t stage) {
+    MpmcQueue<Order>* const inputs[kStages] = {&incoming_, &validated_, &priced_};
+    MpmcQueue<Order>* const outputs[kStages] = {&validated_, &priced_, &finished_};
+    Order order;
+    for (;;) {
+        // The stage may stop once its source has stopped and its input is empty
+        const bool source_done = stage == 0 ? closed_.load(std::memory_order_acquire)
+                                            : running_[stage - 1].load(std::memory_order_acquire) == 0;
+        if (!inputs[stage]->tryPop(order)) {
+            if (source_done) {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+        switch (stage) {
+            case 0:
+                if (!validate(order)) {
+                    order.setStatus(Order::Status::REJECTED);
+                    order.setCompletedNs(nowNs());
+                    rejected_.fetch_add(1, std::memory_order_relaxed);
+                    pushWaiting(finished_, order);
+                    continue;
+                }
+                order.setStatus(Order::Status::VALIDATED);
+                break;
+            case 1:
+                price(order);
+                order.setStatus(Order::Status::PRICED);
+                break;
+            default:
+                route(order);
+                order.setStatus(Order::Status::ROUTED);
+                order.setCompletedNs(nowNs());
+                break;
+        }
+        pushWaiting(*outputs[stage], order);
+    }
+    running_[stage].fetch_sub(1, std::memory_order_release);
+}
+
+bool OrderPipeline::validate(const Order& order) const {
+    if (order.getLines().size() == 0) {
+        return false;
+    }
+    for (const OrderLine& line : order.getLines()) {
+        if (line.dish >= menu_.size() || line.quantity == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void OrderPipeline::price(Order& order) const {
+    double total = 0.0;
+    for (const OrderLine& line : order.getLines()) {
+        total += menu_[line.dish].getPrice() * line.quantity;
+    }
+    order.setTotal(total);
+}
+
+void OrderPipeline::route(Order& order) const {
+    DishId longest = order.getLines()[0].dish;
+    for (const OrderLine& line : order.getLines()) {
+        if (menu_[line.dish].getPrepTime() > menu_[longest].getPrepTime()) {
+            longest = line.dish;
+        }
+    }
+    order.setStation(static_cast<std::uint8_t>(menu_.kindAt(longest)));
+}
+
+void OrderPipeline::pushWaiting(MpmcQueue<Order>& queue, Order& order) {
+    while (!queue.tryPush(order)) {
+        std::this_thread::yield();
+    }
+}
@@ -0,0 +1,135 @@
+/**
+ * @file OrderPipeline.hpp
+ * @brief This file contains the declaration of the OrderPipeline class, which takes orders from concurrent
+ * point-of-sale terminals through validation, pricing and routing on dedicated threads.
+ *
+ * Orders travel by value through bounded lock-free MpmcQueues: terminals submit into the first queue, a pool of
+ * threads runs each stage, and finished orders wait in an output queue for the consumer. The stages are:
+ * - validate: the order has at least one line, every dish is on the menu and every quantity is positive;
+ *   otherwise the order is REJECTED and goes straight to the output;
+ * - price: the total is the sum of Dish::getPrice() times quantity;
+ * - route: the station is the Menu::Kind of the dish with the longest preparation time.
+ * A full queue pushes back on the stage (or terminal) feeding it, so memory stays bounded. The menu is read
+ * concurrently by the stages and must not change while the pipeline runs.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef ORDER_PIPELINE_HPP
+#define ORDER_PIPELINE_HPP
+
+#include "Menu.hpp"
+#include "MpmcQueue.hpp"
+#include "Order.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+class OrderPipeline {
+public:
+    // Queue sizes and the number of threads per stage
+    struct Config {
+        std::size_t queue_capacity = 1024;
+        std::size_t validators = 1;
+        std::size_t pricers = 1;
+        std::size_t routers = 1;
+    };
+
+    // Constructors
+    /**
+     * Parameterized constructor.
+     * Starts the stage threads with the default Config.
+     * @param menu The menu the orders refer to; it must outlive the pipeline and stay unchanged while it runs.
+     */
+    explicit OrderPipeline(const Menu& menu);
+
+    /**
+     * Parameterized constructor.
+     * Starts the stage threads.
+     * @param menu The menu the orders refer to; it must outlive the pipeline and stay unchanged while it runs.
+     * @param config The queue sizes and stage thread counts (each at least 1).
+     * @throw std::invalid_argument if a stage has no threads.
+     */
+    OrderPipeline(const Menu& menu, const Config& config);
+
+    OrderPipeline(const OrderPipeline&) = delete;
+    OrderPipeline& operator=(const OrderPipeline&) = delete;
+
+    /**
+     * Destructor.
+     * Closes the pipeline and joins the stage threads, discarding orders nobody took.
+     */
+    ~OrderPipeline();
+
+    // Accessors
+    /**
+     * @return The number of orders submitted so far.
+     */
+    std::size_t submitted() const { return submitted_.load(std::memory_order_relaxed); }
+
+    /**
+     * @return The number of orders rejected by validation so far.
+     */
+    std::size_t rejected() const { return rejected_.load(std::memory_order_relaxed); }
+
+    // Terminals
+    /**
+     * Submits an order unless the input queue is full. Safe to call from any number of threads.
+     * @param order The order; it is stamped with the submit time and moved into the pipeline on success.
+     * @return True if the order was accepted.
+     */
+    bool trySubmit(Order& order);
+
+    /**
+     * Submits an order, waiting while the input queue is full.
+     * @param order The order.
+     */
+    void submit(Order order);
+
+    /**
+     * Declares that no more orders will be submitted; call it after every submit() has returned. The stages finish
+     * the orders already submitted and then stop.
+     */
+    void close();
+
+    // Consumer
+    /**
+     * Takes a finished (ROUTED or REJECTED) order if one is waiting.
+     * @param order Receives the order, stamped with its completion time.
+     * @return True if an order was taken.
+     */
+    bool tryTake(Order& order);
+
+    /**
+     * Takes the next finished order, waiting for one.
+     * @param order Receives the order.
+     * @return True if an order was taken; false once the pipeline is closed and every order has been taken.
+     */
+    bool take(Order& order);
+
+private:
+    static constexpr std::size_t kStages = 3;
+
+    const Menu& menu_;
+    MpmcQueue<Order> incoming_;
+    MpmcQueue<Order> validated_;
+    MpmcQueue<Order> priced_;
+    MpmcQueue<Order> finished_;
+    std::atomic<bool> closed_;
+    std::array<std::atomic<std::size_t>, kStages> running_;  // threads still running in each stage
+    std::atomic<std::size_t> submitted_;
+    std::atomic<std::size_t> rejected_;
+    std::vector<std::thread> workers_;
+
+    // Helper functions: one stage thread, and the work of each stage on one order
+    void runStage(std::size_t stage);
+    bool validate(const Order& order) const;
+    void price(Order& order) const;
+    void route(Order& order) const;
+    static void pushWaiting(MpmcQueue<Order>& queue, Order& order);
+};
+
+#endif // ORDER_PIPELINE_HPP
@@ -0,0 +1,124 @@
+/**
+ * @file QuantileSketch.cpp
+ * @brief This file contains the implementation of the QuantileSketch class, a mergeable summary of a stream of
+ * non-negative values that answers quantile queries with bounded relative error.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "QuantileSketch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+// Values below this share the zero bucket, which bounds the number of buckets below 1
+constexpr double kMinPositive = 1e-9;
+
+} // namespace
+
+// Parameterized Constructor
+QuantileSketch::QuantileSketch(double relative_error)
+        : relative_error_(relative_error), bucket_width_(0.0), count_(0), zero_count_(0), min_(0.0), max_(0.0), offset_(0) {
+    if (!(relative_error > 0.0 && relative_error < 1.0)) {
+        throw std::invalid_argument("QuantileSketch: relative error must be in (0, 1)");
+    }
+    bucket_width_ = std::log((1.0 + relative_error) / (1.0 - relative_error));
+}
+
+double QuantileSketch::quantile(double fraction) const {
+    if (count_ == 0) {
+        return 0.0;
+    }
+    fraction = std::clamp(fraction, 0.0, 1.0);
+    const auto rank = static_cast<std::uint64_t>(fraction * static_cast<double>(count_ - 1) + 0.5);
+    if (rank == 0 || rank == count_ - 1) {
+        return rank == 0 ? min_ : max_;
+    }
+    if (rank < zero_count_) {
+        return std::clamp(0.0, min_, max_);
+    }
+    std::uint64_t seen = zero_count_;
+    for (std::size_t i = 0; i < counts_.size(); ++i) {
+        seen += counts_[i];
+        if (seen > rank) {
+            return std::clamp(representative(offset_ + static_cast<int>(i)), min_, max_);
+        }
+    }
+    return max_;
+}
+
+void QuantileSketch::add(double value) {
+    if (count_ == 0) {
+        min_ = max_ = value;
+    } else {
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+    ++count_;
+    if (!(value >= kMinPositive)) {
+        ++zero_count_;
+        return;
+    }
+    const int index = bucketOf(value);
+    grow(index);
+    ++counts_[static_cast<std::size_t>(index - offset_)];
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.relative_error_ != relative_error_) {
+        throw std::invalid_argument("QuantileSketch: cannot merge sketches with different relative errors");
+    }
+    if (other.count_ == 0) {
+        return;
+    }
+    min_ = count_ == 0 ? other.min_ : std::min(min_, other.min_);
+    max_ = count_ == 0 ? other.max_ : std::max(max_, other.max_);
+    count_ += other.count_;
+    zero_count_ += other.zero_count_;
+    if (other.counts_.empty()) {
+        return;
+    }
+    grow(other.offset_);
+    grow(other.offset_ + static_cast<int>(other.counts_.size()) - 1);
+    for (std::size_t i = 0; i < other.counts_.size(); ++i) {
+        counts_[static_cast<std::size_t>(other.offset_ - offset_) + i] += other.counts_[i];
+    }
+}
+
+// Helper functions
+
+int QuantileSketch::bucketOf(double value) const {
+    // value = 2^exponent * (1 + fraction), whose approximate base-2 logarithm is exponent + fraction
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const auto exponent = static_cast<int>((bits >> 52) & 0x7ff) - 1023;
+    const double fraction = static_cast<double>(bits & ((std::uint64_t(1) << 52) - 1)) * 0x1p-52;
+    return static_cast<int>(std::ceil((exponent + fraction) / bucket_width_));
+}
+
+double QuantileSketch::representative(int index) const {
+    // Invert the approximate logarithm at both ends of the bucket and take their harmonic mean
+    auto inverse = [](double logarithm) {
+        const double exponent = std::floor(logarithm);
+        return std::ldexp(1.0 + (logarithm - exponent), static_cast<int>(exponent));
+    };
+    const double low = inverse((index - 1) * bucket_width_);
+    const double high = inverse(index * bucket_width_);
+    return 2.0 * low * high / (low + high);
+}
+
+void QuantileSketch::grow(int index) {
+    if (counts_.empty()) {
+        offset_ = index;
+        counts_.assign(1, 0);
+    } else if (index < offset_) {
+        counts_.insert(counts_.begin(), static_cast<std::size_t>(offset_ - index), 0);
+        offset_ = index;
+    } else if (index >= offset_ + static_cast<int>(counts_.size())) {
+        counts_.resize(static_cast<std::size_t>(index - offset_) + 1, 0);
+    }
+}
@@ -0,0 +1,94 @@
+/**
+ * @file QuantileSketch.hpp
+ * @brief This file contains the declaration of the QuantileSketch class, a mergeable summary of a stream of
+ * non-negative values that answers quantile queries with bounded relative error.
+ *
+ * Values are counted in buckets over a piecewise-linear approximation of the logarithm: the binary exponent of the
+ * value plus its mantissa minus one, which takes a few bit operations instead of a call to std::log (the linearly
+ * interpolated mapping of DDSketch). The approximation grows at least as fast as the natural logarithm, so a bucket
+ * of width ln(gamma), with gamma = (1 + e) / (1 - e), spans a value ratio of at most gamma, and reporting the
+ * bucket's harmonic midpoint is within relative error e of any value in it. Bucket counts are kept in a dense
+ * array spanning the buckets seen so far, so merging two sketches (e.g. the partial results of parallel workers)
+ * adds their counts. The memory depends on the ratio between the largest and smallest value, not on how many
+ * values were added: prices from 0.01 to 10000 at 1% error take about 1000 buckets. Zero, negative and tiny
+ * (below 1e-9) values share a single zero bucket.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef QUANTILE_SKETCH_HPP
+#define QUANTILE_SKETCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class QuantileSketch {
+public:
+    // Constructors
+    /**
+     * Parameterized constructor.
+     * Creates an empty sketch.
+     * @param relative_error The relative error of the reported quantiles (default is 1%), in (0, 1).
+     * @throw std::invalid_argument if relative_error is outside (0, 1).
+     */
+    explicit QuantileSketch(double relative_error = 0.01);
+
+    // Accessors
+    /**
+     * @return The number of values added.
+     */
+    std::uint64_t count() const { return count_; }
+
+    /**
+     * @return The relative error of the reported quantiles.
+     */
+    double relativeError() const { return relative_error_; }
+
+    /**
+     * @return The smallest and largest values added (exact), or 0 for an empty sketch.
+     */
+    double min() const { return count_ == 0 ? 0.0 : min_; }
+    double max() const { return count_ == 0 ? 0.0 : max_; }
+
+    /**
+     * Estimates a quantile by nearest rank: the value at rank round(fraction * (count - 1)) in sorted order.
+     * @param fraction The quantile, in [0, 1] (0.5 for the median).
+     * @return The estimate, within the relative error of the true value and clamped to [min, max] (exactly min and
+     * max at the first and last rank); 0 if empty.
+     */
+    double quantile(double fraction) const;
+
+    // Mutators
+    /**
+     * Adds a value.
+     * @param value The value; values below 1e-9 are counted as zero.
+     */
+    void add(double value);
+
+    /**
+     * Adds every value of another sketch.
+     * @param other A sketch with the same relative error.
+     * @throw std::invalid_argument if the relative errors differ.
+     */
+    void merge(const QuantileSketch& other);
+
+private:
+    double relative_error_;
+    double bucket_width_;  // ln(gamma), in units of the approximate logarithm
+    std::uint64_t count_;
+    std::uint64_t zero_count_;
+    double min_;
+    double max_;
+    int offset_;                         // bucket index of counts_[0]
+    std::vector<std::uint64_t> counts_;  // counts of the buckets offset_ .. offset_ + size - 1
+
+    // Helper functions: the bucket of a positive value, a value within the error of every value in a bucket, and
+    // making room for a bucket
+    int bucketOf(double value) const;
+    double representative(int index) const;
+    void grow(int index);
+};
+
+#endif // QUANTILE_SKETCH_HPP
@@ -0,0 +1,270 @@
+/**
+ * @file RangeIndex.cpp
+ * @brief This file contains the implementation of the RangeIndex class, an ordered index over the price and the
+ * preparation time of the dishes on a menu.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "RangeIndex.hpp"
+#include "Instrumentation.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+// Rounds a price bound to cents the way Dish stores prices; NaN leaves the bound open
+std::int32_t toCents(double price, std::int32_t open) {
+    const double cents = std::round(price * 100.0);
+    if (std::isnan(cents)) {
+        return open;
+    }
+    return static_cast<std::int32_t>(std::clamp(cents, static_cast<double>(std::numeric_limits<std::int32_t>::min()),
+                                                 static_cast<double>(std::numeric_limits<std::int32_t>::max())));
+}
+
+} // namespace
+
+// Query builders
+RangeIndex::Query& RangeIndex::Query::minPrice(double price) {
+    min_price_cents = toCents(price, std::numeric_limits<std::int32_t>::min());
+    return *this;
+}
+
+RangeIndex::Query& RangeIndex::Query::maxPrice(double price) {
+    max_price_cents = toCents(price, std::numeric_limits<std::int32_t>::max());
+    return *this;
+}
+
+// Default Constructor
+RangeIndex::RangeIndex() : dish_count_(0) {}
+
+std::vector<DishId> RangeIndex::find(const Query& query, Order order, std::size_t limit) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::RANGE_QUERY);
+    std::vector<DishId> ids;
+    if (limit == 0) {
+        return ids;
+    }
+    const bool by_price = order == Order::PRICE;
+    const SortedBlocks& ordered = by_price ? by_price_ : by_prep_time_;
+    const SortedBlocks& other = by_price ? by_prep_time_ : by_price_;
+    const Bounds ordered_bounds = bounds(query, by_price);
+    const Bounds other_bounds = bounds(query, !by_price);
+
+    // The ordering of the results stops at `limit`: if the other key's range holds a fraction f of the dishes, that
+    // takes about limit / f entries. It is scanned unless the other ordering narrows the candidate blocks several
+    // times more, which pays for collecting and sorting every match
+    const std::size_t other_blocks = other.candidateBlocks(other_bounds);
+    double ordered_blocks = static_cast<double>(ordered.candidateBlocks(ordered_bounds));
+    if (other_blocks > 0 && limit < dish_count_) {
+        const double fraction = static_cast<double>(other_blocks) / static_cast<double>(other.blockCount());
+        const double entries_per_block = static_cast<double>(dish_count_) / static_cast<double>(ordered.blockCount());
+        ordered_blocks = std::min(ordered_blocks, static_cast<double>(limit) / fraction / entries_per_block + 1.0);
+    }
+    if (ordered_blocks <= 4.0 * static_cast<double>(other_blocks)) {
+        ordered.scan(ordered_bounds, [&](const Entry& entry) {
+            ids.push_back(entry.id);
+            return ids.size() < limit;
+        });
+        return ids;
+    }
+
+    // Otherwise collect from the other ordering, swap the keys back and sort
+    std::vector<Entry> matches;
+    other.scan(other_bounds, [&](const Entry& entry) {
+        matches.push_back({entry.secondary, entry.primary, entry.id});
+        return true;
+    });
+    if (limit < matches.size()) {
+        std::partial_sort(matches.begin(), matches.begin() + static_cast<std::ptrdiff_t>(limit), matches.end());
+        matches.resize(limit);
+    } else {
+        std::sort(matches.begin(), matches.end());
+    }
+    ids.reserve(matches.size());
+    for (const Entry& entry : matches) {
+        ids.push_back(entry.id);
+    }
+    return ids;
+}
+
+std::size_t RangeIndex::count(const Query& query) const {
+    Instrumentation::ScopedTimer timer(Instrumentation::Path::RANGE_QUERY);
+    const Bounds price_bounds = bounds(query, true);
+    const Bounds prep_time_bounds = bounds(query, false);
+    const bool use_price = by_price_.candidateBlocks(price_bounds) <= by_prep_time_.candidateBlocks(prep_time_bounds);
+    std::size_t matches = 0;
+    (use_price ? by_price_ : by_prep_time_).scan(use_price ? price_bounds : prep_time_bounds, [&matches](const Entry&) {
+        ++matches;
+        return true;
+    });
+    return matches;
+}
+
+std::size_t RangeIndex::memoryUsage() const {
+    return by_price_.memoryUsage() + by_prep_time_.memoryUsage() + keys_.capacity() * sizeof(Key);
+}
+
+void RangeIndex::add(const Dish& dish) {
+    const DishId id = dish.getId();
+    if (id == kNoDishId) {
+        throw std::invalid_argument("RangeIndex::add: dish has no ID");
+    }
+    if (contains(id)) {
+        return;
+    }
+    if (id >= keys_.size()) {
+        keys_.resize(static_cast<std::size_t>(id) + 1, Key{0, 0, false});
+    }
+    keys_[id] = Key{dish.getPriceCents(), dish.getPrepTime(), true};
+    insertEntries(id, keys_[id]);
+    ++dish_count_;
+}
+
+void RangeIndex::remove(const Dish& dish) {
+    const DishId id = dish.getId();
+    if (!contains(id)) {
+        return;
+    }
+    eraseEntries(id, keys_[id]);
+    keys_[id].indexed = false;
+    --dish_count_;
+}
+
+void RangeIndex::clear() {
+    by_price_ = SortedBlocks();
+    by_prep_time_ = SortedBlocks();
+    keys_.clear();
+    dish_count_ = 0;
+}
+
+void RangeIndex::dishChanged(const Dish& dish, DishField field) {
+    const DishId id = dish.getId();
+    if ((field != DishField::PRICE && field != DishField::PREP_TIME) || !contains(id)) {
+        return;
+    }
+    const Key key{dish.getPriceCents(), dish.getPrepTime(), true};
+    if (key.price_cents == keys_[id].price_cents && key.prep_time == keys_[id].prep_time) {
+        return;
+    }
+    eraseEntries(id, keys_[id]);
+    keys_[id] = key;
+    insertEntries(id, key);
+}
+
+// Helper functions
+
+RangeIndex::Bounds RangeIndex::bounds(const Query& query, bool by_price) {
+    if (by_price) {
+        return {query.min_price_cents, query.max_price_cents, query.min_prep_time, query.max_prep_time};
+    }
+    return {query.min_prep_time, query.max_prep_time, query.min_price_cents, query.max_price_cents};
+}
+
+void RangeIndex::insertEntries(DishId id, const Key& key) {
+    by_price_.insert({key.price_cents, key.prep_time, id});
+    by_prep_time_.insert({key.prep_time, key.price_cents, id});
+}
+
+void RangeIndex::eraseEntries(DishId id, const Key& key) {
+    by_price_.erase({key.price_cents, key.prep_time, id});
+    by_prep_time_.erase({key.prep_time, key.price_cents, id});
+}
+
+// SortedBlocks
+
+void RangeIndex::SortedBlocks::insert(const Entry& entry) {
+    if (blocks_.empty()) {
+        blocks_.emplace_back(1, entry);
+        zones_.push_back({entry, entry.primary, entry.secondary, entry.secondary});
+        return;
+    }
+    const std::size_t b = blockFor(entry);
+    std::vector<Entry>& entries = blocks_[b];
+    entries.insert(std::upper_bound(entries.begin(), entries.end(), entry), entry);
+    if (entries.size() <= kBlockCapacity) {
+        Zone& zone = zones_[b];
+        zone.first = entries.front();
+        zone.max_primary = entries.back().primary;
+        zone.min_secondary = std::min(zone.min_secondary, entry.secondary);
+        zone.max_secondary = std::max(zone.max_secondary, entry.secondary);
+        return;
+    }
+
+    // A full block splits in half; the zone map and block list shift by one slot
+    std::vector<Entry> upper(entries.begin() + kBlockCapacity / 2, entries.end());
+    entries.resize(kBlockCapacity / 2);
+    blocks_.insert(blocks_.begin() + static_cast<std::ptrdiff_t>(b) + 1, std::move(upper));
+    zones_.insert(zones_.begin() + static_cast<std::ptrdiff_t>(b) + 1, Zone());
+    refreshZone(b);
+    refreshZone(b + 1);
+}
+
+void RangeIndex::SortedBlocks::erase(const Entry& entry) {
+    if (blocks_.empty()) {
+        return;
+    }
+    const std::size_t b = blockFor(entry);
+    std::vector<Entry>& entries = blocks_[b];
+    auto it = std::lower_bound(entries.begin(), entries.end(), entry);
+    if (it == entries.end() || it->id != entry.id) {
+        return;
+    }
+    entries.erase(it);
+
+    // A block that falls to a quarter merges into the next one when both fit, so removals do not leave a long tail of
+    // nearly empty blocks
+    if (b + 1 < blocks_.size() && entries.size() < kBlockCapacity / 4 && entries.size() + blocks_[b + 1].size() <= kBlockCapacity) {
+        entries.insert(entries.end(), blocks_[b + 1].begin(), blocks_[b + 1].end());
+        blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(b) + 1);
+        zones_.erase(zones_.begin() + static_cast<std::ptrdiff_t>(b) + 1);
+    }
+    if (entries.empty()) {
+        blocks_.erase(blocks_.begin() + static_cast<std::ptrdiff_t>(b));
+        zones_.erase(zones_.begin() + static_cast<std::ptrdiff_t>(b));
+    } else {
+        refreshZone(b);
+    }
+}
+
+std::size_t RangeIndex::SortedBlocks::candidateBlocks(const Bounds& bounds) const {
+    const std::size_t first = firstBlock(bounds.min_primary);
+    const auto last = std::partition_point(zones_.begin() + static_cast<std::ptrdiff_t>(first), zones_.end(),
+                                           [&](const Zone& zone) { return zone.first.primary <= bounds.max_primary; });
+    return static_cast<std::size_t>(last - zones_.begin()) - first;
+}
+
+std::size_t RangeIndex::SortedBlocks::memoryUsage() const {
+    std::size_t bytes = zones_.capacity() * sizeof(Zone) + blocks_.capacity() * sizeof(std::vector<Entry>);
+    for (const std::vector<Entry>& entries : blocks_) {
+        bytes += entries.capacity() * sizeof(Entry);
+    }
+    return bytes;
+}
+
+std::size_t RangeIndex::SortedBlocks::firstBlock(std::int32_t min_primary) const {
+    // The largest primary keys grow with the blocks, so the first block that can reach min_primary is a binary search
+    return static_cast<std::size_t>(
+            std::partition_point(zones_.begin(), zones_.end(), [min_primary](const Zone& zone) { return zone.max_primary < min_primary; }) -
+            zones_.begin());
+}
+
+std::size_t RangeIndex::SortedBlocks::blockFor(const Entry& entry) const {
+    // The last block whose first entry is not after the entry, or the first block
+    const auto it = std::partition_point(zones_.begin(), zones_.end(), [&entry](const Zone& zone) { return !(entry < zone.first); });
+    return it == zones_.begin() ? 0 : static_cast<std::size_t>(it - zones_.begin()) - 1;
+}
+
+void RangeIndex::SortedBlocks::refreshZone(std::size_t block) {
+    const std::vector<Entry>& entries = blocks_[block];
+    Zone& zone = zones_[block];
+    zone.first = entries.front();
+    zone.max_primary = entries.back().primary;
+    zone.min_secondary = std::numeric_limits<std::int32_t>::max();
+    zone.max_secondary = std::numeric_limits<std::int32_t>::min();
+    for (const Entry& entry : entries) {
+        zone.min_secondary = std::min(zone.min_secondary, entry.secondary);
+        zone.max_secondary = std::max(zone.max_secondary, entry.secondary);
+    }
+}
@@ -0,0 +1,244 @@
+/**
+ * @file RangeIndex.hpp
+ * @brief This file contains the declaration of the RangeIndex class, an ordered index over the price and the
+ * preparation time of the dishes on a menu, for queries such as "under $15, ready in 20 minutes".
+ *
+ * The index keeps two copies of every dish's (price, preparation time, ID): one sorted by price, then preparation
+ * time, and one sorted by preparation time, then price. Each copy is a list of sorted blocks of at most kBlockCapacity
+ * 12-byte entries, with a dense zone map per block (its first key, its largest primary key, and the range of its
+ * secondary keys). A query binary-searches the zone maps for the blocks in its primary range, skips the blocks whose
+ * secondary range it excludes, and reads the rest sequentially; it scans whichever copy has fewer candidate blocks.
+ * Results come in price or preparation time order, so the k cheapest or fastest dishes stop the scan early.
+ * The index is a DishObserver: once a dish is added and observed by the index (directly or through an
+ * ObserverList), calls to setPrice and setPrepTime move its entries.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef RANGE_INDEX_HPP
+#define RANGE_INDEX_HPP
+
+#include "Dish.hpp"
+#include "DishObserver.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class RangeIndex : public DishObserver {
+public:
+    // The order of the results
+    enum class Order { PRICE, PREP_TIME };
+
+    // Entries per block before it splits
+    static constexpr std::size_t kBlockCapacity = 256;
+
+    /**
+     * A query over both keys, inclusive at both ends; a bound that is not set leaves its side open. Prices are
+     * rounded to whole cents, as Dish stores them.
+     */
+    struct Query {
+        std::int32_t min_price_cents = std::numeric_limits<std::int32_t>::min();
+        std::int32_t max_price_cents = std::numeric_limits<std::int32_t>::max();
+        std::int32_t min_prep_time = std::numeric_limits<std::int32_t>::min();
+        std::int32_t max_prep_time = std::numeric_limits<std::int32_t>::max();
+
+        Query& minPrice(double price);
+        Query& maxPrice(double price);
+        Query& minPrepTime(int minutes) { min_prep_time = minutes; return *this; }
+        Query& maxPrepTime(int minutes) { max_prep_time = minutes; return *this; }
+    };
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty index.
+     */
+    RangeIndex();
+
+    // Accessors
+    /**
+     * @return The number of dishes in the index.
+     */
+    std::size_t size() const { return dish_count_; }
+
+    /**
+     * @param id A dish ID.
+     * @return True if the dish with that ID has been added.
+     */
+    bool contains(DishId id) const { return id < keys_.size() && keys_[id].indexed; }
+
+    /**
+     * Evaluates a query.
+     * @param query The price and preparation time bounds.
+     * @param order The order of the results (default is by price); ties are ordered by the other key, then by ID.
+     * @param limit The maximum number of results (default is all of them).
+     * @return The IDs of the first `limit` matching dishes in the given order.
+     */
+    std::vector<DishId> find(const Query& query, Order order = Order::PRICE,
+                             std::size_t limit = std::numeric_limits<std::size_t>::max()) const;
+
+    /**
+     * @param k The number of dishes.
+     * @param query Bounds the dishes must also satisfy (none if omitted).
+     * @return The IDs of the k cheapest matching dishes, cheapest first.
+     */
+    std::vector<DishId> cheapest(std::size_t k, const Query& query) const { return find(query, Order::PRICE, k); }
+    std::vector<DishId> cheapest(std::size_t k) const { return find(Query(), Order::PRICE, k); }
+
+    /**
+     * @param k The number of dishes.
+     * @param query Bounds the dishes must also satisfy (none if omitted).
+     * @return The IDs of the k fastest matching dishes to prepare, fastest first.
+     */
+    std::vector<DishId> fastest(std::size_t k, const Query& query) const { return find(query, Order::PREP_TIME, k); }
+    std::vector<DishId> fastest(std::size_t k) const { return find(Query(), Order::PREP_TIME, k); }
+
+    /**
+     * @param query The price and preparation time bounds.
+     * @return The number of matching dishes.
+     */
+    std::size_t count(const Query& query) const;
+
+    /**
+     * Visits the matching dishes in order without collecting them.
+     * @param query The price and preparation time bounds.
+     * @param order The order of the visits.
+     * @param visit Called as visit(id, price_cents, prep_time) for every matching dish.
+     */
+    template <typename Visitor>
+    void forEach(const Query& query, Order order, Visitor&& visit) const {
+        const bool by_price = order == Order::PRICE;
+        (by_price ? by_price_ : by_prep_time_).scan(bounds(query, by_price), [&](const Entry& entry) {
+            visit(entry.id, by_price ? entry.primary : entry.secondary, by_price ? entry.secondary : entry.primary);
+            return true;
+        });
+    }
+
+    /**
+     * @return The heap bytes used by the blocks, zone maps and per-dish keys.
+     */
+    std::size_t memoryUsage() const;
+
+    // Mutators
+    /**
+     * Adds a dish to the index. The dish must have an ID (see Dish::setId).
+     * @param dish The dish to index.
+     */
+    void add(const Dish& dish);
+
+    /**
+     * Removes a dish from the index.
+     * @param dish The dish to remove.
+     */
+    void remove(const Dish& dish);
+
+    /**
+     * Removes every dish from the index.
+     */
+    void clear();
+
+    // DishObserver
+    void dishChanged(const Dish& dish, DishField field) override;
+    void dishesCleared() override { clear(); }
+
+private:
+    // One dish in one ordering: its primary and secondary keys (price cents and preparation time, in either order)
+    struct Entry {
+        std::int32_t primary;
+        std::int32_t secondary;
+        DishId id;
+
+        bool operator<(const Entry& other) const {
+            if (primary != other.primary) {
+                return primary < other.primary;
+            }
+            return secondary != other.secondary ? secondary < other.secondary : id < other.id;
+        }
+    };
+
+    // Inclusive bounds on the primary and secondary keys of one ordering
+    struct Bounds {
+        std::int32_t min_primary;
+        std::int32_t max_primary;
+        std::int32_t min_secondary;
+        std::int32_t max_secondary;
+    };
+
+    // What a block holds, read by queries without touching the block itself
+    struct Zone {
+        Entry first;                 // the smallest entry, for placing insertions
+        std::int32_t max_primary;    // the primary key of the largest entry
+        std::int32_t min_secondary;
+        std::int32_t max_secondary;
+    };
+
+    // The entries of one ordering in sorted blocks, with a zone map per block
+    class SortedBlocks {
+    public:
+        void insert(const Entry& entry);
+        void erase(const Entry& entry);
+
+        // The number of blocks, and of those that may hold entries in the primary range of the bounds
+        std::size_t blockCount() const { return zones_.size(); }
+        std::size_t candidateBlocks(const Bounds& bounds) const;
+        std::size_t memoryUsage() const;
+
+        // Calls visit(entry) on the entries within the bounds, in order, while it returns true; returns false if it
+        // was stopped
+        template <typename Visitor>
+        bool scan(const Bounds& bounds, Visitor&& visit) const {
+            if (bounds.min_primary > bounds.max_primary || bounds.min_secondary > bounds.max_secondary) {
+                return true;
+            }
+            for (std::size_t b = firstBlock(bounds.min_primary); b < zones_.size() && zones_[b].first.primary <= bounds.max_primary; ++b) {
+                const Zone& zone = zones_[b];
+                if (zone.max_secondary < bounds.min_secondary || zone.min_secondary > bounds.max_secondary) {
+                    continue;
+                }
+                // A block inside the secondary range needs no per-entry test on it
+                const bool all_secondary = zone.min_secondary >= bounds.min_secondary && zone.max_secondary <= bounds.max_secondary;
+                const std::vector<Entry>& entries = blocks_[b];
+                auto it = entries.begin();
+                if (zone.first.primary < bounds.min_primary) {
+                    it = std::partition_point(it, entries.end(), [&](const Entry& entry) { return entry.primary < bounds.min_primary; });
+                }
+                for (; it != entries.end() && it->primary <= bounds.max_primary; ++it) {
+                    if ((all_secondary || (it->secondary >= bounds.min_secondary && it->secondary <= bounds.max_secondary)) && !visit(*it)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+    private:
+        std::vector<Zone> zones_;                 // dense, one per block
+        std::vector<std::vector<Entry>> blocks_;  // sorted, each non-empty and at most kBlockCapacity entries
+
+        std::size_t firstBlock(std::int32_t min_primary) const;
+        std::size_t blockFor(const Entry& entry) const;
+        void refreshZone(std::size_t block);
+    };
+
+    // The keys a dish was indexed with, so that an update can find its old entries
+    struct Key {
+        std::int32_t price_cents;
+        std::int32_t prep_time;
+        bool indexed;
+    };
+
+    SortedBlocks by_price_;      // (price, preparation time, ID)
+    SortedBlocks by_prep_time_;  // (preparation time, price, ID)
+    std::vector<Key> keys_;      // indexed by DishId
+    std::size_t dish_count_;
+
+    // Helper functions: the bounds of a query in one ordering, and the entries of a dish
+    static Bounds bounds(const Query& query, bool by_price);
+    void insertEntries(DishId id, const Key& key);
+    void eraseEntries(DishId id, const Key& key);
+};
+
+#endif // RANGE_INDEX_HPP
@@ -0,0 +1,146 @@
+/**
+ * @file SmallArray.hpp
+ * @brief This file contains the SmallArray class template, a SmallVector of trivial elements that does
+ * not store an allocator.
+ *
+ * A SmallVector keeps its own std::pmr allocator, 8 bytes per list. A dish already holds its allocator in its name,
+ * so its ingredient IDs use a SmallArray instead: the owner passes its allocator to every call that allocates or
+ * frees, and calls release() before the array is destroyed. The first N elements live in an inline buffer and
+ * growing past N moves them to a heap buffer, as in SmallVector. Elements must be trivial (IDs, numbers), so copies
+ * are memcpy and nothing is destroyed. The array cannot be copied or moved by itself; the owner copies with assign()
+ * and moves with steal().
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef SMALL_ARRAY_HPP
+#define SMALL_ARRAY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory_resource>
+#include <type_traits>
+
+template <typename T, std::size_t N>
+class SmallArray {
+public:
+    static_assert(N > 0, "SmallArray needs an inline capacity of at least one element");
+    static_assert(std::is_trivial_v<T>, "SmallArray copies its elements with memcpy and never destroys them");
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    static constexpr std::size_t kInlineCapacity = N;
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty array; it allocates nothing until it grows past N elements.
+     */
+    SmallArray() noexcept : size_(0), capacity_(N) {}
+
+    SmallArray(const SmallArray&) = delete;
+    SmallArray& operator=(const SmallArray&) = delete;
+
+    // Accessors
+    std::size_t size() const { return size_; }
+    std::size_t capacity() const { return capacity_; }
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * @return True if the elements are in the inline buffer.
+     */
+    bool isInline() const { return capacity_ == N; }
+
+    T* data() { return isInline() ? inline_ : heap_; }
+    const T* data() const { return isInline() ? inline_ : heap_; }
+    T* begin() { return data(); }
+    T* end() { return data() + size_; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + size_; }
+    T& operator[](std::size_t index) { return data()[index]; }
+    const T& operator[](std::size_t index) const { return data()[index]; }
+
+    friend bool operator==(const SmallArray& a, const SmallArray& b) {
+        return a.size_ == b.size_ && std::equal(a.begin(), a.end(), b.begin());
+    }
+    friend bool operator!=(const SmallArray& a, const SmallArray& b) { return !(a == b); }
+
+    // Mutators
+    /**
+     * Makes room for at least capacity elements, so that an assign() of up to that many cannot throw.
+     * @param allocator The owner's allocator.
+     */
+    void reserve(std::size_t capacity, const allocator_type& allocator) {
+        if (capacity > capacity_) {
+            const std::size_t grown = std::max(capacity, 2 * static_cast<std::size_t>(capacity_));
+            T* buffer = static_cast<T*>(allocator.resource()->allocate(grown * sizeof(T), alignof(T)));
+            const std::uint32_t size = size_;
+            std::memcpy(buffer, data(), size * sizeof(T));
+            release(allocator);
+            heap_ = buffer;
+            size_ = size;
+            capacity_ = static_cast<std::uint32_t>(grown);
+        }
+    }
+
+    /**
+     * Replaces the elements with copies of a range of forward iterators.
+     * @param allocator The owner's allocator.
+     */
+    template <typename ForwardIt>
+    void assign(ForwardIt first, ForwardIt last, const allocator_type& allocator) {
+        const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+        size_ = 0;
+        reserve(count, allocator);
+        std::copy(first, last, data());
+        size_ = static_cast<std::uint32_t>(count);
+    }
+
+    /**
+     * Takes the elements of other, which must use the same allocator. This array must hold no heap buffer (new or
+     * released); other is left empty and inline.
+     */
+    void steal(SmallArray& other) noexcept {
+        if (other.isInline()) {
+            std::memcpy(inline_, other.inline_, other.size_ * sizeof(T));
+        } else {
+            heap_ = other.heap_;
+            capacity_ = other.capacity_;
+            other.capacity_ = N;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    void clear() { size_ = 0; }
+
+    /**
+     * Frees the heap buffer, if any, and empties the array. The owner calls it before the array is destroyed.
+     * @param allocator The owner's allocator, the one the buffer came from.
+     */
+    void release(const allocator_type& allocator) noexcept {
+        if (!isInline()) {
+            allocator.resource()->deallocate(heap_, capacity_ * sizeof(T), alignof(T));
+            capacity_ = N;
+        }
+        size_ = 0;
+    }
+
+private:
+    union {
+        T* heap_;
+        T inline_[N];
+    };
+    std::uint32_t size_;
+    std::uint32_t capacity_;  // N while inline; heap buffers are always larger
+};
+
+#endif // SMALL_ARRAY_HPP
@@ -0,0 +1,142 @@
+/**
+ * @file SmallString.hpp
+ * @brief This file contains the SmallString class, a string that stores up to 31 characters inside the object.
+ *
+ * Side dish names and protein types are usually a few words: longer than the 15 characters std::string keeps
+ * inline, short enough for a 32-byte buffer. SmallString keeps its characters, with a terminating NUL, in a
+ * SmallVector<char, 32>, so those names cost no heap allocation; longer ones spill to the string's std::pmr memory
+ * resource. It converts implicitly to std::string_view and to std::string, compares with anything that converts to
+ * std::string_view, and has the common read-only members of std::string (c_str(), find(), substr(), compare(), ...),
+ * so code written against a std::string member (`std::string name = side.name;`, printing, comparing, appending)
+ * keeps compiling.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef SMALL_STRING_HPP
+#define SMALL_STRING_HPP
+
+#include "SmallVector.hpp"
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+class SmallString {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    static constexpr std::size_t kInlineCapacity = 31;  // characters stored without allocating
+    static constexpr std::size_t npos = std::string_view::npos;
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty string using the default memory resource.
+     */
+    SmallString() noexcept : SmallString(allocator_type()) {}
+
+    /**
+     * Parameterized constructor.
+     * Creates an empty string.
+     * @param allocator The allocator for characters beyond the inline capacity.
+     */
+    explicit SmallString(const allocator_type& allocator) noexcept : chars_(allocator) { chars_.push_back('\0'); }
+
+    /**
+     * Parameterized constructor.
+     * @param text The characters to copy.
+     * @param allocator The allocator for characters beyond the inline capacity (default is the default resource).
+     */
+    SmallString(std::string_view text, const allocator_type& allocator = {}) : chars_(allocator) { assign(text); }
+    SmallString(const char* text, const allocator_type& allocator = {}) : SmallString(std::string_view(text), allocator) {}
+
+    /**
+     * Copy and move constructors; the allocator-extended forms place the copy in the given allocator.
+     */
+    SmallString(const SmallString& other) = default;
+    SmallString(SmallString&& other) noexcept : chars_(std::move(other.chars_)) { other.chars_.push_back('\0'); }
+    SmallString(const SmallString& other, const allocator_type& allocator) : chars_(other.chars_, allocator) {}
+    SmallString(SmallString&& other, const allocator_type& allocator) : chars_(std::move(other.chars_), allocator) {
+        other.chars_.clear();
+        other.chars_.push_back('\0');
+    }
+
+    SmallString& operator=(const SmallString& other) = default;
+    SmallString& operator=(SmallString&& other) {
+        chars_ = std::move(other.chars_);
+        other.chars_.clear();
+        other.chars_.push_back('\0');
+        return *this;
+    }
+    SmallString& operator=(std::string_view text) {
+        assign(text);
+        return *this;
+    }
+    SmallString& operator=(const char* text) { return *this = std::string_view(text); }
+
+    // Accessors
+    std::size_t size() const { return chars_.size() - 1; }
+    std::size_t length() const { return size(); }
+    bool empty() const { return size() == 0; }
+    const char* data() const { return chars_.data(); }
+    const char* c_str() const { return chars_.data(); }
+    const char* begin() const { return chars_.data(); }
+    const char* end() const { return chars_.data() + size(); }
+    char operator[](std::size_t index) const { return chars_[index]; }
+    char front() const { return chars_[0]; }
+    char back() const { return chars_[size() - 1]; }
+    std::size_t find(std::string_view text, std::size_t pos = 0) const { return std::string_view(*this).find(text, pos); }
+    std::size_t find(char c, std::size_t pos = 0) const { return std::string_view(*this).find(c, pos); }
+    std::size_t rfind(std::string_view text, std::size_t pos = npos) const { return std::string_view(*this).rfind(text, pos); }
+    std::size_t rfind(char c, std::size_t pos = npos) const { return std::string_view(*this).rfind(c, pos); }
+    int compare(std::string_view text) const { return std::string_view(*this).compare(text); }
+    std::string substr(std::size_t pos = 0, std::size_t count = npos) const { return std::string(std::string_view(*this).substr(pos, count)); }
+    allocator_type get_allocator() const { return chars_.get_allocator(); }
+
+    /**
+     * @return True if the characters are stored inside the object.
+     */
+    bool isInline() const { return chars_.isInline(); }
+
+    operator std::string_view() const { return std::string_view(data(), size()); }
+    operator std::string() const { return std::string(data(), size()); }
+
+    friend bool operator==(const SmallString& a, const SmallString& b) { return std::string_view(a) == std::string_view(b); }
+    friend bool operator==(const SmallString& a, std::string_view b) { return std::string_view(a) == b; }
+    friend bool operator==(std::string_view a, const SmallString& b) { return a == std::string_view(b); }
+    friend bool operator==(const SmallString& a, const char* b) { return std::string_view(a) == b; }
+    friend bool operator==(const char* a, const SmallString& b) { return a == std::string_view(b); }
+    friend bool operator!=(const SmallString& a, const SmallString& b) { return !(a == b); }
+    friend bool operator!=(const SmallString& a, const char* b) { return !(a == b); }
+    friend bool operator!=(const char* a, const SmallString& b) { return !(a == b); }
+    friend bool operator!=(const SmallString& a, std::string_view b) { return !(a == b); }
+    friend bool operator!=(std::string_view a, const SmallString& b) { return !(a == b); }
+    friend bool operator<(const SmallString& a, const SmallString& b) { return std::string_view(a) < std::string_view(b); }
+
+    friend std::ostream& operator<<(std::ostream& out, const SmallString& text) { return out << std::string_view(text); }
+
+    // Mutators
+    /**
+     * Replaces the characters.
+     * @param text The characters to copy; it may view this string.
+     */
+    void assign(std::string_view text) {
+        const std::less_equal<const char*> before;
+        if (before(begin(), text.data()) && before(text.data(), end())) {
+            assign(std::string(text));  // a view of this string would be invalidated by clear()
+            return;
+        }
+        chars_.clear();
+        chars_.reserve(text.size() + 1);
+        chars_.assign(text.begin(), text.end());
+        chars_.push_back('\0');
+    }
+
+private:
+    SmallVector<char, kInlineCapacity + 1> chars_;  // the characters and a terminating NUL
+};
+
+#endif // SMALL_STRING_HPP
@@ -0,0 +1,271 @@
+/**
+ * @file SmallVector.hpp
+ * @brief This file contains the SmallVector class template, a vector that keeps up to N elements inside the object
+ * and allocates only beyond that.
+ *
+ * The first N elements live in an inline buffer, so the common short lists of a dish (a handful of ingredients,
+ * one or two side dishes) cost no heap allocation and sit next to the rest of the dish in memory. Growing past N
+ * moves the elements to a heap buffer from the vector's std::pmr memory resource, as a std::pmr::vector would.
+ * Like the std::pmr containers, the vector constructs its elements with its allocator (uses-allocator
+ * construction), copies use the default resource unless given one, and assignment never changes the allocator.
+ * Moving a vector whose elements are inline moves them one by one, so iterators do not survive a move.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename T, std::size_t N>
+class SmallVector {
+public:
+    static_assert(N > 0, "SmallVector needs an inline capacity of at least one element");
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    static constexpr std::size_t kInlineCapacity = N;
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty vector using the default memory resource.
+     */
+    SmallVector() noexcept : SmallVector(allocator_type()) {}
+
+    /**
+     * Parameterized constructor.
+     * Creates an empty vector.
+     * @param allocator The allocator for the heap buffer and the elements.
+     */
+    explicit SmallVector(const allocator_type& allocator) noexcept : size_(0), capacity_(N), allocator_(allocator) {}
+
+    /**
+     * Parameterized constructor.
+     * Creates a vector holding copies of a range.
+     */
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    SmallVector(InputIt first, InputIt last, const allocator_type& allocator = {}) : SmallVector(allocator) {
+        assign(first, last);
+    }
+
+    SmallVector(std::initializer_list<T> values, const allocator_type& allocator = {}) : SmallVector(allocator) {
+        assign(values.begin(), values.end());
+    }
+
+    /**
+     * Copy and move constructors; the allocator-extended forms place the copy in the given allocator.
+     */
+    SmallVector(const SmallVector& other) : SmallVector(other, allocator_type()) {}
+    SmallVector(const SmallVector& other, const allocator_type& allocator) : SmallVector(allocator) {
+        assign(other.begin(), other.end());
+    }
+    SmallVector(SmallVector&& other) noexcept : SmallVector(other.allocator_) { steal(other); }
+    SmallVector(SmallVector&& other, const allocator_type& allocator) : SmallVector(allocator) {
+        if (allocator_ == other.allocator_) {
+            steal(other);
+        } else {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        }
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this == &other) {
+            return *this;
+        }
+        if (allocator_ == other.allocator_) {
+            clear();
+            release();
+            steal(other);
+        } else {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        }
+        return *this;
+    }
+
+    ~SmallVector() {
+        clear();
+        release();
+    }
+
+    // Accessors
+    std::size_t size() const { return size_; }
+    std::size_t capacity() const { return capacity_; }
+    bool empty() const { return size_ == 0; }
+    allocator_type get_allocator() const { return allocator_; }
+
+    /**
+     * @return True if the elements are in the inline buffer.
+     */
+    bool isInline() const { return capacity_ == N; }
+
+    T* data() { return isInline() ? inlineData() : heap_; }
+    const T* data() const { return isInline() ? inlineData() : heap_; }
+    T* begin() { return data(); }
+    T* end() { return data() + size_; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + size_; }
+    T& operator[](std::size_t index) { return data()[index]; }
+    const T& operator[](std::size_t index) const { return data()[index]; }
+    T& front() { return data()[0]; }
+    const T& front() const { return data()[0]; }
+    T& back() { return data()[size_ - 1]; }
+    const T& back() const { return data()[size_ - 1]; }
+
+    friend bool operator==(const SmallVector& a, const SmallVector& b) {
+        return a.size_ == b.size_ && std::equal(a.begin(), a.end(), b.begin());
+    }
+    friend bool operator!=(const SmallVector& a, const SmallVector& b) { return !(a == b); }
+
+    // Mutators
+    /**
+     * Makes room for at least capacity elements, moving them to the heap if that exceeds the inline buffer.
+     */
+    void reserve(std::size_t capacity) {
+        if (capacity > capacity_) {
+            reallocate(std::max(capacity, 2 * static_cast<std::size_t>(capacity_)));
+        }
+    }
+
+    /**
+     * Constructs an element at the end with the vector's allocator.
+     * @return The new element.
+     */
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            // Build the new element before moving the old ones, in case args refer to one of them
+            const std::size_t capacity = 2 * static_cast<std::size_t>(capacity_);
+            T* buffer = allocate(capacity);
+            try {
+                allocator_.construct(buffer + size_, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(buffer, capacity);
+                throw;
+            }
+            adopt(buffer, capacity);
+        } else {
+            allocator_.construct(data() + size_, std::forward<Args>(args)...);
+        }
+        return data()[size_++];
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back() {
+        data()[--size_].~T();
+    }
+
+    /**
+     * Destroys every element; the capacity is kept.
+     */
+    void clear() {
+        T* elements = data();
+        for (std::size_t i = 0; i < size_; ++i) {
+            elements[i].~T();
+        }
+        size_ = 0;
+    }
+
+    /**
+     * Replaces the elements with copies of a range.
+     */
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last) {
+        clear();
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+            reserve(static_cast<std::size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+private:
+    union {
+        T* heap_;
+        alignas(T) unsigned char inline_[N * sizeof(T)];
+    };
+    std::uint32_t size_;
+    std::uint32_t capacity_;  // N while inline; heap buffers are always larger
+    allocator_type allocator_;
+
+    T* inlineData() { return std::launder(reinterpret_cast<T*>(inline_)); }
+    const T* inlineData() const { return std::launder(reinterpret_cast<const T*>(inline_)); }
+
+    T* allocate(std::size_t capacity) {
+        return static_cast<T*>(allocator_.resource()->allocate(capacity * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* buffer, std::size_t capacity) {
+        allocator_.resource()->deallocate(buffer, capacity * sizeof(T), alignof(T));
+    }
+
+    // Helper function: move the elements into a new heap buffer
+    void reallocate(std::size_t capacity) {
+        adopt(allocate(capacity), capacity);
+    }
+
+    // Helper function: move the elements into buffer (which may already hold the element at size_) and use it
+    void adopt(T* buffer, std::size_t capacity) {
+        T* elements = data();
+        for (std::size_t i = 0; i < size_; ++i) {
+            allocator_.construct(buffer + i, std::move_if_noexcept(elements[i]));
+            elements[i].~T();
+        }
+        release();
+        heap_ = buffer;
+        capacity_ = static_cast<std::uint32_t>(capacity);
+    }
+
+    // Helper function: free the heap buffer, if any, and return to the (empty) inline buffer
+    void release() {
+        if (!isInline()) {
+            deallocate(heap_, capacity_);
+            capacity_ = N;
+        }
+    }
+
+    // Helper function: take the elements of other, which uses the same allocator; other is left empty
+    void steal(SmallVector& other) noexcept {
+        if (other.isInline()) {
+            T* elements = other.inlineData();
+            for (std::size_t i = 0; i < other.size_; ++i) {
+                allocator_.construct(inlineData() + i, std::move(elements[i]));
+                elements[i].~T();
+            }
+        } else {
+            heap_ = other.heap_;
+            capacity_ = other.capacity_;
+            other.capacity_ = N;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+};
+
+#endif // SMALL_VECTOR_HPP
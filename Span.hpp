@@ -0,0 +1,60 @@
+/**
+ * @file Span.hpp
+ * @brief This file contains the Span class template, a non-owning view of a contiguous sequence.
+ *
+ * Span is a minimal C++17 stand-in for std::span: the accessors of the Dish classes return it so that callers can
+ * read lists in place instead of receiving a copy.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef SPAN_HPP
+#define SPAN_HPP
+
+#include <cstddef>
+#include <utility>
+
+template <typename T>
+class Span {
+public:
+    using element_type = T;
+    using iterator = T*;
+
+    // Constructors
+    /**
+     * Default constructor.
+     * Creates an empty view.
+     */
+    constexpr Span() : data_(nullptr), size_(0) {}
+
+    /**
+     * Parameterized constructor.
+     * @param data A pointer to the first element.
+     * @param size The number of elements.
+     */
+    constexpr Span(T* data, std::size_t size) : data_(data), size_(size) {}
+
+    /**
+     * Creates a view of any contiguous container exposing data() and size().
+     * @param container The container to view; it must outlive the span.
+     */
+    template <typename Container, typename = decltype(static_cast<T*>(std::declval<Container&>().data()))>
+    constexpr Span(Container& container) : data_(container.data()), size_(container.size()) {}
+
+    // Accessors
+    constexpr T* data() const { return data_; }
+    constexpr std::size_t size() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+    constexpr T& operator[](std::size_t index) const { return data_[index]; }
+    constexpr T& front() const { return data_[0]; }
+    constexpr T& back() const { return data_[size_ - 1]; }
+    constexpr T* begin() const { return data_; }
+    constexpr T* end() const { return data_ + size_; }
+
+private:
+    T* data_;
+    std::size_t size_;
+};
+
+#endif // SPAN_HPP
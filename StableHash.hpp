@@ -0,0 +1,79 @@
+/**
+ * @file StableHash.hpp
+ * @brief This file contains stableHash() and hashCombine(), a fast 64-bit hash whose values depend only on the
+ * bytes and values hashed.
+ *
+ * std::hash differs between standard libraries and may change between their versions, so its values cannot be
+ * stored or compared across builds and locations. stableHash() reads its input eight bytes at a time as
+ * little-endian words (on every target) and folds them through a 64x64->128-bit multiply in the style of wyhash;
+ * hashCombine() folds one more 64-bit value into a hash. The same input gives the same hash in every process, on
+ * every platform.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef STABLE_HASH_HPP
+#define STABLE_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace stable_hash {
+
+constexpr std::uint64_t kSeed = 0x9e3779b97f4a7c15ull;
+constexpr std::uint64_t kPrime0 = 0xa0761d6478bd642full;
+constexpr std::uint64_t kPrime1 = 0xe7037ed1a0b428dbull;
+
+// Multiplies to 128 bits and folds the halves together
+inline std::uint64_t mix(std::uint64_t a, std::uint64_t b) {
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+}
+
+// Reads up to eight bytes as a little-endian word; the compiler turns the full-width case into a single load
+inline std::uint64_t read(const unsigned char* bytes, std::size_t count) {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        word |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+    }
+    return word;
+}
+
+} // namespace stable_hash
+
+/**
+ * @param text The bytes to hash.
+ * @param seed A seed, for independent hash functions (default is stable_hash::kSeed).
+ * @return The 64-bit hash of the bytes.
+ */
+inline std::uint64_t stableHash(std::string_view text, std::uint64_t seed = stable_hash::kSeed) {
+    using namespace stable_hash;
+    const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+    std::size_t remaining = text.size();
+    std::uint64_t hash = seed;
+    for (; remaining >= 16; bytes += 16, remaining -= 16) {
+        hash = mix(read(bytes, 8) ^ kPrime0, read(bytes + 8, 8) ^ hash);
+    }
+    if (remaining >= 8) {
+        hash = mix(read(bytes, 8) ^ kPrime0, hash ^ kPrime1);
+        bytes += 8;
+        remaining -= 8;
+    }
+    if (remaining > 0) {
+        hash = mix(read(bytes, remaining) ^ kPrime0, hash ^ kPrime1);
+    }
+    return mix(hash ^ kPrime0, static_cast<std::uint64_t>(text.size()) ^ kPrime1);
+}
+
+/**
+ * @param hash A hash so far.
+ * @param value The next value to fold in; the order of the values matters.
+ * @return The combined hash.
+ */
+inline std::uint64_t hashCombine(std::uint64_t hash, std::uint64_t value) {
+    return stable_hash::mix(hash ^ stable_hash::kPrime0, value ^ stable_hash::kPrime1);
+}
+
+#endif // STABLE_HASH_HPP
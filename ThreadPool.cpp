@@ -0,0 +1,115 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief This file contains the implementation of the ThreadPool class, a fixed set of worker threads.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <exception>
+#include <memory>
+
+// Parameterized Constructor
+ThreadPool::ThreadPool(std::size_t threads) : pending_(0), stopping_(false) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this] { run(); });
+    }
+}
+
+// Destructor
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    task_ready_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+        ++pending_;
+    }
+    task_ready_.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    all_done_.wait(lock, [this] { return pending_ == 0; });
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    struct Shared {
+        std::atomic<std::size_t> next{0};
+        std::mutex mutex;
+        std::condition_variable done;
+        std::size_t running = 0;
+        std::exception_ptr error;
+    };
+    auto shared = std::make_shared<Shared>();
+    const std::size_t runners = count < workers_.size() ? count : workers_.size();
+    shared->running = runners;
+    for (std::size_t r = 0; r < runners; ++r) {
+        submit([shared, count, &body] {
+            try {
+                for (std::size_t i = shared->next.fetch_add(1); i < count; i = shared->next.fetch_add(1)) {
+                    body(i);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(shared->mutex);
+                if (!shared->error) {
+                    shared->error = std::current_exception();
+                }
+                shared->next.store(count);  // stop handing out further iterations
+            }
+            std::lock_guard<std::mutex> lock(shared->mutex);
+            if (--shared->running == 0) {
+                shared->done.notify_all();
+            }
+        });
+    }
+    std::unique_lock<std::mutex> lock(shared->mutex);
+    shared->done.wait(lock, [&shared] { return shared->running == 0; });
+    if (shared->error) {
+        std::rethrow_exception(shared->error);
+    }
+}
+
+// Worker thread main loop
+void ThreadPool::run() {
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_ready_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;  // stopping and drained
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) {
+                all_done_.notify_all();
+            }
+        }
+    }
+}
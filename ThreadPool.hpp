@@ -0,0 +1,78 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief This file contains the declaration of the ThreadPool class, a fixed set of worker threads used by the bulk
+ * menu operations (import, analytics).
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+    // Constructors
+    /**
+     * Parameterized constructor.
+     * @param threads The number of worker threads; 0 (the default) uses std::thread::hardware_concurrency().
+     */
+    explicit ThreadPool(std::size_t threads = 0);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Destructor.
+     * Finishes the queued tasks and joins every worker.
+     */
+    ~ThreadPool();
+
+    // Accessors
+    /**
+     * @return The number of worker threads.
+     */
+    std::size_t size() const { return workers_.size(); }
+
+    // Task submission
+    /**
+     * Queues a task to run on a worker thread.
+     * @param task The task to run.
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * Blocks until every task submitted so far has finished.
+     */
+    void wait();
+
+    /**
+     * Runs body(i) for every i in [0, count) on the workers and blocks until all calls have returned.
+     * Indices are handed out dynamically, so uneven work is balanced across threads.
+     * @param count The number of iterations.
+     * @param body The loop body; it must be safe to call concurrently for different indices.
+     */
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& body);
+
+private:
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable task_ready_;
+    std::condition_variable all_done_;
+    std::size_t pending_;
+    bool stopping_;
+
+    // Worker thread main loop
+    void run();
+};
+
+#endif // THREAD_POOL_HPP
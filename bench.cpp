@@ -0,0 +1,1724 @@
+/**
+ * @file bench.cpp
+ * @brief This file contains the benchmarks for the menu data structures.
+ *
+ * Usage: ./bench [filter] [dish counts] [--json file]
+ * Only benchmarks whose name contains `filter` are run. `dish counts` is a comma-separated list of menu sizes such as
+ * 1K,100K,10M (default 1M); every selected benchmark runs once per size on deterministic synthetic menus.
+ *
+ * Each measured section reports ns/op, heap allocations and bytes per op, and the live heap it leaves behind per
+ * dish; derived figures (throughput, footprint) are reported alongside. With --json, every result is also written
+ * to `file` as one JSON object per line, for tracking regressions between builds.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "ChangeLog.hpp"
+#include "ConcurrentMenu.hpp"
+#include "DietaryIndex.hpp"
+#include "Dish.hpp"
+#include "DishPool.hpp"
+#include "DishStore.hpp"
+#include "EnumNames.hpp"
+#include "IngredientIndex.hpp"
+#include "Instrumentation.hpp"
+#include "KitchenScheduler.hpp"
+#include "MainCourse.hpp"
+#include "Menu.hpp"
+#include "MenuAnalytics.hpp"
+#include "MenuArena.hpp"
+#include "MenuImporter.hpp"
+#include "MenuRenderer.hpp"
+#include "MenuSnapshot.hpp"
+#include "MenuStats.hpp"
+#include "NameIndex.hpp"
+#include "NameValidator.hpp"
+#include "OrderPipeline.hpp"
+#include "RangeIndex.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+namespace {
+
+// Heap accounting: every allocation carries a small header recording its size
+std::size_t g_allocations = 0;
+std::size_t g_live_bytes = 0;
+std::size_t g_allocated_bytes = 0;
+constexpr std::size_t kHeader = alignof(std::max_align_t);
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    void* block = std::malloc(size + kHeader);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(block) = size;
+    ++g_allocations;
+    g_allocated_bytes += size;
+    g_live_bytes += size;
+    return static_cast<char*>(block) + kHeader;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (pointer != nullptr) {
+        void* block = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(pointer) - kHeader);
+        g_live_bytes -= *static_cast<std::size_t*>(block);
+        std::free(block);
+    }
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    operator delete(pointer);
+}
+
+// std::pmr::new_delete_resource() allocates through the aligned forms, so they are counted too
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    const std::size_t header = std::max(kHeader, static_cast<std::size_t>(alignment));
+    void* block = std::aligned_alloc(header, (size + 2 * header - 1) / header * header);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(block) = size;
+    ++g_allocations;
+    g_allocated_bytes += size;
+    g_live_bytes += size;
+    return static_cast<char*>(block) + header;
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept {
+    if (pointer != nullptr) {
+        const std::size_t header = std::max(kHeader, static_cast<std::size_t>(alignment));
+        void* block = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(pointer) - header);
+        g_live_bytes -= *static_cast<std::size_t*>(block);
+        std::free(block);
+    }
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept {
+    operator delete(pointer, alignment);
+}
+
+namespace {
+
+// Keeps the optimizer from discarding benchmark results
+volatile std::size_t g_sink = 0;
+
+// The number of dishes in the synthetic menus of the current run
+std::size_t g_dishes = 0;
+
+// The state at the start of a measured section: time and heap counters
+struct Sample {
+    std::chrono::steady_clock::time_point start;
+    std::size_t allocations;
+    std::size_t allocated_bytes;
+    std::size_t live_bytes;
+};
+
+Sample sample() {
+    return {std::chrono::steady_clock::now(), g_allocations, g_allocated_bytes, g_live_bytes};
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// One measured section, or (when unit is set) one derived figure such as a throughput
+struct Result {
+    std::string name;
+    std::size_t dishes = 0;
+    std::size_t ops = 0;
+    double seconds = 0.0;
+    double allocs_per_op = 0.0;
+    double bytes_per_op = 0.0;              // bytes requested from the heap per operation
+    double retained_bytes_per_dish = 0.0;   // growth of the live heap over the section, per dish in the menu
+    std::string unit;
+    double value = 0.0;
+};
+
+std::vector<Result> g_results;
+
+// Records and prints a measured section that started at `since` and performed `ops` operations
+const Result& report(const std::string& name, std::size_t ops, const Sample& since) {
+    const double seconds = secondsSince(since.start);
+    const double per_op = 1.0 / static_cast<double>(std::max<std::size_t>(ops, 1));
+    Result result;
+    result.name = name;
+    result.dishes = g_dishes;
+    result.ops = ops;
+    result.seconds = seconds;
+    result.allocs_per_op = static_cast<double>(g_allocations - since.allocations) * per_op;
+    result.bytes_per_op = static_cast<double>(g_allocated_bytes - since.allocated_bytes) * per_op;
+    result.retained_bytes_per_dish = (static_cast<double>(g_live_bytes) - static_cast<double>(since.live_bytes)) /
+                                     static_cast<double>(std::max<std::size_t>(g_dishes, 1));
+    std::cout << name << ": " << seconds * 1e9 * per_op << " ns/op, " << result.allocs_per_op << " allocs/op, "
+              << result.bytes_per_op << " bytes/op, " << result.retained_bytes_per_dish << " retained bytes/dish ("
+              << ops << " ops in " << seconds << " s)" << std::endl;
+    g_results.push_back(std::move(result));
+    return g_results.back();
+}
+
+// Records and prints a derived figure
+void metric(const std::string& name, const std::string& unit, double value) {
+    Result result;
+    result.name = name;
+    result.dishes = g_dishes;
+    result.unit = unit;
+    result.value = value;
+    std::cout << name << ": " << value << " " << unit << std::endl;
+    g_results.push_back(std::move(result));
+}
+
+// Writes every result as one JSON object per line
+void writeJson(std::ostream& out) {
+    out << std::setprecision(9);
+    for (const Result& result : g_results) {
+        out << "{\"name\":\"" << result.name << "\",\"dishes\":" << result.dishes;
+        if (result.unit.empty()) {
+            out << ",\"ops\":" << result.ops << ",\"seconds\":" << result.seconds
+                << ",\"ns_per_op\":" << result.seconds * 1e9 / static_cast<double>(std::max<std::size_t>(result.ops, 1))
+                << ",\"allocs_per_op\":" << result.allocs_per_op << ",\"bytes_per_op\":" << result.bytes_per_op
+                << ",\"retained_bytes_per_dish\":" << result.retained_bytes_per_dish;
+        } else {
+            out << ",\"unit\":\"" << result.unit << "\",\"value\":" << result.value;
+        }
+        out << "}\n";
+    }
+}
+
+// Parses a dish count such as "5000", "10K" or "10M"; returns 0 if it is malformed
+std::size_t parseCount(const std::string& text) {
+    char* end = nullptr;
+    std::size_t count = std::strtoull(text.c_str(), &end, 10);
+    if (end == text.c_str()) {
+        return 0;
+    }
+    if (*end == 'K' || *end == 'k') {
+        count *= 1000;
+        ++end;
+    } else if (*end == 'M' || *end == 'm') {
+        count *= 1000000;
+        ++end;
+    }
+    return *end == '\0' ? count : 0;
+}
+
+// Generates a deterministic synthetic menu
+std::vector<Dish> makeDishes(std::size_t count, std::uint32_t seed = 42) {
+    static const char* const names[] = {"Grilled Chicken", "Chocolate Cake", "Caesar Salad", "Pad Thai",
+                                        "Beef Tacos", "Butter Chicken", "Onion Soup", "Cheeseburger"};
+    static const char* const ingredients[] = {"Chicken", "Olive Oil", "Garlic", "Rosemary", "Flour", "Sugar",
+                                              "Eggs", "Beef", "Onion", "Tomato", "Basil", "Rice"};
+    std::mt19937 rng(seed);
+    std::vector<Dish> dishes;
+    dishes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::vector<std::string> list;
+        const std::size_t ingredient_count = 3 + rng() % 6;
+        for (std::size_t k = 0; k < ingredient_count; ++k) {
+            list.push_back(ingredients[rng() % 12]);
+        }
+        dishes.emplace_back(names[rng() % 8], list, static_cast<int>(5 + rng() % 80),
+                            static_cast<double>(300 + rng() % 4700) / 100.0,
+                            static_cast<Dish::CuisineType>(rng() % 7));
+    }
+    return dishes;
+}
+
+// Generates a deterministic synthetic list of main courses with long (heap-allocated) protein and side names
+std::vector<MainCourse> makeMainCourses(std::size_t count, std::uint32_t seed = 7) {
+    static const char* const proteins[] = {"Free Range Chicken Breast", "Grass Fed Beef Tenderloin", "Wild Atlantic Salmon"};
+    static const char* const sides[] = {"Garlic Mashed Potatoes", "Roasted Seasonal Vegetables", "Wild Mushroom Risotto"};
+    std::mt19937 rng(seed);
+    std::vector<MainCourse> mains;
+    mains.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::vector<MainCourse::SideDish> side_dishes;
+        for (std::size_t k = 0; k < 1 + rng() % 3; ++k) {
+            side_dishes.push_back({sides[rng() % 3], static_cast<MainCourse::Category>(rng() % 8)});
+        }
+        mains.emplace_back("Chef Special Of The House", std::vector<std::string>{"Garlic", "Olive Oil", "Rosemary"},
+                           static_cast<int>(10 + rng() % 50), static_cast<double>(1000 + rng() % 3000) / 100.0,
+                           static_cast<Dish::CuisineType>(rng() % 7), static_cast<MainCourse::CookingMethod>(rng() % 5),
+                           proteins[rng() % 3], std::move(side_dishes), rng() % 2 == 0);
+    }
+    return mains;
+}
+
+// Generates a deterministic mixed menu: appetizers, main courses and desserts in random order
+std::vector<MenuItem> makeMenuItems(std::size_t count, std::uint32_t seed = 11) {
+    static const char* const proteins[] = {"Free Range Chicken Breast", "Grass Fed Beef Tenderloin", "Wild Atlantic Salmon"};
+    static const char* const sides[] = {"Garlic Mashed Potatoes", "Roasted Seasonal Vegetables", "Wild Mushroom Risotto"};
+    const std::vector<Dish> dishes = makeDishes(count, seed);
+    std::mt19937 rng(seed);
+    std::vector<MenuItem> items;
+    items.reserve(count);
+    for (const Dish& dish : dishes) {
+        const std::vector<std::string> none;
+        switch (rng() % 3) {
+            case 0:
+                items.emplace_back(Appetizer(dish.getNameView(), none, dish.getPrepTime(), dish.getPrice(), dish.getCuisine(),
+                                             static_cast<Appetizer::ServingStyle>(rng() % 3), static_cast<int>(rng() % 10), rng() % 2 == 0));
+                break;
+            case 1: {
+                std::vector<MainCourse::SideDish> side_dishes;
+                for (std::size_t k = 0; k < 1 + rng() % 3; ++k) {
+                    side_dishes.emplace_back(sides[rng() % 3], static_cast<MainCourse::Category>(rng() % 8));
+                }
+                items.emplace_back(MainCourse(dish.getNameView(), none, dish.getPrepTime(), dish.getPrice(), dish.getCuisine(),
+                                              static_cast<MainCourse::CookingMethod>(rng() % 5), proteins[rng() % 3], side_dishes, rng() % 2 == 0));
+                break;
+            }
+            default:
+                items.emplace_back(Dessert(dish.getNameView(), none, dish.getPrepTime(), dish.getPrice(), dish.getCuisine(),
+                                           static_cast<Dessert::FlavorProfile>(rng() % 5), static_cast<int>(rng() % 10), rng() % 2 == 0));
+                break;
+        }
+        std::visit([&](Dish& item) { item.setIngredientIds(dish.getIngredientIds()); }, items.back());
+    }
+    return items;
+}
+
+// Benchmark: constructing each class of the hierarchy from plain strings and values, as a loader would.
+// The source rows are a fixed pool used in turn, so only the constructed menus grow with the dish count.
+void benchConstruction(std::size_t count) {
+    const std::size_t pool = 4096;
+    const std::vector<Dish> dishes = makeDishes(pool);
+    std::vector<std::string> names;
+    std::vector<std::vector<std::string>> ingredients;
+    for (const Dish& dish : dishes) {
+        names.push_back(dish.getName());
+        ingredients.push_back(dish.getIngredients());
+    }
+    const std::vector<MainCourse::SideDish> sides = {{"Garlic Mashed Potatoes", MainCourse::STARCHES},
+                                                     {"Roasted Seasonal Vegetables", MainCourse::VEGETABLE}};
+
+    Sample start = sample();
+    {
+        std::vector<Dish> built;
+        built.reserve(count);
+        for (std::size_t n = 0; n < count; ++n) {
+            const std::size_t i = n % pool;
+            built.emplace_back(names[i], ingredients[i], dishes[i].getPrepTime(), dishes[i].getPrice(), dishes[i].getCuisine());
+        }
+        report("construct/dish", count, start);
+    }
+
+    start = sample();
+    {
+        std::vector<Appetizer> built;
+        built.reserve(count);
+        for (std::size_t n = 0; n < count; ++n) {
+            const std::size_t i = n % pool;
+            built.emplace_back(names[i], ingredients[i], dishes[i].getPrepTime(), dishes[i].getPrice(), dishes[i].getCuisine(),
+                               Appetizer::PLATED, static_cast<int>(n % 10), n % 2 == 0);
+        }
+        report("construct/appetizer", count, start);
+    }
+
+    start = sample();
+    {
+        std::vector<MainCourse> built;
+        built.reserve(count);
+        for (std::size_t n = 0; n < count; ++n) {
+            const std::size_t i = n % pool;
+            built.emplace_back(names[i], ingredients[i], dishes[i].getPrepTime(), dishes[i].getPrice(), dishes[i].getCuisine(),
+                               MainCourse::GRILLED, "Free Range Chicken Breast", sides, n % 2 == 0);
+        }
+        report("construct/main_course", count, start);
+    }
+
+    start = sample();
+    {
+        std::vector<Dessert> built;
+        built.reserve(count);
+        for (std::size_t n = 0; n < count; ++n) {
+            const std::size_t i = n % pool;
+            built.emplace_back(names[i], ingredients[i], dishes[i].getPrepTime(), dishes[i].getPrice(), dishes[i].getCuisine(),
+                               Dessert::SWEET, static_cast<int>(n % 10), n % 2 == 0);
+        }
+        report("construct/dessert", count, start);
+    }
+}
+
+// Compares "price < 20 && prep_time <= 30 && cuisine == ITALIAN" on objects against the columnar store
+void benchDishStoreFilter(std::size_t count) {
+    const std::vector<Dish> dishes = makeDishes(count);
+    const int reps = 20;
+
+    Sample start = sample();
+    for (int rep = 0; rep < reps; ++rep) {
+        std::size_t hits = 0;
+        for (const Dish& dish : dishes) {
+            if (dish.getPrice() < 20.0 && dish.getPrepTime() <= 30 && dish.getCuisineType() == "ITALIAN") {
+                ++hits;
+            }
+        }
+        g_sink = g_sink + hits;
+    }
+    report("filter/per_object", count * reps, start);
+
+    DishStore store;
+    store.reserve(count);
+    store.append(dishes.begin(), dishes.end());
+    DishStore::Filter filter;
+    filter.max_price = 20.0;
+    filter.max_prep_time = 30;
+    filter.cuisine_mask = DishStore::cuisineBit(Dish::CuisineType::ITALIAN);
+
+    start = sample();
+    for (int rep = 0; rep < reps; ++rep) {
+        g_sink = g_sink + store.select(filter).count();
+    }
+    report("filter/dish_store", count * reps, start);
+}
+
+// Reports the heap bytes per dish spent on ingredient lists stored as strings (the old layout) and as interned IDs
+void benchIngredientMemory(std::size_t count) {
+    const std::vector<Dish> dishes = makeDishes(count);
+    std::vector<std::vector<std::string>> as_strings;
+    as_strings.reserve(count);
+    Sample start = sample();
+    for (const Dish& dish : dishes) {
+        as_strings.push_back(dish.getIngredients());
+    }
+    report("ingredients/copy_as_strings", count, start);
+
+    std::vector<Dish> copies;
+    copies.reserve(count);
+    start = sample();
+    copies.insert(copies.end(), dishes.begin(), dishes.end());
+    report("ingredients/copy_interned", count, start);
+
+    metric("ingredients/shared_table", "bytes", static_cast<double>(IngredientTable::global().memoryUsage()));
+    metric("ingredients/sizeof_dish", "bytes", sizeof(Dish));
+    g_sink = g_sink + as_strings.size() + copies.size();
+}
+
+// Compares "contains Garlic but not Beef" through the inverted index against a scan of getIngredients()
+void benchIngredientIndex(std::size_t count) {
+    std::vector<Dish> dishes = makeDishes(count);
+    IngredientIndex index;
+    Sample start = sample();
+    for (std::size_t i = 0; i < dishes.size(); ++i) {
+        dishes[i].setId(static_cast<DishId>(i));
+        index.add(dishes[i]);
+    }
+    report("ingredient_index/build", count, start);
+    metric("ingredient_index/memory", "bytes/dish", static_cast<double>(index.memoryUsage()) / static_cast<double>(count));
+
+    const int reps = 5;
+    start = sample();
+    for (int rep = 0; rep < reps; ++rep) {
+        std::size_t hits = 0;
+        for (const Dish& dish : dishes) {
+            const std::vector<std::string> ingredients = dish.getIngredients();
+            const bool garlic = std::find(ingredients.begin(), ingredients.end(), "Garlic") != ingredients.end();
+            const bool beef = std::find(ingredients.begin(), ingredients.end(), "Beef") != ingredients.end();
+            hits += garlic && !beef;
+        }
+        g_sink = g_sink + hits;
+    }
+    report("ingredient_index/scan_query", reps, start);
+
+    IngredientIndex::Query query;
+    query.require("Garlic").exclude("Beef");
+    start = sample();
+    for (int rep = 0; rep < reps; ++rep) {
+        g_sink = g_sink + index.find(query).size();
+    }
+    report("ingredient_index/index_query", reps, start);
+
+    // Incremental maintenance through the setter
+    for (Dish& dish : dishes) {
+        dish.setObserver(&index);
+    }
+    start = sample();
+    for (std::size_t i = 0; i < count; i += 97) {
+        dishes[i].setIngredients({"Garlic", "Rice"});
+    }
+    report("ingredient_index/set_ingredients", count / 97 + 1, start);
+}
+
+// Counts heap allocations on the copying accessors against the view accessors, and on copy vs move construction
+void benchAccessorAllocations(std::size_t count) {
+    std::vector<MainCourse> mains = makeMainCourses(count);
+
+    Sample start = sample();
+    std::size_t chars = 0;
+    for (const MainCourse& main : mains) {
+        chars += main.getName().size() + main.getProteinType().size();
+        for (const std::string& ingredient : main.getIngredients()) {
+            chars += ingredient.size();
+        }
+        for (const MainCourse::SideDish& side : main.getSideDishes()) {
+            chars += side.name.size();
+        }
+    }
+    report("accessors/copying", count, start);
+
+    start = sample();
+    for (const MainCourse& main : mains) {
+        chars += main.getNameView().size() + main.getProteinTypeView().size();
+        for (std::size_t i = 0; i < main.getIngredientCount(); ++i) {
+            chars += main.getIngredient(i).size();
+        }
+        for (const MainCourse::SideDish& side : main.getSideDishesView()) {
+            chars += side.name.size();
+        }
+    }
+    report("accessors/views", count, start);
+    g_sink = g_sink + chars;
+
+    // Setters: a longer value grows the dish's own buffer once; later values that fit reuse it
+    const std::string protein = "Slow Braised Lamb Shoulder";
+    start = sample();
+    for (MainCourse& main : mains) {
+        main.setProteinType(protein);
+    }
+    report("setters/grow", count, start);
+    const std::string other_protein = "Pan Seared Duck Breast With Figs";
+    start = sample();
+    for (MainCourse& main : mains) {
+        main.setProteinType(protein);
+        main.setProteinType(std::string_view(other_protein).substr(0, protein.size()));
+    }
+    report("setters/reuse", count, start);
+}
+
+// Compares printing a menu with display() (redirected to /dev/null) against one buffered renderMenu() write
+void benchRendering(std::size_t count) {
+    const std::vector<Dish> dishes = makeDishes(count);
+    std::ofstream null_sink("/dev/null");
+    std::streambuf* saved = std::cout.rdbuf();
+
+    // The previous display(): streamed field by field with std::endl on every line
+    Sample start = sample();
+    for (const Dish& dish : dishes) {
+        null_sink << "Dish Name: " << dish.getNameView() << std::endl;
+        null_sink << "Ingredients: ";
+        for (std::size_t i = 0; i < dish.getIngredientCount(); ++i) {
+            null_sink << dish.getIngredient(i);
+            if (i != dish.getIngredientCount() - 1) {
+                null_sink << ", ";
+            }
+        }
+        null_sink << std::endl;
+        null_sink << "Preparation Time: " << dish.getPrepTime() << " minutes" << std::endl;
+        null_sink << std::fixed << std::setprecision(2) << "Price: $" << dish.getPrice() << std::endl;
+        null_sink << "Cuisine Type: " << dish.getCuisineType() << std::endl;
+    }
+    report("render/endl_per_line", count, start);
+
+    std::cout.rdbuf(null_sink.rdbuf());
+    start = sample();
+    for (const Dish& dish : dishes) {
+        dish.display();
+    }
+    std::cout.rdbuf(saved);
+    report("render/display", count, start);
+
+    const MenuRenderer::Format formats[] = {MenuRenderer::Format::TEXT, MenuRenderer::Format::CSV,
+                                            MenuRenderer::Format::JSON_LINES};
+    const char* const names[] = {"render/menu_text", "render/menu_csv", "render/menu_jsonl"};
+    for (int f = 0; f < 3; ++f) {
+        start = sample();
+        const std::size_t bytes = MenuRenderer(formats[f]).renderMenu(dishes.begin(), dishes.end(), null_sink);
+        const double seconds = report(names[f], count, start).seconds;
+        metric(names[f], "MB/s", static_cast<double>(bytes) / seconds / 1e6);
+    }
+}
+
+// Compares cold start from a mapped snapshot against rebuilding the menu with the constructors
+void benchSnapshotStartup(std::size_t count) {
+    const std::vector<MainCourse> mains = makeMainCourses(count);
+    const std::string path = "/tmp/bench_menu_snapshot.bin";
+    Sample start = sample();
+    MenuSnapshot::write(path, Span<const Appetizer>(), mains, Span<const Dessert>());
+    report("snapshot/write", count, start);
+
+    // The source data a service would rebuild from: plain strings and values
+    std::vector<std::vector<std::string>> ingredients;
+    std::vector<std::vector<MainCourse::SideDish>> sides;
+    for (const MainCourse& main : mains) {
+        ingredients.push_back(main.getIngredients());
+        sides.push_back(main.getSideDishes());
+    }
+    start = sample();
+    {
+        std::vector<MainCourse> rebuilt;
+        rebuilt.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            rebuilt.emplace_back(mains[i].getName(), ingredients[i], mains[i].getPrepTime(), mains[i].getPrice(),
+                                 mains[i].getCuisine(), mains[i].getCookingMethod(), mains[i].getProteinType(), sides[i],
+                                 mains[i].isGlutenFree());
+        }
+        g_sink = g_sink + rebuilt.size();
+    }
+    report("snapshot/rebuild_constructors", count, start);
+
+    start = sample();
+    {
+        const MenuSnapshot snapshot = MenuSnapshot::open(path);
+        g_sink = g_sink + snapshot.mainCourseCount();
+    }
+    report("snapshot/open", count, start);
+
+    start = sample();
+    {
+        const MenuSnapshot snapshot = MenuSnapshot::open(path);
+        double total = 0.0;
+        std::size_t chars = 0;
+        for (std::size_t i = 0; i < snapshot.mainCourseCount(); ++i) {
+            const MenuSnapshot::MainCourseView view = snapshot.mainCourse(i);
+            total += view.getPrice();
+            chars += view.getName().size() + view.getProteinType().size();
+        }
+        g_sink = g_sink + chars + static_cast<std::size_t>(total);
+    }
+    report("snapshot/open_and_scan", count, start);
+    std::remove(path.c_str());
+}
+
+// Benchmark: building and tearing down a menu of main courses with the default allocator vs a MenuArena
+void benchArena(std::size_t count) {
+    const std::vector<MainCourse> source = makeMainCourses(count);
+
+    std::optional<std::vector<MainCourse>> heap_menu;
+    Sample start = sample();
+    heap_menu.emplace();
+    heap_menu->reserve(count);
+    for (const MainCourse& main : source) {
+        heap_menu->emplace_back(main);
+    }
+    report("arena/build_default", count, start);
+
+    start = sample();
+    heap_menu.reset();
+    report("arena/teardown_default", count, start);
+
+    MenuArena arena;
+    std::optional<std::pmr::vector<MainCourse>> arena_menu;
+    start = sample();
+    arena_menu.emplace(arena.allocator());
+    arena_menu->reserve(count);
+    for (const MainCourse& main : source) {
+        arena_menu->emplace_back(main);  // copied into the arena by the allocator-extended copy constructor
+    }
+    report("arena/build_arena", count, start);
+    metric("arena/build_arena", "arena bytes/dish", static_cast<double>(arena.bytesReserved()) / static_cast<double>(count));
+
+    start = sample();
+    arena_menu.reset();
+    arena.release();
+    report("arena/teardown_arena", count, start);
+}
+
+// Benchmark: importing a rendered menu of main courses with 1, 2, 4, ... parser threads
+void benchImport(std::size_t count) {
+    const std::vector<MainCourse> mains = makeMainCourses(count);
+    const std::size_t max_threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    const MenuRenderer::Format formats[] = {MenuRenderer::Format::CSV, MenuRenderer::Format::JSON_LINES};
+    const char* const names[] = {"import/csv", "import/jsonl"};
+    for (int f = 0; f < 2; ++f) {
+        std::string data;
+        MenuRenderer(formats[f]).renderMenu(mains.begin(), mains.end(), data);
+        for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+            const MenuImporter importer(formats[f], threads);
+            const Sample start = sample();
+            const MenuImporter::Result result = importer.importBuffer(data);
+            const std::string name = std::string(names[f]) + "/threads_" + std::to_string(threads);
+            const double seconds = report(name, count, start).seconds;
+            g_sink = g_sink + result.imported() + result.errors.size();
+            metric(name, "MB/s", static_cast<double>(data.size()) / seconds / 1e6);
+        }
+    }
+}
+
+// Benchmark: validating a batch of dish names with each validator implementation
+void benchNameValidator(std::size_t count) {
+    static const char* const names[] = {"Grilled Chicken", "Chef Special Of The House", "Slow Braised Lamb Shoulder With Rosemary",
+                                        "Pad Thai", "Wild Atlantic Salmon", "Caesar Salad"};
+    std::vector<std::string_view> batch;
+    batch.reserve(count);
+    std::size_t bytes = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        batch.push_back(names[i % 6]);
+        bytes += batch.back().size();
+    }
+
+    const NameValidatorIsa isas[] = {NameValidatorIsa::LOCALE, NameValidatorIsa::SCALAR, NameValidatorIsa::SSE2, NameValidatorIsa::AVX2};
+    const char* const labels[] = {"name_validator/locale", "name_validator/scalar", "name_validator/sse2", "name_validator/avx2"};
+    for (int k = 0; k < 4; ++k) {
+        const Sample start = sample();
+        g_sink = g_sink + validateDishNames(batch, isas[k]).count();
+        const double seconds = report(labels[k], count, start).seconds;
+        metric(labels[k], "MB/s", static_cast<double>(bytes) / seconds / 1e6);
+    }
+}
+
+// Benchmark: parsing enum names with a linear scan of the names against the compile-time perfect hash
+void benchEnumNames(std::size_t count) {
+    constexpr auto& names = EnumTraits<MainCourse::Category>::names;
+    std::mt19937 rng(3);
+    std::vector<std::string> inputs;
+    inputs.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        inputs.emplace_back(names[rng() % names.size()]);
+    }
+
+    std::size_t total = 0;
+    Sample start = sample();
+    for (const std::string& input : inputs) {
+        for (std::size_t k = 0; k < names.size(); ++k) {
+            if (names[k] == input) {
+                total += k;
+                break;
+            }
+        }
+    }
+    report("enum_names/parse_linear", count, start);
+
+    start = sample();
+    for (const std::string& input : inputs) {
+        MainCourse::Category category = MainCourse::GRAIN;
+        fromString(input, category);
+        total += category;
+    }
+    report("enum_names/parse_perfect_hash", count, start);
+    g_sink = g_sink + total;
+}
+
+// The design Menu replaces: one heap object per dish behind a pointer, subclass fields reached through virtual calls
+struct PolyDish {
+    virtual ~PolyDish() = default;
+    virtual const Dish& dish() const = 0;
+    virtual bool dietarySafe() const = 0;
+};
+
+template <typename T>
+struct PolyHolder final : PolyDish {
+    T value;
+    explicit PolyHolder(const T& item) : value(item) {}
+    const Dish& dish() const override { return value; }
+    bool dietarySafe() const override;
+};
+
+template <> bool PolyHolder<Appetizer>::dietarySafe() const { return value.isVegetarian(); }
+template <> bool PolyHolder<MainCourse>::dietarySafe() const { return value.isGlutenFree(); }
+template <> bool PolyHolder<Dessert>::dietarySafe() const { return !value.containsNuts(); }
+
+struct DietarySafe {
+    bool operator()(const Appetizer& appetizer) const { return appetizer.isVegetarian(); }
+    bool operator()(const MainCourse& main_course) const { return main_course.isGlutenFree(); }
+    bool operator()(const Dessert& dessert) const { return !dessert.containsNuts(); }
+};
+
+// Benchmark: a mixed menu in a Menu (per-kind vectors, switch dispatch) against vector<unique_ptr<PolyDish>>
+void benchMenu(std::size_t count) {
+    const std::vector<MenuItem> items = makeMenuItems(count);
+    const int rounds = 10;
+
+    std::optional<std::vector<std::unique_ptr<PolyDish>>> pointers;
+    Sample start = sample();
+    pointers.emplace();
+    pointers->reserve(count);
+    for (const MenuItem& item : items) {
+        std::visit([&](const auto& dish) {
+            pointers->push_back(std::make_unique<PolyHolder<std::decay_t<decltype(dish)>>>(dish));
+        }, item);
+    }
+    report("menu/build_pointers", count, start);
+
+    std::optional<Menu> menu;
+    start = sample();
+    menu.emplace();
+    menu->reserve(count, count, count);
+    for (const MenuItem& item : items) {
+        std::visit([&](const auto& dish) { menu->emplace<std::decay_t<decltype(dish)>>(dish); }, item);
+    }
+    report("menu/build_menu", count, start);
+
+    // Aggregate over a common field
+    double total = 0.0;
+    start = sample();
+    for (int round = 0; round < rounds; ++round) {
+        for (const std::unique_ptr<PolyDish>& pointer : *pointers) {
+            total += pointer->dish().getPrice();
+        }
+    }
+    report("menu/sum_price_pointers", count * rounds, start);
+
+    start = sample();
+    for (int round = 0; round < rounds; ++round) {
+        total = menu->accumulate(total, [](double sum, const Dish& dish) { return sum + dish.getPrice(); });
+    }
+    report("menu/sum_price_visit", count * rounds, start);
+
+    start = sample();
+    for (int round = 0; round < rounds; ++round) {
+        for (const Appetizer& appetizer : menu->appetizers()) {
+            total += appetizer.getPrice();
+        }
+        for (const MainCourse& main_course : menu->mainCourses()) {
+            total += main_course.getPrice();
+        }
+        for (const Dessert& dessert : menu->desserts()) {
+            total += dessert.getPrice();
+        }
+    }
+    report("menu/sum_price_subranges", count * rounds, start);
+    g_sink = g_sink + static_cast<std::size_t>(total);
+
+    // Filter on subclass fields
+    std::size_t kept = 0;
+    start = sample();
+    for (int round = 0; round < rounds; ++round) {
+        std::vector<std::size_t> positions;
+        for (std::size_t i = 0; i < pointers->size(); ++i) {
+            if ((*pointers)[i]->dietarySafe()) {
+                positions.push_back(i);
+            }
+        }
+        kept += positions.size();
+    }
+    report("menu/filter_virtual", count * rounds, start);
+
+    start = sample();
+    for (int round = 0; round < rounds; ++round) {
+        kept += menu->filter(DietarySafe()).size();
+    }
+    report("menu/filter_visit", count * rounds, start);
+    g_sink = g_sink + kept;
+
+    start = sample();
+    pointers.reset();
+    report("menu/teardown_pointers", count, start);
+
+    start = sample();
+    menu.reset();
+    report("menu/teardown_menu", count, start);
+}
+
+// Benchmark: "vegetarian and nut-free, unknown allowed" by visiting every dish against the dietary bitset index
+void benchDietaryIndex(std::size_t count) {
+    const std::vector<MenuItem> items = makeMenuItems(count);
+    Menu menu;
+    menu.reserve(count, count, count);
+    for (const MenuItem& item : items) {
+        menu.add(item);
+    }
+    const int rounds = 10;
+
+    struct VegetarianNutFree {
+        bool operator()(const Appetizer& appetizer) const { return appetizer.isVegetarian(); }
+        bool operator()(const MainCourse&) const { return true; }
+        bool operator()(const Dessert& dessert) const { return !dessert.containsNuts(); }
+    };
+    std::size_t kept = 0;
+    Sample start = sample();
+    for (int round = 0; round < rounds; ++round) {
+        kept += menu.filter(VegetarianNutFree()).size();
+    }
+    report("dietary/visit", count * rounds, start);
+
+    DietaryIndex index;
+    start = sample();
+    menu.forEach([&](const Dish& dish) { index.add(dish); });
+    report("dietary/build_index", count, start);
+    metric("dietary/index_memory", "bytes/dish", static_cast<double>(index.memoryUsage()) / static_cast<double>(count));
+
+    const Dish::DietaryMask required = Dish::VEGETARIAN | Dish::NUT_FREE;
+    start = sample();
+    for (int round = 0; round < rounds; ++round) {
+        kept += index.select(required, DietaryIndex::Unknown::INCLUDE).count();
+    }
+    report("dietary/index_count", count * rounds, start);
+
+    start = sample();
+    for (int round = 0; round < rounds; ++round) {
+        kept += index.find(required, DietaryIndex::Unknown::INCLUDE).size();
+    }
+    report("dietary/index_find", count * rounds, start);
+    g_sink = g_sink + kept;
+}
+
+// Benchmark: simulating a stream of orders over kitchens of 8 stations at 80% load, with 1, 2, 4, ... threads
+void benchKitchenScheduler(std::size_t count) {
+    const std::vector<Dish> dishes = makeDishes(4096);
+    std::vector<int> prep_times;
+    long long total_minutes = 0;
+    for (const Dish& dish : dishes) {
+        prep_times.push_back(dish.getPrepTime());
+        total_minutes += dish.getPrepTime();
+    }
+    const double minutes_per_dish = static_cast<double>(total_minutes) / static_cast<double>(dishes.size());
+    const std::size_t stations = 8;
+    const std::size_t max_threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        const std::size_t kitchens = threads;
+        // 1 to 4 dishes per order, with Poisson arrivals spaced for an offered load of 80% of the stations
+        const double spacing = 2.5 * minutes_per_dish / (0.8 * static_cast<double>(stations * kitchens));
+        std::mt19937 rng(17);
+        std::exponential_distribution<double> gap(1.0 / spacing);
+        std::vector<KitchenOrder> orders(count);
+        double clock = 0.0;
+        for (KitchenOrder& order : orders) {
+            clock += gap(rng);
+            order.arrival = clock;
+            for (std::size_t k = 0; k < 1 + rng() % 4; ++k) {
+                order.dishes.push_back(static_cast<DishId>(rng() % prep_times.size()));
+            }
+        }
+
+        const KitchenScheduler scheduler(stations, kitchens, threads);
+        const std::string name = "kitchen/threads_" + std::to_string(threads);
+        const Sample start = sample();
+        const KitchenScheduler::Report schedule = scheduler.schedule(prep_times, orders);
+        const double seconds = report(name, count, start).seconds;
+        double utilization = 0.0;
+        for (std::size_t station = 0; station < schedule.station_busy.size(); ++station) {
+            utilization += schedule.utilization(station) / static_cast<double>(schedule.station_busy.size());
+        }
+        metric(name, "orders/s", static_cast<double>(count) / seconds);
+        metric(name, "mean utilization", utilization);
+        metric(name, "p99 latency minutes", schedule.p99_latency);
+    }
+}
+
+// The queue the pipeline replaces: a std::deque of Dish copies behind a mutex
+class LockedDishQueue {
+public:
+    void push(const Dish& dish) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dishes_.push_back(dish);
+    }
+
+    bool tryPop(Dish& dish) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (dishes_.empty()) {
+            return false;
+        }
+        dish = std::move(dishes_.front());
+        dishes_.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    std::deque<Dish> dishes_;
+};
+
+// Benchmark: 1 to 64 terminal threads submitting orders through the lock-free pipeline, against pushing Dish copies
+// through a mutex-guarded queue; reports throughput and submit-to-take latency percentiles
+void benchOrderPipeline(std::size_t count) {
+    const std::vector<MenuItem> items = makeMenuItems(1000);
+    Menu menu;
+    for (const MenuItem& item : items) {
+        menu.add(item);
+    }
+    auto nowNs = [] {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    };
+
+    for (std::size_t producers = 1; producers <= 64 && producers <= count; producers *= 2) {  // at least one order each
+        const std::size_t per_producer = count / producers;
+        const std::size_t total = per_producer * producers;
+        const std::string suffix = "/producers_" + std::to_string(producers);
+
+        std::vector<std::uint64_t> latencies;
+        latencies.reserve(total);
+        Sample start = sample();
+        {
+            OrderPipeline pipeline(menu);
+            std::thread consumer([&] {
+                Order order;
+                while (pipeline.take(order)) {
+                    latencies.push_back(nowNs() - order.getSubmittedNs());
+                }
+            });
+            std::vector<std::thread> terminals;
+            for (std::size_t t = 0; t < producers; ++t) {
+                terminals.emplace_back([&, t] {
+                    std::mt19937 rng(static_cast<std::uint32_t>(t));
+                    for (std::size_t i = 0; i < per_producer; ++i) {
+                        Order order(i, static_cast<std::uint32_t>(t));
+                        const std::size_t lines = 1 + rng() % 5;
+                        for (std::size_t k = 0; k < lines; ++k) {
+                            const DishId dish = static_cast<DishId>(rng() % menu.size());
+                            order.addLine(dish, static_cast<std::uint16_t>(1 + rng() % 2));
+                        }
+                        pipeline.submit(order);
+                    }
+                });
+            }
+            for (std::thread& terminal : terminals) {
+                terminal.join();
+            }
+            pipeline.close();
+            consumer.join();
+        }
+        const double seconds = report("orders/pipeline" + suffix, total, start).seconds;
+        metric("orders/pipeline" + suffix, "orders/s", static_cast<double>(total) / seconds);
+        std::sort(latencies.begin(), latencies.end());
+        for (const auto& [label, fraction] : {std::pair<const char*, double>{"p50", 0.50}, {"p99", 0.99}, {"p999", 0.999}}) {
+            const std::size_t rank = static_cast<std::size_t>(fraction * static_cast<double>(latencies.size() - 1));
+            metric("orders/pipeline" + suffix, std::string(label) + " latency us", static_cast<double>(latencies[rank]) / 1e3);
+        }
+
+        // Baseline: every line of every order pushed as a Dish copy through one locked queue
+        LockedDishQueue queue;
+        std::atomic<bool> done(false);
+        start = sample();
+        {
+            std::thread consumer([&] {
+                Dish dish;
+                for (;;) {
+                    const bool last = done.load(std::memory_order_acquire);
+                    if (queue.tryPop(dish)) {
+                        continue;
+                    }
+                    if (last) {
+                        break;
+                    }
+                    std::this_thread::yield();
+                }
+            });
+            std::vector<std::thread> terminals;
+            for (std::size_t t = 0; t < producers; ++t) {
+                terminals.emplace_back([&, t] {
+                    std::mt19937 rng(static_cast<std::uint32_t>(t));
+                    for (std::size_t i = 0; i < per_producer; ++i) {
+                        const std::size_t lines = 1 + rng() % 5;
+                        for (std::size_t k = 0; k < lines; ++k) {
+                            const std::size_t dish = rng() % menu.size();
+                            rng();  // the quantity, drawn so that both runs see the same orders
+                            queue.push(menu[dish]);
+                        }
+                    }
+                });
+            }
+            for (std::thread& terminal : terminals) {
+                terminal.join();
+            }
+            done.store(true, std::memory_order_release);
+            consumer.join();
+        }
+        report("orders/locked_dish_queue" + suffix, total, start);
+    }
+}
+
+// Benchmark: readers pricing 4-dish lookups from ConcurrentMenu snapshots while a writer publishes 16-price batches
+// without pause, against the same work on a Menu behind a std::shared_mutex
+void benchConcurrentMenu(std::size_t count) {
+    const std::vector<MenuItem> items = makeMenuItems(1000);
+    Menu menu;
+    for (const MenuItem& item : items) {
+        menu.add(item);
+    }
+    const std::size_t batch = 16;
+
+    for (std::size_t readers = 1; readers <= 4; readers *= 2) {
+        const std::size_t per_reader = count / readers;
+        const std::size_t total = per_reader * readers;
+        const std::string suffix = "/readers_" + std::to_string(readers);
+
+        // Both variants run the same loops; read() and write() differ
+        auto run = [&](const std::string& name, auto&& read, auto&& write) {
+            std::atomic<std::size_t> active(readers);
+            std::size_t writes = 0;
+            double checksum = 0.0;
+            const Sample start = sample();
+            std::thread writer([&] {
+                std::mt19937 rng(1);
+                while (active.load(std::memory_order_relaxed) != 0) {
+                    write(rng);
+                    ++writes;
+                }
+            });
+            std::vector<std::thread> threads;
+            std::vector<double> sums(readers);
+            for (std::size_t r = 0; r < readers; ++r) {
+                threads.emplace_back([&, r] {
+                    std::mt19937 rng(static_cast<std::uint32_t>(100 + r));
+                    for (std::size_t i = 0; i < per_reader; ++i) {
+                        sums[r] += read(rng);
+                    }
+                    active.fetch_sub(1, std::memory_order_relaxed);
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+            writer.join();
+            for (double sum : sums) {
+                checksum += sum;
+            }
+            const double seconds = report(name + suffix, total, start).seconds;
+            metric(name + suffix, "reads/s", static_cast<double>(total) / seconds);
+            metric(name + suffix, "batches/s", static_cast<double>(writes) / seconds);
+            g_sink = g_sink + static_cast<std::size_t>(checksum);
+        };
+
+        ConcurrentMenu shared(menu);
+        run("concurrent_menu/snapshot",
+            [&](std::mt19937& rng) {
+                const ConcurrentMenu::Snapshot snapshot = shared.snapshot();
+                double total_price = 0.0;
+                for (int k = 0; k < 4; ++k) {
+                    total_price += snapshot[rng() % snapshot.size()].getPrice();
+                }
+                return total_price;
+            },
+            [&](std::mt19937& rng) {
+                ConcurrentMenu::Update update;
+                for (std::size_t k = 0; k < batch; ++k) {
+                    update.setPrice(rng() % menu.size(), static_cast<double>(rng() % 5000) / 100.0);
+                }
+                shared.publish(update);
+            });
+
+        Menu locked_menu;
+        for (const MenuItem& item : items) {
+            locked_menu.add(item);
+        }
+        std::shared_mutex mutex;
+        run("concurrent_menu/shared_mutex",
+            [&](std::mt19937& rng) {
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                double total_price = 0.0;
+                for (int k = 0; k < 4; ++k) {
+                    total_price += locked_menu[rng() % locked_menu.size()].getPrice();
+                }
+                return total_price;
+            },
+            [&](std::mt19937& rng) {
+                std::unique_lock<std::shared_mutex> lock(mutex);
+                for (std::size_t k = 0; k < batch; ++k) {
+                    const double price = static_cast<double>(rng() % 5000) / 100.0;
+                    locked_menu.visit(rng() % locked_menu.size(), [price](auto& dish) { dish.setPrice(price); });
+                }
+            });
+    }
+}
+
+// Benchmark: grouped price/prep-time statistics with MenuAnalytics on 1 to hardware_concurrency() threads, sketched
+// and exact, against a hand-written serial loop that groups by the cuisine string and sorts each group
+void benchAnalytics(std::size_t count) {
+    std::vector<MenuItem> items = makeMenuItems(count);
+    Menu menu;
+    for (MenuItem& item : items) {
+        menu.add(std::move(item));
+    }
+    items = std::vector<MenuItem>();
+
+    Sample start = sample();
+    std::map<std::string, std::vector<double>> prices;
+    std::map<std::string, std::vector<double>> prep_times;
+    menu.forEach([&](const Dish& dish) {
+        prices[dish.getCuisineType()].push_back(dish.getPrice());
+        prep_times[dish.getCuisineType()].push_back(dish.getPrepTime());
+    });
+    double checksum = 0.0;
+    for (auto* groups : {&prices, &prep_times}) {
+        for (auto& [cuisine, values] : *groups) {
+            std::sort(values.begin(), values.end());
+            checksum += values[values.size() / 2] + values[values.size() * 95 / 100];
+        }
+    }
+    report("analytics/hand_loop_strings", count, start);
+    g_sink = g_sink + static_cast<std::size_t>(checksum);
+
+    const std::size_t cores = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    std::vector<std::size_t> thread_counts;
+    for (std::size_t threads = 1; threads < cores; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(cores);
+    for (const auto& [label, quantiles] : {std::pair<const char*, MenuAnalytics::Quantiles>{"sketch", MenuAnalytics::Quantiles::SKETCH},
+                                           {"exact", MenuAnalytics::Quantiles::EXACT}}) {
+        double serial_seconds = 0.0;
+        for (std::size_t threads : thread_counts) {
+            const MenuAnalytics analytics(threads);
+            const std::string name = std::string("analytics/") + label + "/threads_" + std::to_string(threads);
+            start = sample();
+            const MenuAnalytics::Report result = analytics.analyze(menu, quantiles);
+            const double seconds = report(name, count, start).seconds;
+            serial_seconds = threads == 1 ? seconds : serial_seconds;
+            metric(name, "Mdishes/s", static_cast<double>(count) / seconds / 1e6);
+            metric(name, "speedup", serial_seconds / seconds);
+            g_sink = g_sink + result.overall.price.count;
+        }
+    }
+}
+
+// Benchmark: dashboard queries on Menu::stats() against recomputing the aggregates with a scan, and the cost the
+// running statistics add to a setter call
+void benchMenuStats(std::size_t count) {
+    std::vector<MenuItem> items = makeMenuItems(count);
+    Menu menu;
+    for (MenuItem& item : items) {
+        menu.add(std::move(item));
+    }
+    items = std::vector<MenuItem>();
+
+    const std::size_t queries = 1000000;
+    double checksum = 0.0;
+    Sample start = sample();
+    for (std::size_t i = 0; i < queries; ++i) {
+        const MenuStats& stats = menu.stats();
+        checksum += stats.totalPrice() + stats.meanPrepTime() +
+                    static_cast<double>(stats.cuisineCount(static_cast<Dish::CuisineType>(i % MenuStats::kCuisineCount)));
+    }
+    report("menu_stats/query", queries, start);
+
+    const std::size_t scans = std::max<std::size_t>(1, 10000000 / std::max<std::size_t>(count, 1));
+    start = sample();
+    for (std::size_t i = 0; i < scans; ++i) {
+        const MenuStats stats = MenuStats::compute(menu);
+        checksum += stats.totalPrice() + stats.meanPrepTime();
+    }
+    report("menu_stats/recompute", scans, start);
+
+    const std::size_t updates = 1000000;
+    std::mt19937 rng(3);
+    start = sample();
+    for (std::size_t i = 0; i < updates; ++i) {
+        menu.visit(rng() % menu.size(), [&](auto& dish) { dish.setPrice(static_cast<double>(rng() % 5000) / 100.0); });
+    }
+    report("menu_stats/update_price", updates, start);
+    g_sink = g_sink + static_cast<std::size_t>(checksum) + (menu.verifyStats() ? 1 : 0);
+}
+
+// Benchmark: the record size of each dish class, and a scan that filters on the packed cuisine and sums the prices
+void benchPackedLayout(std::size_t count) {
+    metric("layout/sizeof", "Dish bytes", static_cast<double>(sizeof(Dish)));
+    metric("layout/sizeof", "Appetizer bytes", static_cast<double>(sizeof(Appetizer)));
+    metric("layout/sizeof", "MainCourse bytes", static_cast<double>(sizeof(MainCourse)));
+    metric("layout/sizeof", "Dessert bytes", static_cast<double>(sizeof(Dessert)));
+
+    const std::vector<Dish> dishes = makeDishes(count);
+    const std::size_t passes = std::max<std::size_t>(1, 20000000 / std::max<std::size_t>(count, 1));
+    std::int64_t cents = 0;
+    Sample start = sample();
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        for (const Dish& dish : dishes) {
+            cents += dish.getCuisine() == Dish::CuisineType::ITALIAN ? dish.getPriceCents() : 0;
+        }
+    }
+    report("layout/scan_cuisine_price", passes * dishes.size(), start);
+    g_sink = g_sink + static_cast<std::size_t>(cents);
+}
+
+// Benchmark: fuzzy search and autocomplete on a NameIndex over a catalog of distinct three-word names, with p50/p99
+// per-query latency, against a substring scan that copies every name with getName(); and renames through setName
+void benchNameIndex(std::size_t count) {
+    const char* styles[] = {"Grilled", "Smoked", "Roasted", "Crispy", "Spicy", "Braised", "Steamed", "Fried", "Glazed",
+                            "Stuffed", "Poached", "Seared", "Charred", "Pickled", "Sweet", "Tangy", "Creamy", "Herbed",
+                            "Garlic", "Lemon", "Honey", "Pepper", "Sesame", "Ginger", "Chili", "Truffle", "Maple",
+                            "Mustard", "Basil", "Curry", "Saffron", "Smoky", "Zesty", "Rustic", "Classic", "House"};
+    const char* mains[] = {"Chicken", "Salmon", "Tofu", "Beef", "Pork", "Lamb", "Shrimp", "Duck", "Cod", "Tuna", "Mushroom",
+                           "Eggplant", "Cauliflower", "Halloumi", "Paneer", "Lentil", "Chickpea", "Squash", "Octopus",
+                           "Scallop", "Turkey", "Venison", "Quail", "Crab", "Lobster", "Trout", "Spinach", "Potato",
+                           "Tomato", "Pepper", "Corn", "Bean", "Rice", "Noodle", "Dumpling", "Avocado", "Artichoke",
+                           "Fennel", "Beet", "Carrot", "Zucchini", "Kale", "Mackerel", "Sardine", "Brisket", "Rib"};
+    const char* forms[] = {"Salad", "Tacos", "Curry", "Soup", "Stew", "Burger", "Sandwich", "Skewers", "Bowl", "Pie",
+                           "Risotto", "Pasta", "Ramen", "Wrap", "Platter", "Tart", "Gratin", "Fritters", "Kebab", "Pizza",
+                           "Casserole", "Chowder", "Noodles", "Bake", "Roll", "Melt", "Pot", "Hash", "Sliders", "Bites"};
+    std::mt19937 rng(11);
+    std::vector<Dish> dishes;
+    dishes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string name = std::string(styles[rng() % 36]) + " " + mains[rng() % 46] + " " + forms[rng() % 30];
+        dishes.emplace_back(name);
+        dishes.back().setId(static_cast<DishId>(i));
+    }
+
+    NameIndex index;
+    Sample start = sample();
+    for (const Dish& dish : dishes) {
+        index.add(dish);
+    }
+    report("names/build_index", count, start);
+    metric("names/index_memory", "bytes/dish", static_cast<double>(index.memoryUsage()) / static_cast<double>(count));
+    metric("names/index_memory", "distinct names", static_cast<double>(index.termCount()));
+
+    // Queries as typed: a misspelled name (one character dropped) for search, its first 1 to 8 characters for completion
+    const std::size_t queries = 2000;
+    std::vector<std::string> typos;
+    std::vector<std::string> prefixes;
+    for (std::size_t i = 0; i < queries; ++i) {
+        std::string name = dishes[rng() % count].getName();
+        prefixes.push_back(name.substr(0, 1 + rng() % 8));
+        name.erase(rng() % name.size(), 1);
+        typos.push_back(name);
+    }
+    auto latencies = [&](const std::string& name, const std::vector<std::string>& inputs, auto&& query) {
+        std::vector<double> micros;
+        micros.reserve(inputs.size());
+        std::size_t results = 0;
+        Sample begin = sample();
+        for (const std::string& input : inputs) {
+            const auto before = std::chrono::steady_clock::now();
+            results += query(input);
+            micros.push_back(secondsSince(before) * 1e6);
+        }
+        report(name, inputs.size(), begin);
+        std::sort(micros.begin(), micros.end());
+        for (const auto& [label, fraction] : {std::pair<const char*, double>{"p50", 0.50}, {"p99", 0.99}, {"max", 1.0}}) {
+            const std::size_t rank = static_cast<std::size_t>(fraction * static_cast<double>(micros.size() - 1));
+            metric(name, std::string(label) + " latency us", micros[rank]);
+        }
+        g_sink = g_sink + results;
+    };
+    latencies("names/search", typos, [&](const std::string& query) { return index.search(query).size(); });
+    latencies("names/complete", prefixes, [&](const std::string& prefix) { return index.complete(prefix).size(); });
+
+    // Baseline: case-insensitive substring match over a copy of every name, for a few queries
+    auto lower = [](std::string text) {
+        std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return text;
+    };
+    const std::vector<std::string> scan_queries(prefixes.begin(), prefixes.begin() + 10);
+    latencies("names/scan_substring", scan_queries, [&](const std::string& prefix) {
+        const std::string needle = lower(prefix);
+        std::size_t found = 0;
+        for (const Dish& dish : dishes) {
+            found += lower(dish.getName()).find(needle) != std::string::npos ? 1 : 0;
+        }
+        return found;
+    });
+
+    // Renames through the observer hook
+    for (Dish& dish : dishes) {
+        dish.setObserver(&index);
+    }
+    const std::size_t renames = std::min<std::size_t>(count, 100000);
+    start = sample();
+    for (std::size_t i = 0; i < renames; ++i) {
+        dishes[rng() % count].setName(std::string(styles[rng() % 36]) + " " + mains[rng() % 46] + " " + forms[rng() % 30]);
+    }
+    report("names/rename", renames, start);
+}
+
+// Benchmark: hashing every dish of a menu merged from 20 locations that mostly share one catalog, and hash-consing it
+// with a DishPool against std::unordered_set copies per class; reports the dedup ratio and the memory saved
+void benchDishPool(std::size_t count) {
+    const std::size_t locations = 20;
+    const std::vector<MenuItem> catalog = makeMenuItems(std::max<std::size_t>(1, count / locations));
+    std::mt19937 rng(9);
+    std::vector<MenuItem> merged;
+    merged.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        merged.push_back(catalog[rng() % catalog.size()]);
+        if (rng() % 20 == 0) {  // a local price
+            std::visit([&](Dish& dish) { dish.setPrice(static_cast<double>(300 + rng() % 4700) / 100.0); }, merged.back());
+        }
+    }
+
+    std::uint64_t hashes = 0;
+    Sample start = sample();
+    for (const MenuItem& item : merged) {
+        hashes ^= std::visit([](const auto& dish) { return dish.hash(); }, item);
+    }
+    report("dish_pool/hash", count, start);
+
+    std::size_t distinct = 0;
+    {
+        std::unordered_set<Appetizer> appetizers;
+        std::unordered_set<MainCourse> main_courses;
+        std::unordered_set<Dessert> desserts;
+        start = sample();
+        for (const MenuItem& item : merged) {
+            if (const auto* appetizer = std::get_if<Appetizer>(&item)) {
+                appetizers.insert(*appetizer);
+            } else if (const auto* main_course = std::get_if<MainCourse>(&item)) {
+                main_courses.insert(*main_course);
+            } else {
+                desserts.insert(std::get<Dessert>(item));
+            }
+        }
+        report("dish_pool/unordered_set_copies", count, start);
+        distinct = appetizers.size() + main_courses.size() + desserts.size();
+    }
+
+    DishPool pool;
+    start = sample();
+    for (const MenuItem& item : merged) {
+        std::visit([&pool](const auto& dish) { pool.intern(dish); }, item);
+    }
+    report("dish_pool/intern", count, start);
+    const DishPool::Stats& stats = pool.stats();
+    metric("dish_pool/intern", "dedup ratio", stats.dedupRatio());
+    metric("dish_pool/intern", "MB merged", static_cast<double>(stats.bytes_held + stats.bytes_saved) / 1e6);
+    metric("dish_pool/intern", "MB saved", static_cast<double>(stats.bytes_saved) / 1e6);
+    metric("dish_pool/intern", "MB pool", static_cast<double>(pool.memoryUsage()) / 1e6);
+    g_sink = g_sink + static_cast<std::size_t>(hashes) + (pool.size() == distinct ? 1 : 0);
+}
+
+// Benchmark: "under $X, ready in Y minutes" queries on a RangeIndex against a linear scan of the dishes, at a selective
+// and a broad mix of bounds; top-10 cheapest against a scan with a bounded heap; and updates through setPrice
+void benchRangeIndex(std::size_t count) {
+    std::vector<Dish> dishes = makeDishes(count);
+    RangeIndex index;
+    Sample start = sample();
+    for (std::size_t i = 0; i < dishes.size(); ++i) {
+        dishes[i].setId(static_cast<DishId>(i));
+        index.add(dishes[i]);
+    }
+    report("range_index/build", count, start);
+    metric("range_index/build", "bytes/dish", static_cast<double>(index.memoryUsage()) / static_cast<double>(std::max<std::size_t>(count, 1)));
+
+    // Prices run from $3 to $50 and preparation times from 5 to 85 minutes: the selective mix keeps about 1% of the
+    // menu, the broad one about a quarter
+    struct Mix {
+        const char* name;
+        int max_price_dollars;
+        int max_prep_time;
+    };
+    const Mix mixes[] = {{"selective", 8, 12}, {"broad", 30, 50}};
+    for (const Mix& mix : mixes) {
+        const std::size_t queries = std::max<std::size_t>(10, 2000000 / std::max<std::size_t>(count, 1));
+        std::vector<RangeIndex::Query> bounds;
+        std::mt19937 rng(13);
+        for (std::size_t q = 0; q < queries; ++q) {
+            RangeIndex::Query query;
+            query.maxPrice(mix.max_price_dollars - 1 + static_cast<double>(rng() % 200) / 100.0).maxPrepTime(mix.max_prep_time - 2 + static_cast<int>(rng() % 5));
+            bounds.push_back(query);
+        }
+        const std::string scan_name = std::string("range_index/") + mix.name + "_scan";
+        const std::string index_name = std::string("range_index/") + mix.name + "_find";
+        std::size_t scanned = 0;
+        start = sample();
+        for (const RangeIndex::Query& query : bounds) {
+            std::vector<DishId> ids;
+            for (const Dish& dish : dishes) {
+                if (dish.getPriceCents() <= query.max_price_cents && dish.getPrepTime() <= query.max_prep_time) {
+                    ids.push_back(dish.getId());
+                }
+            }
+            scanned += ids.size();
+        }
+        const double scan_seconds = report(scan_name, queries, start).seconds;
+        std::size_t found = 0;
+        start = sample();
+        for (const RangeIndex::Query& query : bounds) {
+            found += index.find(query).size();
+        }
+        const double find_seconds = report(index_name, queries, start).seconds;
+        metric(index_name, "speedup", scan_seconds / find_seconds);
+        metric(index_name, "matches/query", static_cast<double>(found) / static_cast<double>(queries));
+        g_sink = g_sink + (found == scanned ? 1 : 0);
+    }
+
+    // Top 10 cheapest dishes ready in 20 minutes
+    const std::size_t top_queries = std::max<std::size_t>(10, 2000000 / std::max<std::size_t>(count, 1));
+    std::mt19937 rng(14);
+    std::vector<int> limits;
+    for (std::size_t q = 0; q < top_queries; ++q) {
+        limits.push_back(18 + static_cast<int>(rng() % 5));
+    }
+    std::size_t checksum = 0;
+    start = sample();
+    for (int limit : limits) {
+        std::vector<std::pair<std::int32_t, DishId>> heap;
+        for (const Dish& dish : dishes) {
+            if (dish.getPrepTime() <= limit && (heap.size() < 10 || dish.getPriceCents() < heap.front().first)) {
+                heap.emplace_back(dish.getPriceCents(), dish.getId());
+                std::push_heap(heap.begin(), heap.end());
+                if (heap.size() > 10) {
+                    std::pop_heap(heap.begin(), heap.end());
+                    heap.pop_back();
+                }
+            }
+        }
+        checksum += heap.size();
+    }
+    const double heap_seconds = report("range_index/top10_scan", top_queries, start).seconds;
+    start = sample();
+    for (int limit : limits) {
+        RangeIndex::Query query;
+        checksum += index.cheapest(10, query.maxPrepTime(limit)).size();
+    }
+    const double top_seconds = report("range_index/top10_cheapest", top_queries, start).seconds;
+    metric("range_index/top10_cheapest", "speedup", heap_seconds / top_seconds);
+
+    // Price changes reach the index through the observer
+    for (Dish& dish : dishes) {
+        dish.setObserver(&index);
+    }
+    const std::size_t updates = std::min<std::size_t>(count, 1000000);
+    start = sample();
+    for (std::size_t i = 0; i < updates; ++i) {
+        dishes[rng() % count].setPrice(static_cast<double>(300 + rng() % 4700) / 100.0);
+    }
+    report("range_index/update_price", updates, start);
+    g_sink = g_sink + checksum;
+}
+
+// Benchmark: logging price changes as deltas (unsynced, synced, and group-committed from several threads), the bytes
+// a delta takes against redistributing the whole menu, and a replica catching up batch by batch
+void benchChangeLog(std::size_t count) {
+    const std::string path = "/tmp/bench_change_log.bin";
+    const std::string snapshot_path = "/tmp/bench_change_log_snapshot.bin";
+    std::vector<MainCourse> mains = makeMainCourses(count);
+    MenuSnapshot::write(snapshot_path, Span<const Appetizer>(), mains, Span<const Dessert>());
+    std::uint64_t snapshot_bytes = 0;
+    if (std::FILE* file = std::fopen(snapshot_path.c_str(), "rb")) {
+        std::fseek(file, 0, SEEK_END);
+        snapshot_bytes = static_cast<std::uint64_t>(std::ftell(file));
+        std::fclose(file);
+    }
+    std::remove(snapshot_path.c_str());
+    Menu primary;
+    Menu replica;
+    for (const MainCourse& main : mains) {
+        primary.add(main);
+        replica.add(main);
+    }
+    mains = std::vector<MainCourse>();
+    std::remove(path.c_str());
+    std::mt19937 rng(19);
+    auto changePrice = [&](Menu& menu) {
+        menu.visit(rng() % menu.size(), [&](auto& dish) { dish.setPrice(static_cast<double>(1000 + rng() % 3000) / 100.0); });
+    };
+
+    // Unsynced: encoding and batched writes, one commit per 1000 changes
+    const std::size_t batch = 1000;
+    const std::size_t updates = std::max<std::size_t>(batch, std::min<std::size_t>(count, 1000000) / batch * batch);
+    {
+        ChangeLog log(path, ChangeLog::Options{ChangeLog::kDefaultOptions.batch_bytes, false});
+        primary.addObserver(&log);
+        Sample start = sample();
+        for (std::size_t i = 0; i < updates; ++i) {
+            changePrice(primary);
+            if ((i + 1) % batch == 0) {
+                log.commit();
+            }
+        }
+        report("change_log/record", updates, start);
+        const ChangeLog::Stats stats = log.stats();
+        metric("change_log/record", "bytes/delta", static_cast<double>(stats.bytes) / static_cast<double>(stats.deltas));
+        metric("change_log/record", "snapshot_bytes/batch_bytes",
+               static_cast<double>(snapshot_bytes) / (static_cast<double>(stats.bytes) / static_cast<double>(stats.commits)));
+        primary.removeObserver(&log);
+    }
+
+    // The replica replays the whole log, then follows it one committed batch at a time
+    ChangeLogReplayer replayer(path);
+    Sample start = sample();
+    const ChangeLogReplayer::Result replayed = replayer.catchUp(replica);
+    report("change_log/replay", replayed.deltas, start);
+    const std::size_t batches = 100;
+    double catch_up_seconds = 0.0;
+    {
+        ChangeLog log(path, ChangeLog::Options{ChangeLog::kDefaultOptions.batch_bytes, false});
+        primary.addObserver(&log);
+        for (std::size_t b = 0; b < batches; ++b) {
+            for (std::size_t i = 0; i < batch; ++i) {
+                changePrice(primary);
+            }
+            log.commit();
+            start = sample();
+            g_sink = g_sink + replayer.catchUp(replica).deltas;
+            catch_up_seconds += secondsSince(start.start);
+        }
+        primary.removeObserver(&log);
+    }
+    metric("change_log/catch_up_batch", "us/batch", catch_up_seconds * 1e6 / static_cast<double>(batches));
+
+    // Synced: every commit waits for fdatasync; writers on several threads share the syncs
+    std::remove(path.c_str());
+    const std::size_t threads = 4;
+    const std::size_t commits_per_thread = 500;
+    std::vector<Dish> dishes = makeDishes(threads);
+    {
+        ChangeLog log(path);
+        for (std::size_t t = 0; t < threads; ++t) {
+            dishes[t].setId(static_cast<DishId>(t));
+            dishes[t].setObserver(&log);
+        }
+        start = sample();
+        for (std::size_t i = 0; i < commits_per_thread; ++i) {
+            dishes[0].setPrepTime(static_cast<int>(i % 90));
+            log.commit();
+        }
+        report("change_log/commit_sync", commits_per_thread, start);
+        const std::uint64_t commits_before = log.stats().commits;
+        start = sample();
+        std::vector<std::thread> writers;
+        for (std::size_t t = 0; t < threads; ++t) {
+            writers.emplace_back([&, t]() {
+                for (std::size_t i = 0; i < commits_per_thread; ++i) {
+                    dishes[t].setPrepTime(static_cast<int>(i % 90));
+                    log.commit();
+                }
+            });
+        }
+        for (std::thread& writer : writers) {
+            writer.join();
+        }
+        report("change_log/group_commit", threads * commits_per_thread, start);
+        metric("change_log/group_commit", "deltas/sync",
+               static_cast<double>(threads * commits_per_thread) / static_cast<double>(log.stats().commits - commits_before));
+    }
+    std::remove(path.c_str());
+}
+
+// Benchmark: the instrumented hot paths (copies, the copying accessors, rendering, range queries). Run it on the
+// default build and on `make clean && make INSTRUMENTATION=1 bench` to see what the counters cost; the default
+// build's figures match those from before the hooks were added
+void benchInstrumentation(std::size_t count) {
+    metric("instrumentation/enabled", "flag", Instrumentation::kEnabled ? 1.0 : 0.0);
+    Instrumentation::reset();
+    const std::vector<MainCourse> mains = makeMainCourses(count);
+    Sample start = sample();
+    std::vector<MainCourse> copies(mains);
+    report("instrumentation/copy", count, start);
+
+    std::size_t checksum = 0;
+    start = sample();
+    for (const MainCourse& main : mains) {
+        checksum += main.getIngredients().size() + main.getSideDishes().size();
+    }
+    report("instrumentation/accessor_copies", count, start);
+
+    const MenuRenderer renderer;
+    std::string out;
+    start = sample();
+    for (const MainCourse& main : mains) {
+        out.clear();
+        renderer.render(main, out);
+        checksum += out.size();
+    }
+    report("instrumentation/render", count, start);
+
+    RangeIndex index;
+    for (std::size_t i = 0; i < copies.size(); ++i) {
+        copies[i].setId(static_cast<DishId>(i));
+        index.add(copies[i]);
+    }
+    const std::size_t queries = 200000;
+    std::mt19937 rng(23);
+    start = sample();
+    for (std::size_t q = 0; q < queries; ++q) {
+        RangeIndex::Query query;
+        checksum += index.cheapest(10, query.maxPrepTime(15 + static_cast<int>(rng() % 30))).size();
+    }
+    report("instrumentation/range_query", queries, start);
+    if constexpr (Instrumentation::kEnabled) {
+        std::cout << Instrumentation::snapshot().toText();
+    }
+    g_sink = g_sink + checksum;
+}
+
+struct Benchmark {
+    const char* name;
+    void (*run)(std::size_t count);
+};
+
+const Benchmark benchmarks[] = {
+    {"construct", benchConstruction},
+    {"filter", benchDishStoreFilter},
+    {"ingredients", benchIngredientMemory},
+    {"ingredient_index", benchIngredientIndex},
+    {"accessors", benchAccessorAllocations},
+    {"render", benchRendering},
+    {"snapshot", benchSnapshotStartup},
+    {"import", benchImport},
+    {"arena", benchArena},
+    {"menu", benchMenu},
+    {"dietary", benchDietaryIndex},
+    {"kitchen", benchKitchenScheduler},
+    {"orders", benchOrderPipeline},
+    {"concurrent_menu", benchConcurrentMenu},
+    {"analytics", benchAnalytics},
+    {"menu_stats", benchMenuStats},
+    {"layout", benchPackedLayout},
+    {"names", benchNameIndex},
+    {"dish_pool", benchDishPool},
+    {"range_index", benchRangeIndex},
+    {"change_log", benchChangeLog},
+    {"instrumentation", benchInstrumentation},
+    {"enum_names", benchEnumNames},
+    {"name_validator", benchNameValidator},
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string filter;
+    std::vector<std::size_t> counts;
+    std::string json_path;
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--json" && i + 1 < argc) {
+            json_path = argv[++i];
+        } else {
+            positional.push_back(argv[i]);
+        }
+    }
+    if (!positional.empty()) {
+        filter = positional[0];
+    }
+    if (positional.size() > 1) {
+        std::string list = positional[1];
+        for (std::size_t begin = 0; begin <= list.size();) {
+            const std::size_t end = std::min(list.find(',', begin), list.size());
+            const std::size_t count = parseCount(list.substr(begin, end - begin));
+            if (count == 0) {
+                std::cerr << "bench: invalid dish count '" << list.substr(begin, end - begin) << "'" << std::endl;
+                return 1;
+            }
+            counts.push_back(count);
+            begin = end + 1;
+        }
+    } else {
+        counts.push_back(1000000);
+    }
+
+    for (std::size_t count : counts) {
+        g_dishes = count;
+        for (const Benchmark& benchmark : benchmarks) {
+            if (std::string(benchmark.name).find(filter) != std::string::npos) {
+                benchmark.run(count);
+            }
+        }
+    }
+
+    if (!json_path.empty()) {
+        std::ofstream json(json_path);
+        writeJson(json);
+        if (!json) {
+            std::cerr << "bench: cannot write " << json_path << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
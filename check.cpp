@@ -0,0 +1,1764 @@
+/**
+ * @file check.cpp
+ * @brief This file contains the self-checking tests for the menu data structures built around the Dish classes.
+ *
+ * Each check prints its name and either "ok" or the failed condition; the program exits non-zero if any check
+ * failed. Run with `make check`.
+ *
+ * @date 10/17/2026
+ * @author Mitchell Lipyansky
+ */
+
+#include "ChangeLog.hpp"
+#include "ConcurrentMenu.hpp"
+#include "DietaryIndex.hpp"
+#include "Dish.hpp"
+#include "DishPool.hpp"
+#include "DishStore.hpp"
+#include "IngredientIndex.hpp"
+#include "Instrumentation.hpp"
+#include "KitchenScheduler.hpp"
+#include "Menu.hpp"
+#include "MenuAnalytics.hpp"
+#include "MenuArena.hpp"
+#include "MenuImporter.hpp"
+#include "MenuRenderer.hpp"
+#include "MenuSnapshot.hpp"
+#include "MenuStats.hpp"
+#include "NameIndex.hpp"
+#include "NameValidator.hpp"
+#include "OrderPipeline.hpp"
+#include "QuantileSketch.hpp"
+#include "RangeIndex.hpp"
+#include "SmallArray.hpp"
+#include "SmallString.hpp"
+#include "SmallVector.hpp"
+#include "StableHash.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <stdexcept>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <locale.h>  // For newlocale, uselocale
+#include <sys/resource.h>  // For setrlimit
+#include <unistd.h>  // For truncate
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                                      \
+    do {                                                                                      \
+        if (!(condition)) {                                                                   \
+            std::cout << "  FAILED: " #condition " (" << __FILE__ << ":" << __LINE__ << ")" << std::endl; \
+            ++g_failures;                                                                     \
+        }                                                                                     \
+    } while (0)
+
+// Test: DishStore::select agrees with a per-dish loop, on partial and whole blocks, with both packing implementations
+void checkDishStore() {
+    std::mt19937 rng(11);
+    const std::size_t sizes[] = {0, 1, 63, 64, 65, 127, 128, 200};
+    for (std::size_t size : sizes) {
+        std::vector<Dish> dishes;
+        for (std::size_t i = 0; i < size; ++i) {
+            // Prices on a coarse grid, so some fall exactly on the bounds
+            dishes.emplace_back("Soup", std::vector<std::string>{}, static_cast<int>(rng() % 60), static_cast<double>(rng() % 20),
+                                static_cast<Dish::CuisineType>(rng() % 7));
+        }
+        DishStore store;
+        store.append(dishes.begin(), dishes.end());
+        CHECK(store.size() == size);
+
+        for (int round = 0; round < 40; ++round) {
+            DishStore::Filter filter;
+            if (round % 2 == 1) {
+                filter.min_price = static_cast<double>(rng() % 10);
+                filter.max_price = filter.min_price + static_cast<double>(rng() % 10);
+            }
+            if (round % 4 >= 2) {
+                filter.min_prep_time = static_cast<int>(rng() % 30);
+                filter.max_prep_time = filter.min_prep_time + static_cast<int>(rng() % 30);
+            }
+            if (round % 8 >= 4) {
+                filter.cuisine_mask = static_cast<std::uint32_t>(rng() % 128);  // a subset, including none
+            }
+
+            Bitmap expected(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                const Dish& dish = dishes[i];
+                if (dish.getPrice() >= filter.min_price && dish.getPrice() < filter.max_price && dish.getPrepTime() >= filter.min_prep_time &&
+                    dish.getPrepTime() <= filter.max_prep_time && (filter.cuisine_mask & DishStore::cuisineBit(dish.getCuisine())) != 0) {
+                    expected.set(i);
+                }
+            }
+            for (DishStore::Pack pack : {DishStore::Pack::SCALAR, DishStore::Pack::SSE2}) {
+                const Bitmap actual = store.select(filter, pack);
+                CHECK(actual.size() == size);
+                CHECK(actual.toIndices() == expected.toIndices());
+                // No bit past the last row is set
+                CHECK(size % 64 == 0 || (actual.words()[actual.wordCount() - 1] >> (size % 64)) == 0);
+            }
+            CHECK(store.select(filter).toIndices() == expected.toIndices());
+        }
+    }
+
+    // The price bound is half-open
+    DishStore store;
+    store.append(Dish("Tea", {}, 5, 4.0));
+    store.append(Dish("Cake", {}, 5, 5.0));
+    CHECK((store.selectPriceBelow(5.0).toIndices() == std::vector<std::size_t>{0}));
+    DishStore::Filter exact;
+    exact.min_price = 5.0;
+    exact.max_price = 5.0;
+    CHECK(store.select(exact).count() == 0);
+}
+
+// Test: IngredientIndex queries and incremental maintenance through setIngredients
+void checkIngredientIndex() {
+    std::vector<Dish> dishes;
+    dishes.emplace_back("Garlic Bread", std::vector<std::string>{"Bread", "Garlic", "Butter"});
+    dishes.emplace_back("Pad Thai", std::vector<std::string>{"Noodles", "Peanuts", "Garlic"});
+    dishes.emplace_back("Caesar Salad", std::vector<std::string>{"Lettuce", "Garlic", "Parmesan"});
+    dishes.emplace_back("Fruit Cup", std::vector<std::string>{"Melon", "Grapes"});
+
+    IngredientIndex index;
+    for (std::size_t i = 0; i < dishes.size(); ++i) {
+        dishes[i].setId(static_cast<DishId>(i));
+        dishes[i].setObserver(&index);
+        index.add(dishes[i]);
+    }
+
+    IngredientIndex::Query garlic_no_peanuts;
+    garlic_no_peanuts.require("Garlic").exclude("Peanuts");
+    CHECK((index.find(garlic_no_peanuts) == std::vector<DishId>{0, 2}));
+
+    IngredientIndex::Query melon_or_butter;
+    melon_or_butter.either("Melon").either("Butter");
+    CHECK((index.find(melon_or_butter) == std::vector<DishId>{0, 3}));
+
+    IngredientIndex::Query no_garlic;
+    no_garlic.exclude("Garlic");
+    CHECK((index.find(no_garlic) == std::vector<DishId>{3}));
+
+    IngredientIndex::Query unknown;
+    unknown.require("Saffron");
+    CHECK(index.find(unknown).empty());
+
+    dishes[3].setIngredients({"Melon", "Garlic"});
+    dishes[0].setIngredients({"Bread", "Butter"});
+    CHECK((index.dishesWith("Garlic") == std::vector<DishId>{1, 2, 3}));
+    CHECK(index.dishesWith("Grapes").empty());
+
+    // A move hands the registration over: changes to the moved-from dish no longer reach the index
+    Dish moved(std::move(dishes[1]));
+    CHECK(moved.getObserver() == &index && dishes[1].getObserver() == nullptr);
+    dishes[1].setIngredients({"Saffron"});
+    CHECK(index.dishesWith("Saffron").empty() && (index.dishesWith("Noodles") == std::vector<DishId>{1}));
+    const Dish relocated(std::move(moved), Dish::allocator_type());
+    CHECK(relocated.getObserver() == &index && moved.getObserver() == nullptr);
+
+    // Many out-of-order updates force the pending buffers to be folded into the compressed lists
+    std::vector<Dish> many(500, Dish("Soup", {"Water"}));
+    IngredientIndex big;
+    for (std::size_t i = many.size(); i-- > 0;) {
+        many[i].setId(static_cast<DishId>(i));
+        many[i].setObserver(&big);
+        big.add(many[i]);
+    }
+    for (std::size_t i = 0; i < many.size(); i += 3) {
+        many[i].setIngredients({"Water", "Salt"});
+    }
+    big.compact();
+    CHECK(big.dishesWith("Water").size() == 500);
+    CHECK(big.dishesWith("Salt").size() == 167);
+    CHECK(big.dishesWith("Salt").back() == 498);
+}
+
+// Test: MenuRenderer text matches display(), and the CSV / JSON Lines records of each subclass
+void checkMenuRenderer() {
+    MainCourse chicken("Grilled Chicken", {"Chicken", "Olive Oil"}, 30, 18.99, Dish::CuisineType::AMERICAN,
+                       MainCourse::GRILLED, "Chicken", {{"Mashed Potatoes", MainCourse::STARCHES}}, true);
+    std::string text;
+    MenuRenderer().render(static_cast<const Dish&>(chicken), text);
+    CHECK(text == "Dish Name: Grilled Chicken\nIngredients: Chicken, Olive Oil\nPreparation Time: 30 minutes\n"
+                  "Price: $18.99\nCuisine Type: AMERICAN\n");
+
+    std::streambuf* saved = std::cout.rdbuf();
+    std::ostringstream captured;
+    std::cout.rdbuf(captured.rdbuf());
+    chicken.display();
+    std::cout.rdbuf(saved);
+    CHECK(captured.str() == text);
+    CHECK((std::cout.flags() & std::ios::floatfield) == 0);
+
+    text.clear();
+    MenuRenderer().render(chicken, text);
+    CHECK(text.find("Side Dishes: Mashed Potatoes (Starches)\nGluten-Free: True\n") != std::string::npos);
+
+    const Dessert cake("Chocolate Cake", {"Flour, Sugar"}, 45, 7.99, Dish::CuisineType::FRENCH, Dessert::SWEET, 9, false);
+    std::string csv;
+    MenuRenderer(MenuRenderer::Format::CSV).render(cake, csv);
+    CHECK(csv == "Dessert,Chocolate Cake,\"Flour, Sugar\",45,7.99,FRENCH,,,,,,,,SWEET,9,false\n");
+
+    const Appetizer wings("Wings", {"Chicken"}, 20, 9.5, Dish::CuisineType::AMERICAN, Appetizer::BUFFET, 8, false);
+    std::string json;
+    MenuRenderer(MenuRenderer::Format::JSON_LINES).render(wings, json);
+    CHECK(json == "{\"kind\":\"Appetizer\",\"name\":\"Wings\",\"ingredients\":[\"Chicken\"],\"prep_time\":20,"
+                  "\"price\":9.50,\"cuisine_type\":\"AMERICAN\",\"serving_style\":\"BUFFET\",\"spiciness_level\":8,"
+                  "\"vegetarian\":false}\n");
+
+    const std::vector<Dessert> desserts(3, cake);
+    std::ostringstream sink;
+    const std::size_t written = MenuRenderer(MenuRenderer::Format::CSV).renderMenu(desserts.begin(), desserts.end(), sink);
+    CHECK(written == sink.str().size());
+    CHECK(sink.str().size() == MenuRenderer::csvHeader().size() + 3 * csv.size());
+}
+
+// Test: a snapshot written to disk maps back with identical values in every field
+void checkMenuSnapshot() {
+    const std::vector<Appetizer> appetizers = {
+        Appetizer("Spring Rolls", {"Cabbage", "Carrot"}, 15, 6.5, Dish::CuisineType::CHINESE, Appetizer::FAMILY_STYLE, 3, true),
+        Appetizer()};
+    const std::vector<MainCourse> mains = {
+        MainCourse("Grilled Chicken", {"Chicken", "Olive Oil", "Garlic"}, 30, 18.99, Dish::CuisineType::AMERICAN,
+                   MainCourse::GRILLED, "Chicken", {{"Mashed Potatoes", MainCourse::STARCHES}, {"Green Beans", MainCourse::VEGETABLE}}, true)};
+    const std::vector<Dessert> desserts = {
+        Dessert("Chocolate Cake", {"Flour, Sugar, Cocoa Powder, Eggs"}, 45, 7.99, Dish::CuisineType::FRENCH, Dessert::SWEET, 9, false),
+        Dessert("Baklava", {"Walnuts", "Honey", "Garlic"}, 60, 5.25, Dish::CuisineType::OTHER, Dessert::SWEET, 8, true)};
+
+    const std::string path = "check_snapshot.bin";
+    MenuSnapshot::write(path, appetizers, mains, desserts);
+    {
+        const MenuSnapshot snapshot = MenuSnapshot::open(path, true);
+        CHECK(snapshot.appetizerCount() == 2 && snapshot.mainCourseCount() == 1 && snapshot.dessertCount() == 2);
+
+        const MenuSnapshot::AppetizerView rolls = snapshot.appetizer(0);
+        CHECK(rolls.getName() == "Spring Rolls");
+        CHECK(rolls.getIngredientCount() == 2 && rolls.getIngredient(1) == "Carrot");
+        CHECK(rolls.getServingStyle() == Appetizer::FAMILY_STYLE && rolls.getSpicinessLevel() == 3 && rolls.isVegetarian());
+        CHECK(snapshot.appetizer(1).getName() == "UNKNOWN");
+
+        const MenuSnapshot::MainCourseView chicken = snapshot.mainCourse(0);
+        CHECK(chicken.getPrice() == 18.99 && chicken.getPrepTime() == 30);
+        CHECK(chicken.getCuisine() == Dish::CuisineType::AMERICAN && chicken.getCookingMethod() == MainCourse::GRILLED);
+        CHECK(chicken.getProteinType() == "Chicken" && chicken.isGlutenFree());
+        CHECK(chicken.getSideDishCount() == 2 && chicken.getSideDishName(1) == "Green Beans");
+        CHECK(chicken.getSideDishCategory(0) == MainCourse::STARCHES);
+
+        // Materialized objects render exactly like the originals
+        std::string original;
+        std::string restored;
+        MenuRenderer renderer(MenuRenderer::Format::JSON_LINES);
+        renderer.render(mains[0], original);
+        renderer.render(chicken.materialize(), restored);
+        for (std::size_t i = 0; i < desserts.size(); ++i) {
+            renderer.render(desserts[i], original);
+            renderer.render(snapshot.dessert(i).materialize(), restored);
+        }
+        CHECK(original == restored);
+    }
+
+    // A truncated file is rejected instead of being read out of bounds
+    std::FILE* file = std::fopen(path.c_str(), "r+b");
+    std::fseek(file, 0, SEEK_END);
+    const long size = std::ftell(file);
+    std::fclose(file);
+    CHECK(truncate(path.c_str(), size - 8) == 0);
+    bool rejected = false;
+    try {
+        MenuSnapshot::open(path);
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    CHECK(rejected);
+    std::remove(path.c_str());
+}
+
+// Test: CSV and JSON Lines written by MenuRenderer import back to identical dishes; bad rows are reported by line
+void checkMenuImporter() {
+    const std::vector<Appetizer> appetizers = {
+        Appetizer("Spring Rolls", {"Cabbage", "Carrot"}, 15, 6.5, Dish::CuisineType::CHINESE, Appetizer::FAMILY_STYLE, 3, true)};
+    const std::vector<MainCourse> mains = {
+        MainCourse("Grilled Chicken", {"Chicken", "Olive Oil"}, 30, 18.99, Dish::CuisineType::AMERICAN, MainCourse::GRILLED,
+                   "Chicken \"Thigh\"", {{"Mashed Potatoes", MainCourse::STARCHES}, {"Green Beans", MainCourse::VEGETABLE}}, true)};
+    const std::vector<Dessert> desserts = {
+        Dessert("Chocolate Cake", {"Flour, Sugar"}, 45, 7.99, Dish::CuisineType::FRENCH, Dessert::SWEET, 9, false)};
+
+    for (MenuRenderer::Format format : {MenuRenderer::Format::CSV, MenuRenderer::Format::JSON_LINES}) {
+        const MenuRenderer renderer(format);
+        std::string original = format == MenuRenderer::Format::CSV ? std::string(MenuRenderer::csvHeader()) : std::string();
+        for (int copy = 0; copy < 50; ++copy) {
+            renderer.render(appetizers[0], original);
+            renderer.render(mains[0], original);
+            renderer.render(desserts[0], original);
+        }
+
+        // Small chunks so that the rows are spread over many parser tasks
+        const MenuImporter importer(format, 2, 256);
+        std::istringstream stream(original);
+        for (const MenuImporter::Result& result : {importer.importBuffer(original), importer.importStream(stream)}) {
+            CHECK(result.errors.empty() && result.rows == 150 && result.bytes == original.size());
+            CHECK(result.appetizers.size() == 50 && result.main_courses.size() == 50 && result.desserts.size() == 50);
+            std::string restored = format == MenuRenderer::Format::CSV ? std::string(MenuRenderer::csvHeader()) : std::string();
+            for (int copy = 0; copy < 50; ++copy) {
+                renderer.render(result.appetizers[copy], restored);
+                renderer.render(result.main_courses[copy], restored);
+                renderer.render(result.desserts[copy], restored);
+            }
+            CHECK(original == restored);
+        }
+    }
+
+    // Bad rows are skipped and reported with their line numbers
+    const std::string csv = std::string(MenuRenderer::csvHeader())
+        + "Dish,Soup,Water,10,3.5,OTHER,,,,,,,,,,\n"
+        + "Dish,Soup 2,Water,10,3.5,OTHER,,,,,,,,,,\n"
+        + "Dish,Stew,Water,ten,3.5,OTHER,,,,,,,,,,\n"
+        + "\n"
+        + "Appetizer,Wings,Chicken,20,9,AMERICAN,PLATED,4,maybe,,,,,,,\n"
+        + "Dish,Salad,Lettuce,5,4.25,ITALIAN\n"
+        + "Pizza,Margherita,Cheese,5,4.25,ITALIAN,,,,,,,,,,\n"
+        + "Dish,Bread,Flour,5,2,FRENCH,,,,,,,,,,";
+    const MenuImporter::Result result = MenuImporter(MenuRenderer::Format::CSV, 2, 32).importBuffer(csv);
+    CHECK(result.rows == 7 && result.dishes.size() == 2);
+    CHECK(result.dishes[0].getName() == "Soup" && result.dishes[1].getName() == "Bread");
+    CHECK(result.dishes[1].getIngredient(0) == "Flour" && result.dishes[1].getPrice() == 2.0);
+    std::vector<std::size_t> lines;
+    for (const MenuImporter::RowError& error : result.errors) {
+        lines.push_back(error.line);
+    }
+    CHECK((lines == std::vector<std::size_t>{3, 4, 6, 7, 8}));
+
+    // A stream that fails part way through (badbit) is an error, not the end of the input
+    struct FailingBuffer : std::streambuf {
+        explicit FailingBuffer(std::string& data) { setg(&data[0], &data[0], &data[0] + data.size()); }
+        int_type underflow() override { throw std::runtime_error("read error"); }
+    };
+    std::string readable = csv.substr(0, 100);
+    FailingBuffer failing(readable);
+    std::istream broken(&failing);
+    bool stream_error = false;
+    try {
+        MenuImporter(MenuRenderer::Format::CSV, 2, 32).importStream(broken);
+    } catch (const std::runtime_error&) {
+        stream_error = true;
+    }
+    CHECK(stream_error && broken.bad());
+
+    const MenuImporter::Result json = MenuImporter(MenuRenderer::Format::JSON_LINES).importBuffer(
+        "{\"kind\":\"Dish\",\"name\":\"Caf\\u00e9 Soup\",\"prep_time\":1,\"price\":2,\"cuisine_type\":\"OTHER\"}\n"
+        "{\"kind\":\"Dish\",\"name\":\"Tea\",\"prep_time\":1,\"cuisine_type\":\"OTHER\"}\n"
+        "{\"kind\":\"Dish\",\"name\":\"Jam\",\"ingredients\":[\"Fruit\", \"Sugar\"],\"prep_time\":1,\"price\":2,"
+        "\"cuisine_type\":\"OTHER\",\"rating\":5}\n");
+    CHECK(json.dishes.size() == 1 && json.dishes[0].getIngredientCount() == 2);
+    CHECK(json.errors.size() == 2 && json.errors[0].line == 1 && json.errors[1].line == 2);
+    CHECK(json.errors[1].message == "missing field 'price'");
+
+    // List separators and backslashes inside ingredients and side dish names survive a CSV round trip
+    const MainCourse tricky("Glazed Ham", {"Salt; Pepper", "Honey:Mustard", "C:\\Pantry\\"}, 30, 18.0, Dish::CuisineType::AMERICAN,
+                            MainCourse::BAKED, "Pork", {{"Rice: Wild; Brown", MainCourse::STARCHES}, {"Peas\\", MainCourse::VEGETABLE}}, false);
+    std::string tricky_csv;
+    MenuRenderer(MenuRenderer::Format::CSV).render(tricky, tricky_csv);
+    const MenuImporter::Result tricky_result = MenuImporter(MenuRenderer::Format::CSV).importBuffer(tricky_csv);
+    CHECK(tricky_result.errors.empty() && tricky_result.main_courses.size() == 1);
+    CHECK(tricky_result.main_courses.size() == 1 && tricky_result.main_courses[0] == tricky);
+
+    // Empty strings are values, not missing fields, in both formats
+    const MainCourse unnamed("", {}, 10, 9.5, Dish::CuisineType::OTHER, MainCourse::RAW, "", {{"", MainCourse::SALAD}}, true);
+    for (MenuRenderer::Format format : {MenuRenderer::Format::CSV, MenuRenderer::Format::JSON_LINES}) {
+        std::string text;
+        MenuRenderer(format).render(unnamed, text);
+        MenuRenderer(format).render(Dish("", {}, 1, 2.0), text);
+        const MenuImporter::Result empty = MenuImporter(format).importBuffer(text);
+        CHECK(empty.errors.empty() && empty.main_courses.size() == 1 && empty.dishes.size() == 1);
+        CHECK(empty.main_courses.size() == 1 && empty.main_courses[0] == unnamed);
+        CHECK(empty.dishes.size() == 1 && empty.dishes[0].getName().empty());
+    }
+}
+
+// Test: dishes in an arena-backed container allocate from the arena, and copies out of it do not
+void checkMenuArena() {
+    MenuArena arena(256);
+    {
+        std::pmr::vector<MainCourse> mains(arena.allocator());
+        mains.emplace_back("Grilled Chicken", std::vector<std::string>{"Chicken", "Olive Oil"}, 30, 18.99, Dish::CuisineType::AMERICAN,
+                           MainCourse::GRILLED, "Free Range Chicken Breast",
+                           std::vector<MainCourse::SideDish>{{"Garlic Mashed Potatoes", MainCourse::STARCHES}}, true);
+        mains.emplace_back(mains[0]);  // growing the vector moves the first dish into the arena again
+        CHECK(mains[0].get_allocator().resource() == &arena && mains[1].get_allocator().resource() == &arena);
+        CHECK(mains[1].getSideDishesView()[0].name.get_allocator().resource() == &arena);
+        CHECK(arena.bytesAllocated() > 0 && arena.bytesReserved() >= arena.bytesAllocated());
+
+        mains[1].setName("Roast Chicken");
+        mains[1].addSideDish({"Seasonal Greens With Lemon", MainCourse::VEGETABLE});
+        CHECK(mains[1].getName() == "Roast Chicken" && mains[1].getSideDishesView().size() == 2);
+        CHECK(mains[0].getProteinType() == "Free Range Chicken Breast" && mains[0].getIngredient(1) == "Olive Oil");
+
+        const MainCourse copy = mains[1];
+        CHECK(copy.get_allocator().resource() == std::pmr::get_default_resource());
+        CHECK(copy.getName() == "Roast Chicken" && copy.getSideDishes()[1].name == "Seasonal Greens With Lemon");
+
+        Dessert dessert(arena.allocator());
+        dessert = Dessert("Baklava", {"Walnuts", "Honey"}, 60, 5.25, Dish::CuisineType::OTHER, Dessert::SWEET, 8, true);
+        CHECK(dessert.get_allocator().resource() == &arena && dessert.getName() == "Baklava");
+    }
+    arena.release();
+    CHECK(arena.bytesAllocated() == 0);
+}
+
+// Test: SmallVector, SmallString and SmallArray stay inline up to their capacity, spill to their allocator beyond it,
+// and keep the allocator rules of the std::pmr containers
+void checkSmallVector() {
+    MenuArena arena(256);
+    SmallVector<std::uint32_t, 4> ids(arena.allocator());
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        ids.push_back(i);
+    }
+    CHECK(ids.isInline() && arena.bytesAllocated() == 0);
+    ids.push_back(ids[0]);  // grows while the argument refers to an element
+    CHECK(!ids.isInline() && ids.size() == 5 && ids.back() == 0 && ids[3] == 3 && arena.bytesAllocated() > 0);
+    const SmallVector<std::uint32_t, 4> copy = ids;
+    CHECK(copy == ids && copy.get_allocator().resource() == std::pmr::get_default_resource());
+    SmallVector<std::uint32_t, 4> moved(std::move(ids));
+    CHECK(moved == copy && ids.empty() && ids.isInline() && moved.get_allocator().resource() == &arena);
+
+    SmallString text("Roasted Seasonal Vegetables", arena.allocator());
+    CHECK(text.isInline() && text == "Roasted Seasonal Vegetables" && std::string(text.c_str()) == "Roasted Seasonal Vegetables");
+    text = std::string_view(text).substr(8);  // assign from a view of itself
+    CHECK(text == "Seasonal Vegetables" && text.size() == 19);
+    text = "A Side Dish Name Longer Than Thirty One Characters";
+    CHECK(!text.isInline() && text.size() == 50 && std::string_view(text).back() == 's');
+    std::ostringstream out;
+    out << text;
+    CHECK(out.str() == "A Side Dish Name Longer Than Thirty One Characters");
+
+    // SmallArray: the same inline buffer, with the allocator passed in by the owner
+    const std::uint32_t values[] = {1, 2, 3, 4, 5};
+    SmallArray<std::uint32_t, 4> list;
+    list.assign(values, values + 4, arena.allocator());
+    const std::size_t inline_bytes = arena.bytesAllocated();
+    CHECK(list.isInline() && list.size() == 4 && list[3] == 4);
+    list.assign(values, values + 5, arena.allocator());
+    CHECK(!list.isInline() && list.size() == 5 && list[4] == 5 && arena.bytesAllocated() > inline_bytes);
+    SmallArray<std::uint32_t, 4> taken;
+    taken.steal(list);
+    CHECK(taken.size() == 5 && taken[0] == 1 && list.empty() && list.isInline());
+    taken.release(arena.allocator());
+    CHECK(taken.empty() && taken.isInline());
+
+    // Source compatible with a std::string member
+    const MainCourse::SideDish side("Mashed Potatoes", MainCourse::STARCHES);
+    std::string name = side.name;
+    name += side.name.substr(side.name.find(' '));
+    CHECK(name == "Mashed Potatoes Potatoes" && std::string(side.name) == side.name.c_str() && side.name.compare("Mashed") > 0);
+    CHECK(side.name.front() == 'M' && side.name.back() == 's' && side.name.rfind('o') == 12 && side.name.find("Tofu") == SmallString::npos);
+
+    // Dishes: short ingredient lists and names need no allocation, longer lists spill and still read back in order;
+    // the side dishes are one allocation
+    std::pmr::vector<MainCourse> mains(arena.allocator());
+    mains.reserve(2);
+    const std::size_t before = arena.bytesAllocated();
+    std::vector<MainCourse::SideDish> sides = {{"Rice", MainCourse::GRAIN}, {"Slaw", MainCourse::SALAD}};
+    mains.emplace_back("Brisket", std::vector<std::string>{"Beef", "Salt", "Pepper"}, 300, 24.0, Dish::CuisineType::AMERICAN,
+                       MainCourse::BAKED, "Beef Brisket", sides, true);
+    CHECK(arena.bytesAllocated() == before + 2 * sizeof(MainCourse::SideDish));
+    sides.push_back({"Beans", MainCourse::LEGUME});
+    sides.push_back({"Cornbread", MainCourse::BREAD});
+    std::vector<std::string> ingredients(Dish::kInlineIngredients + 1, "Salt");
+    ingredients.back() = "Smoke";
+    mains.emplace_back("Ribs", ingredients, 240, 28.0, Dish::CuisineType::AMERICAN, MainCourse::GRILLED, "Pork", sides, true);
+    CHECK(arena.bytesAllocated() > before);
+    CHECK(mains[1].getIngredientCount() == Dish::kInlineIngredients + 1 && mains[1].getIngredient(Dish::kInlineIngredients) == "Smoke");
+    CHECK(mains[1].getSideDishesView().size() == 4 && mains[1].getSideDishesView()[3].name == "Cornbread");
+}
+
+// Test: a mixed menu keeps its order, hands out positions as IDs and forwards changes to its observers
+void checkMenu() {
+    Menu menu;
+    menu.add(Appetizer("Spring Rolls", {"Cabbage", "Carrot"}, 15, 6.5, Dish::CuisineType::CHINESE, Appetizer::FAMILY_STYLE, 3, true));
+    menu.add(MenuItem(Dessert("Baklava", {"Walnuts", "Honey"}, 60, 5.25, Dish::CuisineType::OTHER, Dessert::SWEET, 8, true)));
+    menu.emplace<MainCourse>("Grilled Chicken", std::vector<std::string>{"Chicken", "Garlic"}, 30, 18.99, Dish::CuisineType::AMERICAN,
+                             MainCourse::GRILLED, "Chicken", std::vector<MainCourse::SideDish>{}, true);
+    menu.add(Appetizer("Garlic Bread", {"Bread", "Garlic"}, 10, 4.0, Dish::CuisineType::ITALIAN, Appetizer::PLATED, 0, true));
+
+    CHECK(menu.size() == 4 && menu.count(Menu::Kind::APPETIZER) == 2 && menu.mainCourses().size() == 1);
+    CHECK(menu.kindAt(1) == Menu::Kind::DESSERT && menu[2].getName() == "Grilled Chicken" && menu[3].getId() == 3);
+    CHECK(menu.appetizers()[1].getName() == "Garlic Bread" && std::get<Dessert>(menu.item(1)).containsNuts());
+    static_assert(std::is_same_v<decltype(menu.appetizers()), Span<const Appetizer>>, "dishes are only changed through visit()");
+
+    // Subclass fields through visitation: vegetarian appetizers, nut-free desserts and gluten-free main courses
+    struct Safe {
+        bool operator()(const Appetizer& appetizer) const { return appetizer.isVegetarian(); }
+        bool operator()(const MainCourse& main_course) const { return main_course.isGlutenFree(); }
+        bool operator()(const Dessert& dessert) const { return !dessert.containsNuts(); }
+    };
+    CHECK((menu.filter(Safe()) == std::vector<std::size_t>{0, 2, 3}));
+    const int prep_time = menu.accumulate(0, [](int total, const Dish& dish) { return total + dish.getPrepTime(); });
+    CHECK(prep_time == 115);
+
+    std::string text;
+    menu.render(MenuRenderer(), text);
+    std::string expected;
+    MenuRenderer().render(menu.appetizers()[0], expected);
+    MenuRenderer().render(menu.desserts()[0], expected);
+    CHECK(text.compare(0, expected.size(), expected) == 0);
+
+    // Changes made through the menu reach an index registered as its observer
+    IngredientIndex index;
+    menu.addObserver(&index);
+    menu.forEach([&](const Dish& dish) { index.add(dish); });
+    CHECK((index.dishesWith("Garlic") == std::vector<DishId>{2, 3}));
+    menu.visit(3, [](Dish& dish) { dish.setIngredients({"Bread", "Butter"}); });
+    CHECK((index.dishesWith("Garlic") == std::vector<DishId>{2}));
+
+    // Clearing the menu clears its indexes, so dishes added afterwards are indexed under the reused IDs
+    DietaryIndex dietary;
+    NameIndex names;
+    RangeIndex ranges;
+    for (DishObserver* observer : std::initializer_list<DishObserver*>{&dietary, &names, &ranges}) {
+        menu.addObserver(observer);
+    }
+    menu.forEach([&](const Dish& dish) {
+        dietary.add(dish);
+        names.add(dish);
+        ranges.add(dish);
+    });
+    CHECK(dietary.size() == 4 && names.size() == 4 && ranges.size() == 4);
+    menu.clear();
+    CHECK(index.size() == 0 && dietary.size() == 0 && names.size() == 0 && ranges.size() == 0);
+    CHECK(index.dishesWith("Garlic").empty() && names.search("chicken").empty() && ranges.find({}).empty());
+    menu.add(Dessert("Garlic Ice Cream", {"Garlic", "Cream"}, 20, 7.0, Dish::CuisineType::OTHER, Dessert::SWEET, 4, false));
+    menu.forEach([&](const Dish& dish) {
+        index.add(dish);
+        dietary.add(dish);
+        names.add(dish);
+        ranges.add(dish);
+    });
+    CHECK((index.dishesWith("Garlic") == std::vector<DishId>{0}) && index.dishesWith("Bread").empty());
+    CHECK((dietary.find(Dish::NUT_FREE) == std::vector<DishId>{0}));
+    CHECK(names.size() == 1 && !names.search("garlic ice cream").empty() && names.search("garlic ice cream")[0].id == 0);
+    CHECK((ranges.find({}) == std::vector<DishId>{0}));
+    menu.visit(0, [](Dish& dish) { dish.setIngredients({"Vanilla"}); });
+    CHECK(index.dishesWith("Garlic").empty() && (index.dishesWith("Vanilla") == std::vector<DishId>{0}));
+    for (DishObserver* observer : std::initializer_list<DishObserver*>{&index, &dietary, &names, &ranges}) {
+        menu.removeObserver(observer);
+    }
+}
+
+// Test: combined dietary queries through the bitset index agree with the subclass flags, and follow the setters
+void checkDietaryIndex() {
+    Menu menu;
+    menu.add(Appetizer("Spring Rolls", {"Cabbage"}, 15, 6.5, Dish::CuisineType::CHINESE, Appetizer::FAMILY_STYLE, 3, true));
+    menu.add(Dessert("Baklava", {"Walnuts"}, 60, 5.25, Dish::CuisineType::OTHER, Dessert::SWEET, 8, true));
+    menu.add(MainCourse("Grilled Chicken", {"Chicken"}, 30, 18.99, Dish::CuisineType::AMERICAN, MainCourse::GRILLED,
+                        "Chicken", {}, true));
+    menu.add(Appetizer("Chicken Wings", {"Chicken"}, 20, 9.0, Dish::CuisineType::AMERICAN, Appetizer::PLATED, 5, false));
+    menu.add(Dessert("Sorbet", {"Lemon"}, 10, 4.0, Dish::CuisineType::FRENCH, Dessert::SOUR, 6, false));
+
+    DietaryIndex index;
+    menu.addObserver(&index);
+    menu.forEach([&](const Dish& dish) { index.add(dish); });
+    CHECK(index.size() == 5 && menu[4].getKnownDietaryAttributes() == Dish::NUT_FREE);
+
+    // Vegetarian with a nut allergy: no dish records both, but unknown attributes may be allowed
+    const Dish::DietaryMask safe = Dish::VEGETARIAN | Dish::NUT_FREE;
+    CHECK(index.find(safe).empty());
+    CHECK((index.find(safe, DietaryIndex::Unknown::INCLUDE) == std::vector<DishId>{0, 2, 4}));
+    CHECK((index.find(Dish::GLUTEN_FREE) == std::vector<DishId>{2}));
+    CHECK(index.select(0).count() == 5);
+
+    menu.visit(4, [](auto& dish) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(dish)>, Dessert>) {
+            dish.setContainsNuts(true);
+        }
+    });
+    menu.visit(3, [](auto& dish) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(dish)>, Appetizer>) {
+            dish.setVegetarian(true);
+        }
+    });
+    CHECK((index.find(safe, DietaryIndex::Unknown::INCLUDE) == std::vector<DishId>{0, 2, 3}));
+    CHECK((index.find(Dish::NUT_FREE) == std::vector<DishId>{}));
+
+    // Copies carry the mask; a removed dish no longer matches
+    const Appetizer copy = menu.appetizers()[1];
+    CHECK(copy.isVegetarian() && copy.getDietaryAttributes() == Dish::VEGETARIAN);
+    index.remove(menu[0]);
+    CHECK((index.find(Dish::VEGETARIAN) == std::vector<DishId>{3}));
+    menu.removeObserver(&index);
+}
+
+// Test: a hand-computed two-station schedule with stealing, and determinism across kitchens and thread counts
+void checkKitchenScheduler() {
+    const std::vector<int> prep_times = {10, 20, 5};
+    std::vector<KitchenOrder> orders(2);
+    orders[0].dishes = {0, 1, 2};
+    orders[1].arrival = 30.0;
+    orders[1].dishes = {0};
+
+    // Station 0 takes the 10-minute dish, station 1 steals the 5 and then the 20; order 2 goes to station 1
+    const KitchenScheduler::Report report = KitchenScheduler(2, 1, 1).schedule(prep_times, orders);
+    CHECK(report.orders == 2 && report.dishes == 4 && report.steals == 2);
+    CHECK(report.makespan == 40.0 && report.max_latency == 25.0 && report.mean_latency == 17.5);
+    CHECK((report.station_busy == std::vector<double>{10.0, 35.0}) && report.utilization(1) == 35.0 / 40.0);
+
+    std::mt19937 rng(5);
+    std::vector<int> times(50);
+    for (int& time : times) {
+        time = static_cast<int>(5 + rng() % 40);
+    }
+    std::vector<KitchenOrder> stream(2000);
+    double clock = 0.0;
+    long long total = 0;
+    for (KitchenOrder& order : stream) {
+        clock += static_cast<double>(rng() % 4);
+        order.arrival = clock;
+        for (std::size_t k = 0; k < 1 + rng() % 4; ++k) {
+            order.dishes.push_back(static_cast<DishId>(rng() % times.size()));
+            total += times[order.dishes.back()];
+        }
+    }
+    const KitchenScheduler::Report one = KitchenScheduler(6, 3, 1).schedule(times, stream);
+    const KitchenScheduler::Report many = KitchenScheduler(6, 3, 4).schedule(times, stream);
+    double busy = 0.0;
+    for (double minutes : one.station_busy) {
+        busy += minutes;
+    }
+    CHECK(one.station_busy.size() == 18 && busy == static_cast<double>(total));
+    CHECK(one.station_busy == many.station_busy && one.p99_latency == many.p99_latency && one.steals == many.steals);
+    CHECK(one.p50_latency <= one.p90_latency && one.p90_latency <= one.p99_latency && one.p99_latency <= one.max_latency);
+
+    // Preparation times from a menu, and rejected input
+    Menu menu;
+    menu.add(Appetizer("Bruschetta", {"Bread"}, 12, 6.0, Dish::CuisineType::ITALIAN, Appetizer::PLATED, 0, true));
+    std::vector<KitchenOrder> one_dish(1);
+    one_dish[0].dishes = {0, 0};
+    CHECK(KitchenScheduler(1).schedule(menu, one_dish).makespan == 24.0);
+    bool threw = false;
+    try {
+        KitchenScheduler(1).schedule(menu, orders);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    CHECK(threw);
+    std::swap(orders[0], orders[1]);
+    threw = false;
+    try {
+        KitchenScheduler(2).schedule(prep_times, orders);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    CHECK(threw);
+}
+
+// Test: the lock-free queue is a bounded FIFO, loses nothing under contention, and feeds the order pipeline
+void checkOrderPipeline() {
+    MpmcQueue<int> small(3);
+    int value = 0;
+    CHECK(small.capacity() == 4 && !small.tryPop(value));
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            CHECK(small.tryPush(round * 4 + i));
+        }
+        CHECK(!small.tryPush(99) && small.sizeApprox() == 4);
+        for (int i = 0; i < 4; ++i) {
+            CHECK(small.tryPop(value) && value == round * 4 + i);
+        }
+    }
+
+    // Four producers and four consumers through a small queue: every value arrives exactly once
+    const int per_producer = 20000;
+    MpmcQueue<int> shared(64);
+    std::vector<std::atomic<int>> seen(4 * per_producer);
+    std::atomic<int> consumed(0);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < 4; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < per_producer; ++i) {
+                while (!shared.tryPush(p * per_producer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&] {
+            int item;
+            while (consumed.load() < 4 * per_producer) {
+                if (shared.tryPop(item)) {
+                    seen[item].fetch_add(1);
+                    consumed.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    CHECK(std::all_of(seen.begin(), seen.end(), [](const std::atomic<int>& count) { return count.load() == 1; }));
+
+    // Orders from concurrent terminals: invalid ones are rejected, valid ones priced and routed
+    Menu menu;
+    menu.add(Appetizer("Spring Rolls", {"Cabbage"}, 15, 6.5, Dish::CuisineType::CHINESE, Appetizer::FAMILY_STYLE, 3, true));
+    menu.add(Dessert("Baklava", {"Walnuts"}, 60, 5.25, Dish::CuisineType::OTHER, Dessert::SWEET, 8, true));
+    menu.add(MainCourse("Grilled Chicken", {"Chicken"}, 30, 18.99, Dish::CuisineType::AMERICAN, MainCourse::GRILLED,
+                        "Chicken", {}, true));
+    OrderPipeline::Config config;
+    config.queue_capacity = 16;
+    config.pricers = 2;
+    OrderPipeline pipeline(menu, config);
+    threads.clear();
+    for (std::uint32_t terminal = 0; terminal < 4; ++terminal) {
+        threads.emplace_back([&pipeline, terminal] {
+            for (OrderId id = 0; id < 500; ++id) {
+                Order order(id, terminal);
+                if (id % 10 == 0) {
+                    order.addLine(99);  // not on the menu
+                } else if (id % 10 == 1) {
+                    order.addLine(0, 0);  // no quantity
+                } else if (id % 10 != 2) {  // id % 10 == 2 leaves the order empty
+                    order.addLine(0, 2);
+                    order.addLine(id % 2 == 0 ? 1 : 2);
+                }
+                pipeline.submit(order);
+            }
+        });
+    }
+    std::size_t taken = 0;
+    std::size_t wrong = 0;
+    Order order;
+    std::thread consumer([&] {
+        while (pipeline.take(order)) {
+            ++taken;
+            const bool invalid = order.getId() % 10 <= 2;
+            if (invalid != (order.getStatus() == Order::Status::REJECTED) || order.getCompletedNs() < order.getSubmittedNs()) {
+                ++wrong;
+            } else if (!invalid) {
+                const bool dessert = order.getId() % 2 == 0;
+                const double total = 13.0 + (dessert ? 5.25 : 18.99);
+                const auto station = static_cast<std::uint8_t>(dessert ? Menu::Kind::DESSERT : Menu::Kind::MAIN_COURSE);
+                wrong += (order.getTotal() != total || order.getStation() != station) ? 1 : 0;
+            }
+        }
+    });
+    for (std::size_t i = 0; i < 4; ++i) {
+        threads[i].join();
+    }
+    pipeline.close();
+    consumer.join();
+    CHECK(taken == 2000 && wrong == 0);
+    CHECK(pipeline.submitted() == 2000 && pipeline.rejected() == 600);
+    Order full;
+    for (std::size_t i = 0; i < Order::kMaxLines; ++i) {
+        CHECK(full.addLine(0));
+    }
+    CHECK(!full.addLine(0) && full.getLines().size() == Order::kMaxLines);
+}
+
+// Test: ConcurrentMenu snapshots stay unchanged, batches publish atomically, and readers never see half a batch
+void checkConcurrentMenu() {
+    Menu menu;
+    for (int i = 0; i < 200; ++i) {
+        menu.add(Dessert("Sorbet", {"Lemon"}, 5, 0.0, Dish::CuisineType::OTHER, Dessert::SWEET, 4, false));
+    }
+    ConcurrentMenu shared(menu);
+    {
+        const ConcurrentMenu::Snapshot before = shared.snapshot();
+        ConcurrentMenu::Update update;
+        update.setPrice(3, 7.5).setIngredients(130, {"Lime", "Mint"});
+        CHECK(shared.publish(update) == 1);
+        const ConcurrentMenu::Snapshot after = shared.snapshot();
+        CHECK(before.version() == 0 && before[3].getPrice() == 0.0 && before[130].getIngredients().size() == 1);
+        CHECK(after.version() == 1 && after[3].getPrice() == 7.5);
+        CHECK((after[130].getIngredients() == std::vector<std::string>{"Lime", "Mint"}));
+        CHECK(shared.retiredCount() == 1);  // version 0 is held by before
+
+        ConcurrentMenu::Update invalid;
+        invalid.setPrice(0, 1.0).setPrice(200, 1.0);
+        bool threw = false;
+        try {
+            shared.publish(invalid);
+        } catch (const std::out_of_range&) {
+            threw = true;
+        }
+        CHECK(threw && shared.snapshot()[0].getPrice() == 0.0);
+    }
+    ConcurrentMenu::Update grow;
+    for (int i = 0; i < 100; ++i) {
+        grow.add(Dessert("Gelato", {"Milk"}, 5, 0.0, Dish::CuisineType::OTHER, Dessert::SWEET, 4, false));
+    }
+    CHECK(shared.publish(grow) == 2 && shared.retiredCount() == 0);
+    const std::size_t size = shared.snapshot().size();
+    CHECK(size == 300 && shared.snapshot()[199].getName() == "Sorbet" && shared.snapshot()[200].getName() == "Gelato");
+
+    // Version v sets every price to v and the ingredients of dish v % size to {v}; readers check whole snapshots
+    std::atomic<bool> done(false);
+    std::atomic<std::size_t> inconsistent(0);
+    std::atomic<std::size_t> snapshots(0);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            std::uint64_t last = 0;
+            while (!done.load()) {
+                const ConcurrentMenu::Snapshot snapshot = shared.snapshot();
+                const auto price = static_cast<double>(snapshot.version());
+                std::size_t bad = snapshot.version() < last ? 1 : 0;
+                last = snapshot.version();
+                if (snapshot.version() >= 3) {
+                    snapshot.forEach([&](const MenuItem& item) {
+                        bad += std::visit([&](const Dish& dish) { return dish.getPrice() != price; }, item) ? 1 : 0;
+                    });
+                    const std::size_t changed = snapshot.version() % snapshot.size();
+                    bad += snapshot[changed].getIngredients() != std::vector<std::string>{std::to_string(snapshot.version())};
+                }
+                inconsistent.fetch_add(bad);
+                snapshots.fetch_add(1);
+            }
+        });
+    }
+    for (std::uint64_t version = 3; version <= 400; ++version) {
+        ConcurrentMenu::Update update;
+        for (std::size_t position = 0; position < size; ++position) {
+            update.setPrice(position, static_cast<double>(version));
+        }
+        update.setIngredients(version % size, {std::to_string(version)});
+        CHECK(shared.publish(update) == version);
+    }
+    while (snapshots.load() < 10) {
+        std::this_thread::yield();
+    }
+    done.store(true);
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    CHECK(inconsistent.load() == 0);
+    ConcurrentMenu::Update last;
+    shared.publish(last.setPrice(0, 401.0));
+    CHECK(shared.retiredCount() == 0);
+}
+
+// Test: MenuAnalytics groups exactly, sketched quantiles stay within their error, and threads do not change results
+void checkMenuAnalytics() {
+    QuantileSketch low(0.01);
+    QuantileSketch high(0.01);
+    for (int i = 1; i <= 1000; ++i) {
+        (i <= 500 ? low : high).add(static_cast<double>(i));
+    }
+    low.merge(high);
+    CHECK(low.count() == 1000 && low.min() == 1.0 && low.max() == 1000.0);
+    CHECK(std::abs(low.quantile(0.5) - 501.0) <= 501.0 * 0.01 && std::abs(low.quantile(0.95) - 950.0) <= 950.0 * 0.01);
+    CHECK(low.quantile(0.0) == 1.0 && low.quantile(1.0) == 1000.0 && QuantileSketch().quantile(0.5) == 0.0);
+
+    Menu menu;
+    menu.add(Appetizer("Bruschetta", {"Bread"}, 10, 8.0, Dish::CuisineType::ITALIAN, Appetizer::PLATED, 1, true));
+    menu.add(Appetizer("Nachos", {"Corn"}, 12, 9.0, Dish::CuisineType::MEXICAN, Appetizer::FAMILY_STYLE, 3, true));
+    menu.add(MainCourse("Lasagna", {"Pasta"}, 60, 21.0, Dish::CuisineType::ITALIAN, MainCourse::BAKED, "Beef", {}, false));
+    menu.add(Dessert("Tiramisu", {"Coffee"}, 30, 7.0, Dish::CuisineType::ITALIAN, Dessert::BITTER, 6, false));
+    const MenuAnalytics::Report exact = MenuAnalytics(2).analyze(menu, MenuAnalytics::Quantiles::EXACT);
+    const MenuAnalytics::GroupStats& italian = exact.by_cuisine[static_cast<std::size_t>(Dish::CuisineType::ITALIAN)];
+    CHECK(exact.overall.price.count == 4 && exact.overall.price.mean == 11.25 && exact.overall.price.max == 21.0);
+    CHECK(italian.price.count == 3 && italian.price.min == 7.0 && italian.price.median == 8.0);
+    CHECK(italian.prep_time.mean == 100.0 / 3 && italian.prep_time.p95 == 60.0);
+    CHECK(exact.by_serving_style[Appetizer::FAMILY_STYLE].price.mean == 9.0);
+    CHECK(exact.by_cooking_method[MainCourse::BAKED].prep_time.median == 60.0);
+    CHECK(exact.by_flavor_profile[Dessert::BITTER].price.count == 1 && exact.by_flavor_profile[Dessert::SWEET].price.count == 0);
+    std::string table;
+    exact.render(table);
+    CHECK(table.find("cuisine ITALIAN") != std::string::npos && table.find("flavor SWEET") == std::string::npos);
+
+    // A menu large enough for several blocks per kind
+    Menu large;
+    std::mt19937 rng(5);
+    for (int i = 0; i < 150000; ++i) {
+        const auto cuisine = static_cast<Dish::CuisineType>(rng() % 7);
+        const double price = 1.0 + static_cast<double>(rng() % 10000) / 100.0;
+        const int prep_time = 1 + static_cast<int>(rng() % 120);
+        if (i % 2 == 0) {
+            large.add(MainCourse("Stew", {"Beans"}, prep_time, price, cuisine, static_cast<MainCourse::CookingMethod>(rng() % 5),
+                                 "Beans", {}, true));
+        } else {
+            large.add(Dessert("Flan", {"Eggs"}, prep_time, price, cuisine, static_cast<Dessert::FlavorProfile>(rng() % 5), 5, false));
+        }
+    }
+    const MenuAnalytics::Report reference = MenuAnalytics(1).analyze(large, MenuAnalytics::Quantiles::EXACT);
+    const MenuAnalytics::Report sketched = MenuAnalytics(1).analyze(large);
+    const MenuAnalytics::Report parallel = MenuAnalytics(4).analyze(large);
+    auto within = [](const MenuAnalytics::Summary& estimate, const MenuAnalytics::Summary& truth) {
+        return estimate.count == truth.count && estimate.mean == truth.mean && estimate.min == truth.min &&
+               estimate.max == truth.max && std::abs(estimate.median - truth.median) <= truth.median * 0.01 + 1e-9 &&
+               std::abs(estimate.p95 - truth.p95) <= truth.p95 * 0.01 + 1e-9;
+    };
+    CHECK(within(sketched.overall.price, reference.overall.price) && within(sketched.overall.prep_time, reference.overall.prep_time));
+    std::size_t mismatches = 0;
+    for (std::size_t cuisine = 0; cuisine < reference.by_cuisine.size(); ++cuisine) {
+        mismatches += within(sketched.by_cuisine[cuisine].price, reference.by_cuisine[cuisine].price) ? 0 : 1;
+        mismatches += within(sketched.by_cuisine[cuisine].prep_time, reference.by_cuisine[cuisine].prep_time) ? 0 : 1;
+    }
+    for (std::size_t method = 0; method < reference.by_cooking_method.size(); ++method) {
+        mismatches += within(sketched.by_cooking_method[method].price, reference.by_cooking_method[method].price) ? 0 : 1;
+    }
+    CHECK(mismatches == 0);
+    std::string serial_table;
+    std::string parallel_table;
+    sketched.render(serial_table);
+    parallel.render(parallel_table);
+    CHECK(serial_table == parallel_table);
+}
+
+// Test: Menu::stats() follows additions and setter calls, and agrees with a full recomputation
+void checkMenuStats() {
+    Menu menu;
+    CHECK(menu.stats().dishCount() == 0 && menu.stats().meanPrice() == 0.0 && menu.verifyStats());
+    menu.add(Appetizer("Bruschetta", {"Bread"}, 10, 8.0, Dish::CuisineType::ITALIAN, Appetizer::PLATED, 1, true));
+    menu.add(MainCourse("Tacos", {"Corn"}, 20, 12.0, Dish::CuisineType::MEXICAN, MainCourse::GRILLED, "Pork", {}, true));
+    menu.add(Dessert("Gelato", {"Milk"}, 6, 4.0, Dish::CuisineType::ITALIAN, Dessert::SWEET, 7, false));
+    const MenuStats& stats = menu.stats();
+    CHECK(stats.dishCount() == 3 && stats.totalPrice() == 24.0 && stats.meanPrice() == 8.0);
+    CHECK(stats.totalPrepTime() == 36 && stats.meanPrepTime() == 12.0);
+    CHECK(stats.cuisineCount(Dish::CuisineType::ITALIAN) == 2 && stats.cuisineCount(Dish::CuisineType::FRENCH) == 0);
+
+    menu.visit(1, [](auto& dish) {
+        dish.setPrice(15.0);
+        dish.setPrepTime(30);
+        dish.setCuisineType(Dish::CuisineType::ITALIAN);
+        dish.setName("Ravioli");  // not aggregated
+    });
+    CHECK(stats.totalPrice() == 27.0 && stats.totalPrepTime() == 46);
+    CHECK(stats.cuisineCount(Dish::CuisineType::ITALIAN) == 3 && stats.cuisineCount(Dish::CuisineType::MEXICAN) == 0);
+
+    // Many random updates alongside another observer: still consistent with a full scan
+    DietaryIndex dietary;
+    menu.addObserver(&dietary);
+    std::mt19937 rng(17);
+    for (int i = 0; i < 2000; ++i) {
+        menu.add(Dessert("Tart", {"Flour"}, 1 + static_cast<int>(rng() % 90), 0.01 * (rng() % 5000),
+                         static_cast<Dish::CuisineType>(rng() % 7), Dessert::SOUR, 3, false));
+    }
+    for (int i = 0; i < 20000; ++i) {
+        menu.visit(rng() % menu.size(), [&](auto& dish) {
+            switch (rng() % 3) {
+                case 0: dish.setPrice(0.01 * (rng() % 100000)); break;
+                case 1: dish.setPrepTime(static_cast<int>(rng() % 240)); break;
+                default: dish.setCuisineType(static_cast<Dish::CuisineType>(rng() % 7)); break;
+            }
+        });
+    }
+    CHECK(menu.verifyStats() && stats.dishCount() == 2003);
+    const MenuStats fresh = MenuStats::compute(menu);
+    CHECK(stats.cuisineCount(Dish::CuisineType::CHINESE) == fresh.cuisineCount(Dish::CuisineType::CHINESE));
+    CHECK(stats.totalPriceCents() == fresh.totalPriceCents());
+
+    // The extremes are summed in 64 bits: taking out a price of INT32_MIN cents negates it
+    const std::int64_t cents = stats.totalPriceCents() - menu[2].getPriceCents();
+    menu.visit(2, [](auto& dish) {
+        dish.setPrice(-1e12);
+        dish.setPrepTime(std::numeric_limits<int>::min());
+    });
+    CHECK(stats.totalPriceCents() == cents + std::numeric_limits<std::int32_t>::min() && menu.verifyStats());
+    menu.visit(2, [](auto& dish) {
+        dish.setPrice(4.0);
+        dish.setPrepTime(6);
+    });
+    CHECK(stats.totalPriceCents() == cents + 400 && menu.verifyStats());
+
+    // A whole-dish assignment bypasses the setters, which the recomputation detects
+    menu.visit(0, [](auto& dish) {
+        auto replacement = dish;
+        replacement.setPrice(dish.getPrice() + 100.0);
+        dish = replacement;
+    });
+    CHECK(!menu.verifyStats() && !stats.matches(MenuStats::compute(menu)));
+    menu.clear();
+    CHECK(stats.dishCount() == 0 && stats.totalPrice() == 0.0 && menu.verifyStats());
+}
+
+// Test: the packed dish layout keeps prices to the cent, clamps levels, and maps out-of-range cuisines to OTHER and
+// other out-of-range enums to their default
+void checkPackedLayout() {
+    CHECK(sizeof(Appetizer) == sizeof(Dish) && sizeof(Dessert) == sizeof(Dish));
+    Dish dish("Soup", {}, 10, 18.99, static_cast<Dish::CuisineType>(42));
+    CHECK(dish.getPrice() == 18.99 && dish.getPriceCents() == 1899 && dish.getCuisine() == Dish::CuisineType::OTHER);
+    dish.setPrice(9.999);
+    CHECK(dish.getPriceCents() == 1000 && dish.getPrice() == 10.0);
+    dish.setPrice(-2.5);
+    CHECK(dish.getPriceCents() == -250);
+    dish.setPrice(std::nan(""));
+    CHECK(dish.getPriceCents() == 0);
+    dish.setPrice(1e12);
+    CHECK(dish.getPriceCents() == std::numeric_limits<std::int32_t>::max());
+    dish.setCuisineType(Dish::CuisineType::FRENCH);
+    CHECK(dish.getCuisineType() == "FRENCH");
+
+    Appetizer wings("Wings", {}, 20, 9.0, Dish::CuisineType::AMERICAN, Appetizer::BUFFET, 14, true);
+    CHECK(wings.getSpicinessLevel() == Appetizer::kMaxSpicinessLevel && wings.getServingStyle() == Appetizer::BUFFET && wings.isVegetarian());
+    wings.setSpicinessLevel(-3);
+    CHECK(wings.getSpicinessLevel() == 0 && wings.getCuisine() == Dish::CuisineType::AMERICAN);
+    Dessert sorbet("Sorbet", {}, 5, 4.0, Dish::CuisineType::FRENCH, Dessert::UMAMI, 7, true);
+    sorbet.setSweetnessLevel(11);
+    CHECK(sorbet.getSweetnessLevel() == Dessert::kMaxSweetnessLevel && sorbet.getFlavorProfile() == Dessert::UMAMI && sorbet.containsNuts());
+    MainCourse stew("Stew", {}, 90, 16.5, Dish::CuisineType::FRENCH, MainCourse::RAW, "Beef", {}, true);
+    CHECK(stew.getCookingMethod() == MainCourse::RAW && stew.isGlutenFree() && stew.getPriceCents() == 1650);
+
+    // Enum values past the last enumerator fall back to the default instead of being stored as they come (values
+    // past the bit-field would wrap into another enumerator, but they are out of the enum's range, so not tested)
+    stew.setCookingMethod(static_cast<MainCourse::CookingMethod>(6));
+    CHECK(stew.getCookingMethod() == MainCourse::GRILLED);
+    wings.setServingStyle(static_cast<Appetizer::ServingStyle>(3));
+    CHECK(wings.getServingStyle() == Appetizer::PLATED);
+    sorbet.setFlavorProfile(static_cast<Dessert::FlavorProfile>(7));
+    CHECK(sorbet.getFlavorProfile() == Dessert::SWEET);
+    const Dessert tart("Tart", {}, 5, 4.0, Dish::CuisineType::FRENCH, static_cast<Dessert::FlavorProfile>(5), 7, true);
+    CHECK(tart.getFlavorProfile() == Dessert::SWEET);
+}
+
+// Test: NameIndex ranks fuzzy matches, completes prefixes like a brute-force scan, and follows setName
+void checkNameIndex() {
+    Menu menu;
+    menu.add(MainCourse("Chicken Curry", {"Chicken"}, 40, 14.0, Dish::CuisineType::INDIAN, MainCourse::BAKED, "Chicken", {}, true));
+    menu.add(MainCourse("Grilled Chicken", {"Chicken"}, 30, 18.99, Dish::CuisineType::AMERICAN, MainCourse::GRILLED, "Chicken", {}, true));
+    menu.add(Appetizer("Grilled Halloumi", {"Cheese"}, 10, 8.0, Dish::CuisineType::OTHER, Appetizer::PLATED, 0, true));
+    menu.add(Dessert("Lemon Sorbet", {"Lemon"}, 5, 4.0, Dish::CuisineType::FRENCH, Dessert::SOUR, 6, false));
+    menu.add(MainCourse("chicken  curry!", {"Chicken"}, 35, 12.0, Dish::CuisineType::INDIAN, MainCourse::BAKED, "Chicken", {}, true));
+    NameIndex index;
+    menu.forEach([&index](const Dish& dish) { index.add(dish); });
+    menu.addObserver(&index);
+    CHECK(index.size() == 5 && index.termCount() == 5 && index.contains(4));  // "chicken  curry!" was renamed UNKNOWN
+
+    std::vector<NameIndex::Match> matches = index.search("chiken cury");
+    CHECK(!matches.empty() && matches[0].id == 0 && matches[0].score > 0.4 && matches[0].score < 1.0);
+    matches = index.search("CURRY chicken");
+    CHECK(!matches.empty() && matches[0].id == 0 && matches[0].score == 1.0);
+    CHECK(index.search("zzzz").empty() && index.search("").empty() && index.search("curry", 0).empty());
+
+    CHECK((index.complete("gri") == std::vector<DishId>{1, 2}));
+    CHECK((index.complete("Grilled H") == std::vector<DishId>{2}));
+    CHECK((index.complete("chi") == std::vector<DishId>{0, 1}));  // a name prefix first, then a later word
+    CHECK((index.complete("grilled ", 1) == std::vector<DishId>{1}));
+    CHECK(index.complete("grilledc").empty() && index.complete("  ").empty());
+
+    // setName moves the dish between terms; a shared name is one term
+    menu.visit(2, [](auto& dish) { dish.setName("Lemon Sorbet"); });
+    CHECK(index.termCount() == 4 && (index.complete("lemon") == std::vector<DishId>{2, 3}));
+    CHECK(index.complete("gri") == std::vector<DishId>{1} && index.search("halloumi").empty());
+    menu.visit(3, [&index](const Dish& dish) { index.remove(dish); });
+    CHECK(index.size() == 4 && (index.complete("lemon") == std::vector<DishId>{2}));
+
+    // Completion agrees with a scan over many random names, through renames that create and drop terms
+    const char* words[] = {"Spicy", "Tofu", "Tomato", "Soup", "Salad", "Smoked", "Salmon", "Tart", "Toast", "Sweet"};
+    std::mt19937 rng(21);
+    Menu catalog;
+    for (int i = 0; i < 400; ++i) {
+        std::string name = words[rng() % 10];
+        for (std::size_t k = 0; k < 1 + rng() % 2; ++k) {
+            name += std::string(" ") + words[rng() % 10];
+        }
+        catalog.add(Dessert(name, {}, 5, 4.0, Dish::CuisineType::OTHER, Dessert::SWEET, 1, false));
+    }
+    NameIndex names;
+    catalog.forEach([&names](const Dish& dish) { names.add(dish); });
+    catalog.addObserver(&names);
+    for (int i = 0; i < 200; ++i) {
+        catalog.visit(rng() % catalog.size(), [&](auto& dish) { dish.setName(std::string(words[rng() % 10]) + " " + words[rng() % 10]); });
+    }
+    for (const char* prefix : {"s", "sa", "to", "tom", "smoked s", "sweet tart", "x"}) {
+        std::vector<DishId> starts;
+        std::vector<DishId> later;
+        catalog.forEach([&](const Dish& dish) {
+            std::string name(dish.getNameView());
+            std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            if (name.rfind(prefix, 0) == 0) {
+                starts.push_back(dish.getId());
+            } else if (name.find(std::string(" ") + prefix) != std::string::npos) {
+                later.push_back(dish.getId());
+            }
+        });
+        std::sort(starts.begin(), starts.end());
+        std::vector<DishId> completed = names.complete(prefix, catalog.size());
+        CHECK(completed.size() == starts.size() + later.size());
+        std::vector<DishId> first(completed.begin(), completed.begin() + static_cast<std::ptrdiff_t>(std::min(completed.size(), starts.size())));
+        std::sort(first.begin(), first.end());
+        std::sort(completed.begin(), completed.end());
+        std::vector<DishId> expected = starts;
+        expected.insert(expected.end(), later.begin(), later.end());
+        std::sort(expected.begin(), expected.end());
+        CHECK(first == starts && completed == expected);
+    }
+}
+
+// Test: equality and stable hashing across the hierarchy, and DishPool hands out one canonical instance per
+// distinct dish with exact dedup counters
+void checkDishPool() {
+    // Golden values: the hash must not change between builds or platforms
+    CHECK(stableHash("") == 0x7f40f5117e11298bull && stableHash("Caesar Salad") == 0x581800907d15fd0eull);
+    CHECK(stableHash("Slow Roasted Pork Shoulder With Apples") == 0x437dc1065bd2c890ull);
+    IngredientTable local;
+    local.intern("Zucchini");
+    CHECK(local.hashOf(local.intern("Garlic")) == IngredientTable::global().hashOf(IngredientTable::global().intern("Garlic")));
+
+    const std::vector<MainCourse::SideDish> sides = {{"Rice", MainCourse::GRAIN}, {"Roasted Seasonal Root Vegetables With Herbs", MainCourse::VEGETABLE}};
+    MainCourse curry("Chicken Curry", {"Chicken", "Garlic"}, 40, 14.0, Dish::CuisineType::INDIAN, MainCourse::BAKED, "Chicken", sides, true);
+    MainCourse copy(curry);
+    copy.setId(7);
+    CHECK(copy == curry && copy.hash() == curry.hash() && std::hash<MainCourse>()(copy) == std::hash<MainCourse>()(curry));
+    copy.setSideDishes(Span<const MainCourse::SideDish>(sides.data(), 1));
+    CHECK(copy != curry && copy.hash() != curry.hash());
+    copy = curry;
+    copy.setIngredients({"Garlic", "Chicken"});  // ingredient order counts
+    CHECK(copy != curry && copy.hash() != curry.hash());
+    copy = curry;
+    copy.setProteinType("Tofu");
+    CHECK(copy != curry && copy.hash() != curry.hash() && static_cast<const Dish&>(copy) == curry);
+
+    Appetizer wings("Wings", {"Chicken"}, 20, 9.0, Dish::CuisineType::AMERICAN, Appetizer::BUFFET, 6, false);
+    Appetizer hotter(wings);
+    CHECK(hotter == wings);
+    hotter.setSpicinessLevel(7);
+    CHECK(hotter != wings && hotter.hash() != wings.hash());
+    Dessert tart("Lemon Tart", {"Lemon"}, 30, 6.5, Dish::CuisineType::FRENCH, Dessert::SOUR, 5, false);
+    Dessert sweeter(tart);
+    sweeter.setSweetnessLevel(6);
+    CHECK(sweeter != tart && sweeter.hash() != tart.hash() && Dish(tart).hash() != tart.hash());
+
+    // Three locations serve the same curry: one canonical instance, two duplicates saved
+    DishPool pool;
+    const MainCourse& canonical = pool.intern(curry);
+    CHECK(&canonical != &curry && canonical == curry && canonical.getId() == kNoDishId);
+    MainCourse elsewhere(curry);
+    elsewhere.setId(3);
+    CHECK(&pool.intern(elsewhere) == &canonical && &pool.intern(curry) == &canonical);
+    CHECK(pool.size() == 1 && pool.stats().requests == 3 && pool.stats().dedupRatio() == 3.0);
+    CHECK(pool.stats().bytes_saved == 2 * DishPool::footprint(curry) && pool.stats().bytes_held == DishPool::footprint(curry));
+    CHECK(DishPool::footprint(curry) > sizeof(MainCourse));  // the long side dish name is on the heap
+    CHECK(&pool.intern(wings) != &pool.intern(hotter) && &pool.intern(tart) == &pool.intern(Dessert(tart)));
+
+    // A merged menu with many repeats, through several rehashes: the pool agrees with a quadratic scan
+    std::mt19937 rng(5);
+    std::vector<Dessert> merged;
+    for (int i = 0; i < 3000; ++i) {
+        merged.emplace_back(rng() % 2 == 0 ? "Lemon Tart" : "Chocolate Mousse", std::vector<std::string>{"Sugar"}, 10 + static_cast<int>(rng() % 20), 5.0,
+                            Dish::CuisineType::FRENCH, static_cast<Dessert::FlavorProfile>(rng() % 5), static_cast<int>(rng() % 11), rng() % 2 == 0);
+    }
+    DishPool merged_pool;
+    std::vector<const Dessert*> distinct;
+    for (const Dessert& dessert : merged) {
+        const Dessert& interned = merged_pool.intern(dessert);
+        CHECK(interned == dessert);
+        auto it = std::find_if(distinct.begin(), distinct.end(), [&](const Dessert* seen) { return *seen == dessert; });
+        if (it == distinct.end()) {
+            distinct.push_back(&interned);
+        } else {
+            CHECK(*it == &interned);
+        }
+    }
+    CHECK(merged_pool.size() == distinct.size() && merged_pool.stats().requests == merged.size() && merged_pool.stats().dedupRatio() > 1.0);
+    merged_pool.clear();
+    CHECK(merged_pool.size() == 0 && merged_pool.stats().requests == 0 && merged_pool.intern(merged[0]) == merged[0]);
+}
+
+// Test: RangeIndex answers price and preparation time ranges, top-k and ordered iteration like a sorted scan, through
+// price and prep time updates, block splits, merges and removals
+void checkRangeIndex() {
+    std::mt19937 rng(17);
+    std::vector<Dish> dishes;
+    for (int i = 0; i < 2000; ++i) {
+        dishes.emplace_back("Soup", std::vector<std::string>{}, static_cast<int>(rng() % 60), static_cast<double>(rng() % 3000) / 100.0);
+    }
+    RangeIndex index;
+    for (std::size_t i = 0; i < dishes.size(); ++i) {
+        dishes[i].setId(static_cast<DishId>(i));
+        dishes[i].setObserver(&index);
+        index.add(dishes[i]);
+    }
+    CHECK(index.size() == 2000 && index.contains(1999) && !index.contains(2000));
+    CHECK(index.memoryUsage() >= 2 * 2000 * 3 * sizeof(std::int32_t));
+
+    // The expected answer: every dish in the bounds, sorted by the order's key, then the other key, then ID
+    auto expected = [&](const RangeIndex::Query& query, RangeIndex::Order order, std::size_t limit) {
+        std::vector<std::tuple<int, int, DishId>> rows;
+        for (const Dish& dish : dishes) {
+            if (index.contains(dish.getId()) && dish.getPriceCents() >= query.min_price_cents && dish.getPriceCents() <= query.max_price_cents &&
+                dish.getPrepTime() >= query.min_prep_time && dish.getPrepTime() <= query.max_prep_time) {
+                rows.emplace_back(order == RangeIndex::Order::PRICE ? dish.getPriceCents() : dish.getPrepTime(),
+                                  order == RangeIndex::Order::PRICE ? dish.getPrepTime() : dish.getPriceCents(), dish.getId());
+            }
+        }
+        std::sort(rows.begin(), rows.end());
+        std::vector<DishId> ids;
+        for (std::size_t i = 0; i < rows.size() && i < limit; ++i) {
+            ids.push_back(std::get<2>(rows[i]));
+        }
+        return ids;
+    };
+    auto agrees = [&]() {
+        bool ok = true;
+        for (int q = 0; q < 60; ++q) {
+            RangeIndex::Query query;
+            query.maxPrice(static_cast<double>(rng() % 3200) / 100.0).maxPrepTime(static_cast<int>(rng() % 64));
+            if (q % 3 == 0) {
+                query.minPrice(static_cast<double>(rng() % 1500) / 100.0).minPrepTime(static_cast<int>(rng() % 30));
+            }
+            for (RangeIndex::Order order : {RangeIndex::Order::PRICE, RangeIndex::Order::PREP_TIME}) {
+                const std::vector<DishId> all = expected(query, order, dishes.size());
+                ok = ok && index.find(query, order) == all && index.find(query, order, 7) == expected(query, order, 7);
+                ok = ok && index.count(query) == all.size();
+            }
+        }
+        return ok;
+    };
+    CHECK(agrees());
+
+    RangeIndex::Query under;
+    under.maxPrice(10.0).maxPrepTime(15);  // "under $10, ready in 15 minutes"
+    CHECK(index.cheapest(5, under) == expected(under, RangeIndex::Order::PRICE, 5));
+    CHECK(index.fastest(5) == expected(RangeIndex::Query(), RangeIndex::Order::PREP_TIME, 5));
+    std::vector<DishId> visited;
+    int last_price = -1;
+    bool ordered = true;
+    index.forEach(under, RangeIndex::Order::PRICE, [&](DishId id, std::int32_t price_cents, std::int32_t prep_time) {
+        ordered = ordered && price_cents >= last_price && price_cents == dishes[id].getPriceCents() && prep_time <= 15;
+        last_price = price_cents;
+        visited.push_back(id);
+    });
+    CHECK(ordered && visited == expected(under, RangeIndex::Order::PRICE, dishes.size()));
+    RangeIndex::Query empty;
+    empty.minPrice(20.0).maxPrice(10.0);
+    CHECK(index.find(empty).empty() && index.count(empty) == 0 && index.cheapest(0).empty());
+
+    // Updates through the setters, then removals that empty and merge blocks
+    for (int i = 0; i < 3000; ++i) {
+        Dish& dish = dishes[rng() % dishes.size()];
+        if (rng() % 2 == 0) {
+            dish.setPrice(static_cast<double>(rng() % 3000) / 100.0);
+        } else {
+            dish.setPrepTime(static_cast<int>(rng() % 60));
+        }
+    }
+    CHECK(agrees());
+    for (std::size_t i = 0; i < dishes.size(); ++i) {
+        if (i % 10 != 0) {
+            index.remove(dishes[i]);
+        }
+    }
+    CHECK(index.size() == 200 && !index.contains(1) && agrees());
+    dishes[10].setPrice(99.99);
+    CHECK(index.find(RangeIndex::Query().minPrice(50.0)) == std::vector<DishId>{10} && index.count(RangeIndex::Query().maxPrice(50.0)) == 199);
+}
+
+// Test: ChangeLog records setter changes as deltas that a replica replays to an equal menu, commits concurrent
+// writers together, and recovers from a log cut at random points (a crash mid-write) or a corrupted byte
+void checkChangeLog() {
+    const std::string path = "check_change_log.bin";
+    const std::string cut_path = "check_change_log_cut.bin";
+    std::remove(path.c_str());
+
+    auto build = [](Menu& menu) {
+        for (int i = 0; i < 4; ++i) {
+            menu.add(Appetizer("Spring Rolls", {"Cabbage", "Carrot"}, 15, 6.5, Dish::CuisineType::CHINESE, Appetizer::FAMILY_STYLE, 3, true));
+            menu.add(MainCourse("Grilled Chicken", {"Chicken"}, 30, 18.99, Dish::CuisineType::AMERICAN, MainCourse::GRILLED, "Chicken",
+                                {MainCourse::SideDish("Rice", MainCourse::GRAIN)}, true));
+            menu.add(Dessert("Baklava", {"Walnuts", "Honey"}, 60, 5.25, Dish::CuisineType::OTHER, Dessert::SWEET, 8, true));
+        }
+    };
+    // One round of random changes covering every field of every class
+    auto mutate = [](Menu& menu, std::mt19937& rng) {
+        const char* const names[] = {"Samosa", "Slow Roasted Pork Shoulder With Apples", "Flan", ""};
+        for (int step = 0; step < 25; ++step) {
+            const std::size_t position = rng() % menu.size();
+            const unsigned choice = rng() % 9;
+            const unsigned value = rng();
+            menu.visit(position, [&](auto& dish) {
+                using T = std::decay_t<decltype(dish)>;
+                switch (choice) {
+                    case 0: dish.setName(names[value % 4]); return;
+                    case 1: dish.setIngredients(std::vector<std::string>(value % 5, names[value % 3])); return;
+                    case 2: dish.setPrepTime(static_cast<int>(value % 90)); return;
+                    case 3: dish.setPrice(static_cast<double>(value % 5000) / 100.0); return;
+                    case 4: dish.setCuisineType(static_cast<Dish::CuisineType>(value % 7)); return;
+                    default: break;
+                }
+                if constexpr (std::is_same_v<T, Appetizer>) {
+                    if (choice == 5) {
+                        dish.setServingStyle(static_cast<Appetizer::ServingStyle>(value % 3));
+                    } else if (choice == 6) {
+                        dish.setSpicinessLevel(static_cast<int>(value % 11));
+                    } else {
+                        dish.setVegetarian(value % 2 == 0);
+                    }
+                } else if constexpr (std::is_same_v<T, MainCourse>) {
+                    if (choice == 5) {
+                        dish.setCookingMethod(static_cast<MainCourse::CookingMethod>(value % 5));
+                    } else if (choice == 6) {
+                        dish.setProteinType(names[value % 4]);
+                    } else if (choice == 7) {
+                        std::vector<MainCourse::SideDish> sides(value % 4, MainCourse::SideDish(names[value % 4], MainCourse::VEGETABLE));
+                        dish.setSideDishes(sides);
+                    } else {
+                        dish.setGlutenFree(value % 2 == 0);
+                    }
+                } else {
+                    if (choice == 5) {
+                        dish.setFlavorProfile(static_cast<Dessert::FlavorProfile>(value % 5));
+                    } else if (choice == 6) {
+                        dish.setSweetnessLevel(static_cast<int>(value % 11));
+                    } else {
+                        dish.setContainsNuts(value % 2 == 0);
+                    }
+                }
+            });
+        }
+    };
+    auto same = [](const Menu& a, const Menu& b) {
+        bool equal = a.size() == b.size();
+        for (std::size_t i = 0; equal && i < a.size(); ++i) {
+            equal = a.visit(i, [&](const auto& x) {
+                return b.visit(i, [&](const auto& y) {
+                    if constexpr (std::is_same_v<decltype(x), decltype(y)>) {
+                        return x == y;
+                    } else {
+                        return false;
+                    }
+                });
+            });
+        }
+        return equal;
+    };
+    // The menu after the first `rounds` rounds of changes
+    auto stateAfter = [&](Menu& menu, std::size_t rounds) {
+        build(menu);
+        std::mt19937 rng(29);
+        for (std::size_t r = 0; r < rounds; ++r) {
+            mutate(menu, rng);
+        }
+    };
+
+    // One frame per round: the batch never fills, so only commit() writes
+    const std::size_t kRounds = 12;
+    std::vector<std::uint64_t> frame_ends;
+    {
+        Menu primary;
+        build(primary);
+        ChangeLog log(path, ChangeLog::Options{std::size_t{1} << 20, false});
+        primary.addObserver(&log);
+        frame_ends.push_back(log.fileSize());
+        std::mt19937 rng(29);
+        for (std::size_t r = 0; r < kRounds; ++r) {
+            mutate(primary, rng);
+            log.commit();
+            frame_ends.push_back(log.fileSize());
+        }
+        CHECK(log.stats().deltas == 25 * kRounds && log.stats().commits == kRounds && log.stats().bytes + 8 == log.fileSize());
+
+        Menu replica;
+        build(replica);
+        ChangeLogReplayer replayer(path);
+        const ChangeLogReplayer::Result result = replayer.catchUp(replica);
+        CHECK(result.complete && result.commits == kRounds && result.deltas == 25 * kRounds && result.skipped == 0);
+        CHECK(same(primary, replica) && replayer.offset() == log.fileSize());
+        CHECK(replayer.catchUp(replica).commits == 0);
+
+        // A replica that tails the log sees later commits; one far shorter than the menu skips what it lacks
+        mutate(primary, rng);
+        log.commit();
+        CHECK(replayer.catchUp(replica).commits == 1 && same(primary, replica));
+        Menu short_replica;
+        short_replica.add(Dessert("Flan", {"Eggs"}, 40, 4.0, Dish::CuisineType::FRENCH, Dessert::SWEET, 7, false));
+        const ChangeLogReplayer::Result partial = ChangeLogReplayer(path).catchUp(short_replica);
+        CHECK(partial.complete && partial.skipped > 0 && partial.deltas + partial.skipped == 25 * (kRounds + 1));
+
+        Dish loose("Soup", {}, 5, 3.0);
+        bool threw = false;
+        try {
+            log.record(loose, DishField::PRICE);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        CHECK(threw);
+    }
+
+    std::string bytes;
+    if (std::FILE* file = std::fopen(path.c_str(), "rb")) {
+        char chunk[4096];
+        for (std::size_t n; (n = std::fread(chunk, 1, sizeof(chunk), file)) > 0;) {
+            bytes.append(chunk, n);
+        }
+        std::fclose(file);
+    }
+    bytes.resize(frame_ends.back());  // the first kRounds frames
+    auto writeFile = [](const std::string& file_path, const std::string& contents) {
+        std::FILE* file = std::fopen(file_path.c_str(), "wb");
+        std::fwrite(contents.data(), 1, contents.size(), file);
+        std::fclose(file);
+    };
+
+    // Cut the log at random points: a replica gets exactly the commits that fit, and a writer reopening the log cuts
+    // the torn frame off and appends after the last whole commit
+    std::mt19937 rng(31);
+    bool recovered = true;
+    for (int trial = 0; trial < 40; ++trial) {
+        const std::size_t cut = trial == 0 ? 3 : rng() % (bytes.size() + 1);
+        writeFile(cut_path, bytes.substr(0, cut));
+        const std::size_t fit = static_cast<std::size_t>(std::upper_bound(frame_ends.begin(), frame_ends.end(), cut) - frame_ends.begin());
+        const std::size_t rounds = fit == 0 ? 0 : fit - 1;
+        Menu expected;
+        stateAfter(expected, rounds);
+        if (cut >= 8) {
+            Menu replica;
+            build(replica);
+            const ChangeLogReplayer::Result result = ChangeLogReplayer(cut_path).catchUp(replica);
+            recovered = recovered && result.commits == rounds && result.complete == (cut == frame_ends[rounds]) && same(expected, replica);
+        }
+        {
+            ChangeLog log(cut_path, ChangeLog::Options{64, false});
+            recovered = recovered && log.fileSize() == frame_ends[rounds];
+            expected.addObserver(&log);
+            std::mt19937 more(trial);
+            mutate(expected, more);
+            log.commit();
+        }
+        Menu replica;
+        build(replica);
+        const ChangeLogReplayer::Result result = ChangeLogReplayer(cut_path).catchUp(replica);
+        recovered = recovered && result.complete && same(expected, replica);
+    }
+    CHECK(recovered);
+
+    // A flipped byte fails the CRC of its frame; replay stops before it
+    std::string corrupt = bytes;
+    corrupt[frame_ends[2] + 10] ^= 0x20;
+    writeFile(cut_path, corrupt);
+    Menu replica;
+    build(replica);
+    const ChangeLogReplayer::Result result = ChangeLogReplayer(cut_path).catchUp(replica);
+    Menu expected;
+    stateAfter(expected, 2);
+    CHECK(!result.complete && result.commits == 2 && same(expected, replica));
+    writeFile(cut_path, "NOTALOG!");
+    bool threw = false;
+    try {
+        ChangeLog log(cut_path);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    CHECK(threw);
+
+    // Writers on several threads: every delta lands once, in a frame shared with the others' pending deltas
+    std::remove(path.c_str());
+    {
+        std::vector<Dessert> desserts(4, Dessert("Sorbet", {"Lemon"}, 10, 4.0, Dish::CuisineType::FRENCH, Dessert::SOUR, 6, false));
+        ChangeLog log(path, ChangeLog::Options{512, true});
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < desserts.size(); ++t) {
+            desserts[t].setId(static_cast<DishId>(t));
+            desserts[t].setObserver(&log);
+            threads.emplace_back([&, t]() {
+                for (int i = 1; i <= 200; ++i) {
+                    desserts[t].setPrice(static_cast<double>(i * (t + 1)) / 100.0);
+                    if (i % 20 == 0) {
+                        log.commit();
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        CHECK(log.commit() == 800 && log.stats().commits <= 800);
+        Menu copies;
+        for (int i = 0; i < 4; ++i) {
+            copies.add(Dessert("Sorbet", {"Lemon"}, 10, 4.0, Dish::CuisineType::FRENCH, Dessert::SOUR, 6, false));
+        }
+        const ChangeLogReplayer::Result replayed = ChangeLogReplayer(path).catchUp(copies);
+        bool prices = replayed.deltas == 800;
+        for (std::size_t t = 0; t < desserts.size(); ++t) {
+            prices = prices && copies.visit(t, [&](const auto& dish) { return dish.getPriceCents() == desserts[t].getPriceCents(); });
+        }
+        CHECK(prices);
+    }
+
+    // A batch that cannot be written (here past the file size limit) is lost: the commits waiting for it throw, and
+    // none of them counts its deltas as durable
+    std::remove(path.c_str());
+    {
+        std::vector<Dessert> desserts(4, Dessert("Sorbet", {"Lemon"}, 10, 4.0, Dish::CuisineType::FRENCH, Dessert::SOUR, 6, false));
+        ChangeLog log(path, ChangeLog::Options{std::size_t{1} << 20, false});
+        for (std::size_t t = 0; t < desserts.size(); ++t) {
+            desserts[t].setId(static_cast<DishId>(t));
+            desserts[t].setObserver(&log);
+        }
+        desserts[0].setPrice(5.0);
+        CHECK(log.commit() == 1);
+        const std::uint64_t size = log.fileSize();
+
+        rlimit saved{};
+        getrlimit(RLIMIT_FSIZE, &saved);
+        rlimit limit = saved;
+        limit.rlim_cur = size;
+        void (*previous)(int) = std::signal(SIGXFSZ, SIG_IGN);
+        setrlimit(RLIMIT_FSIZE, &limit);
+        std::atomic<int> failures{0};
+        std::atomic<int> overstated{0};
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < desserts.size(); ++t) {
+            threads.emplace_back([&, t]() {
+                for (int i = 1; i <= 50; ++i) {
+                    desserts[t].setPrice(static_cast<double>(i));
+                    try {
+                        overstated += log.commit() != 1 ? 1 : 0;  // nothing after the first delta reached the file
+                    } catch (const std::runtime_error&) {
+                        ++failures;
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        setrlimit(RLIMIT_FSIZE, &saved);
+        std::signal(SIGXFSZ, previous);
+        CHECK(failures > 0 && overstated == 0 && log.fileSize() == size && log.stats().commits == 1);
+
+        desserts[1].setPrice(9.0);
+        CHECK(log.commit() == 2 && log.fileSize() > size);
+        Menu copies;
+        for (int i = 0; i < 4; ++i) {
+            copies.add(Dessert("Sorbet", {"Lemon"}, 10, 4.0, Dish::CuisineType::FRENCH, Dessert::SOUR, 6, false));
+        }
+        const ChangeLogReplayer::Result replayed = ChangeLogReplayer(path).catchUp(copies);
+        CHECK(replayed.complete && replayed.deltas == 2 && copies[0].getPrice() == 5.0 && copies[1].getPrice() == 9.0);
+    }
+
+    // Failures on the observer path do not stop the fan-out: the observers after the log still follow, and the next
+    // commit() reports the lost batch and the unrecorded change
+    std::remove(path.c_str());
+    {
+        Menu primary;
+        build(primary);
+        ChangeLog log(path, ChangeLog::Options{1, false});  // every delta fills a batch
+        RangeIndex prices;
+        primary.addObserver(&log);
+        primary.addObserver(&prices);
+        primary.forEach([&](const Dish& dish) { prices.add(dish); });
+        const std::uint64_t size = log.fileSize();
+
+        rlimit saved{};
+        getrlimit(RLIMIT_FSIZE, &saved);
+        rlimit limit = saved;
+        limit.rlim_cur = size;
+        void (*previous)(int) = std::signal(SIGXFSZ, SIG_IGN);
+        setrlimit(RLIMIT_FSIZE, &limit);
+        bool threw = false;
+        try {
+            primary.visit(0, [](auto& dish) { dish.setPrice(99.0); });
+        } catch (const std::exception&) {
+            threw = true;
+        }
+        setrlimit(RLIMIT_FSIZE, &saved);
+        std::signal(SIGXFSZ, previous);
+        RangeIndex::Query expensive;
+        expensive.min_price_cents = 9900;
+        CHECK(!threw && (prices.find(expensive) == std::vector<DishId>{0}) && primary.verifyStats());
+
+        bool reported = false;
+        try {
+            log.commit();
+        } catch (const std::runtime_error&) {
+            reported = true;
+        }
+        CHECK(reported && log.commit() == 0 && log.fileSize() == size);
+
+        Dish loose("Soup", {}, 5, 3.0);
+        loose.setObserver(&log);
+        loose.setPrice(4.0);  // no ID: not recorded, reported by the next commit
+        reported = false;
+        try {
+            log.commit();
+        } catch (const std::runtime_error&) {
+            reported = true;
+        }
+        CHECK(reported && log.commit() == 0);
+    }
+    std::remove(path.c_str());
+    std::remove(cut_path.c_str());
+}
+
+// Test: Instrumentation counts constructions, copies, accessor copies and path latencies when compiled in, reports
+// zeros when compiled out, and exports every class, accessor and path as text and JSON
+void checkInstrumentation() {
+    using Counted = Instrumentation::Class;
+    using Event = Instrumentation::Event;
+    using Accessor = Instrumentation::Accessor;
+    using Path = Instrumentation::Path;
+    Instrumentation::reset();
+    MainCourse main("Grilled Chicken", {"Chicken", "Free Range Chicken Thighs"}, 30, 18.99, Dish::CuisineType::AMERICAN, MainCourse::GRILLED, "Chicken",
+                    {MainCourse::SideDish("Rice", MainCourse::GRAIN), MainCourse::SideDish("Roasted Seasonal Root Vegetables With Herbs", MainCourse::VEGETABLE)},
+                    true);
+    const MainCourse copy(main);
+    const std::vector<std::string> ingredients = main.getIngredients();
+    const std::vector<MainCourse::SideDish> side_dishes = copy.getSideDishes();
+    std::string out;
+    MenuRenderer().render(main, out);
+    RangeIndex index;
+    main.setId(0);
+    index.add(main);
+    CHECK(index.count(RangeIndex::Query()) == 1);
+    std::thread([&copy]() { CHECK(copy.getName() == "Grilled Chicken"); }).join();  // the counts of an exited thread are kept
+    for (int i = 0; i < 99; ++i) {
+        Instrumentation::recordLatency(Path::IMPORT, 1000);
+    }
+    Instrumentation::recordLatency(Path::IMPORT, 1000000);
+
+    const Instrumentation::Snapshot snapshot = Instrumentation::snapshot();
+    if constexpr (Instrumentation::kEnabled) {
+        CHECK(snapshot.count(Counted::MAIN_COURSE, Event::CONSTRUCTION) == 1 && snapshot.count(Counted::DISH, Event::CONSTRUCTION) == 1);
+        CHECK(snapshot.count(Counted::MAIN_COURSE, Event::COPY) == 1 && snapshot.count(Counted::DISH, Event::COPY) == 1);
+        // The copy allocates for the side dish list and the long side dish name only: the name fits std::string's
+        // buffer, the ingredients the inline one
+        CHECK(snapshot.count(Counted::MAIN_COURSE, Event::ALLOCATION) == 2 && snapshot.count(Counted::DISH, Event::ALLOCATION) == 0);
+        const Instrumentation::AccessorStats& get_ingredients = snapshot.accessor(Accessor::GET_INGREDIENTS);
+        CHECK(get_ingredients.calls == 1 && get_ingredients.allocations == 2 && get_ingredients.bytes == 2 * sizeof(std::string) + 26);
+        const Instrumentation::AccessorStats& get_side_dishes = snapshot.accessor(Accessor::GET_SIDE_DISHES);
+        CHECK(get_side_dishes.calls == 1 && get_side_dishes.allocations == 2 && get_side_dishes.bytes == 2 * sizeof(MainCourse::SideDish) + 44);
+        CHECK(snapshot.accessor(Accessor::GET_NAME).calls == 1 && snapshot.accessor(Accessor::GET_NAME).allocations == 0);
+        CHECK(snapshot.latency(Path::RENDER).count == 1 && snapshot.latency(Path::RANGE_QUERY).count == 1 && snapshot.latency(Path::NAME_QUERY).count == 0);
+        const Instrumentation::Latency& import = snapshot.latency(Path::IMPORT);
+        CHECK(import.count == 100 && import.max_ns == 1000000 && import.total_ns == 99 * 1000 + 1000000);
+        CHECK(import.quantileNs(0.5) >= 1000 && import.quantileNs(0.5) < 1250 && import.quantileNs(0.99) < 1250 && import.quantileNs(1.0) == 1000000);
+        Instrumentation::reset();
+        CHECK(Instrumentation::snapshot().count(Counted::DISH, Event::COPY) == 0 && Instrumentation::snapshot().latency(Path::IMPORT).count == 0);
+    } else {
+        bool zero = true;
+        for (const auto& row : snapshot.events) {
+            zero = zero && std::all_of(row.begin(), row.end(), [](std::uint64_t value) { return value == 0; });
+        }
+        for (const Instrumentation::AccessorStats& stats : snapshot.accessors) {
+            zero = zero && stats.calls == 0 && stats.allocations == 0;
+        }
+        for (const Instrumentation::Latency& latency : snapshot.latencies) {
+            zero = zero && latency.count == 0 && latency.quantileNs(0.5) == 0;
+        }
+        CHECK(zero);
+    }
+    const std::string json = snapshot.toJson();
+    const std::string text = snapshot.toText();
+    CHECK(json.find(Instrumentation::kEnabled ? "{\"enabled\":true," : "{\"enabled\":false,") == 0 && json.back() == '}');
+    CHECK(json.find("\"MainCourse\":{\"constructions\":") != std::string::npos && json.find("\"getSideDishes\":{\"calls\":") != std::string::npos &&
+          json.find("\"dietary_query\":{\"count\":") != std::string::npos);
+    CHECK(text.find("Dessert") != std::string::npos && text.find("getProteinType") != std::string::npos && text.find("range_query") != std::string::npos);
+}
+
+// Test: every validator implementation agrees with std::isalpha / std::isspace on random names (differential fuzz)
+void checkNameValidator() {
+    auto reference = [](std::string_view name) {
+        for (char c : name) {
+            if (!std::isalpha(c) && !std::isspace(c)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Mostly valid names, so that invalid bytes land anywhere in long runs, with the bytes next to each valid range
+    const std::string valid = "abcxyzABCXYZ \t\n\v\f\r";
+    const std::string edges = std::string("@[`{\x08\x0e\x1f!\x7f\x80\xc1\xe1\xff\0", 14);
+    std::mt19937 rng(2024);
+    std::vector<std::string> storage(20000);
+    std::vector<std::string_view> names;
+    for (std::string& name : storage) {
+        const std::size_t length = rng() % 4 == 0 ? rng() % 100 : rng() % 20;
+        for (std::size_t i = 0; i < length; ++i) {
+            name.push_back(valid[rng() % valid.size()]);
+        }
+        if (length != 0 && rng() % 2 == 0) {
+            name[rng() % length] = rng() % 2 == 0 ? edges[rng() % edges.size()] : static_cast<char>(rng() % 256);
+        }
+        names.push_back(name);
+    }
+
+    const Bitmap expected = validateDishNames(names, NameValidatorIsa::LOCALE);
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        mismatches += (expected.test(i) == reference(names[i])) ? 1 : 0;  // a set bit means invalid
+        mismatches += (isValidDishName(names[i]) != reference(names[i])) ? 1 : 0;
+    }
+    CHECK(mismatches == 0);
+    CHECK(expected.count() > 1000 && expected.count() < names.size() - 1000);
+    for (NameValidatorIsa isa : {NameValidatorIsa::SCALAR, NameValidatorIsa::SSE2, NameValidatorIsa::AVX2}) {
+        const Bitmap actual = validateDishNames(names, isa);
+        CHECK(std::equal(actual.words(), actual.words() + actual.wordCount(), expected.words()));
+    }
+
+    // A thread with its own locale (uselocale) is validated by that locale's rules, before and after switching back
+    std::size_t thread_mismatches = 0;
+    std::thread([&] {
+        const locale_t utf8 = newlocale(LC_CTYPE_MASK, "C.UTF-8", static_cast<locale_t>(0));
+        for (const locale_t locale : {utf8, LC_GLOBAL_LOCALE}) {
+            if (locale == static_cast<locale_t>(0)) {
+                continue;  // not installed
+            }
+            uselocale(locale);
+            const Bitmap failures = validateDishNames(names);
+            for (std::size_t i = 0; i < names.size(); ++i) {
+                thread_mismatches += (failures.test(i) == reference(names[i])) ? 1 : 0;
+                thread_mismatches += (isValidDishName(names[i]) != reference(names[i])) ? 1 : 0;
+            }
+        }
+        if (utf8 != static_cast<locale_t>(0)) {
+            freelocale(utf8);
+        }
+    }).join();
+    CHECK(thread_mismatches == 0);
+}
+
+struct Check {
+    const char* name;
+    void (*run)();
+};
+
+const Check checks[] = {
+    {"dish_store", checkDishStore},
+    {"ingredient_index", checkIngredientIndex},
+    {"menu_renderer", checkMenuRenderer},
+    {"menu_snapshot", checkMenuSnapshot},
+    {"menu_importer", checkMenuImporter},
+    {"menu_arena", checkMenuArena},
+    {"small_vector", checkSmallVector},
+    {"menu", checkMenu},
+    {"name_validator", checkNameValidator},
+    {"dietary_index", checkDietaryIndex},
+    {"kitchen_scheduler", checkKitchenScheduler},
+    {"order_pipeline", checkOrderPipeline},
+    {"concurrent_menu", checkConcurrentMenu},
+    {"menu_analytics", checkMenuAnalytics},
+    {"menu_stats", checkMenuStats},
+    {"packed_layout", checkPackedLayout},
+    {"name_index", checkNameIndex},
+    {"dish_pool", checkDishPool},
+    {"range_index", checkRangeIndex},
+    {"change_log", checkChangeLog},
+    {"instrumentation", checkInstrumentation},
+};
+
+} // namespace
+
+int main() {
+    for (const Check& check : checks) {
+        const int before = g_failures;
+        std::cout << check.name << std::endl;
+        check.run();
+        std::cout << "  " << (g_failures == before ? "ok" : "failed") << std::endl;
+    }
+    return g_failures == 0 ? 0 : 1;
+}
@@ -11,6 +11,7 @@
 #include "Appetizer.hpp"
 #include "MainCourse.hpp"
 #include "Dessert.hpp"
+#include "EnumNames.hpp"
 #include <iostream>
 #include <iomanip>
 
@@ -36,7 +37,7 @@ int main() {
     std::cout << "Spiciness Level: " << appetizer.getSpicinessLevel() << std::endl;
 
     std::cout << "Serving Style: "
-              << (appetizer.getServingStyle() == Appetizer::ServingStyle::FAMILY_STYLE ? "FAMILY_STYLE" : "OTHER")
+              << toString(appetizer.getServingStyle())
               << std::endl;
 
     std::cout << "Vegetarian: " << (appetizer.isVegetarian() ? "True" : "False") << std::endl;
@@ -60,17 +61,18 @@ int main() {
 
     // Print additional MainCourse-specific attributes
     std::cout << "Cooking Method: "
-              << (grilledChicken.getCookingMethod() == MainCourse::CookingMethod::GRILLED ? "GRILLED" : "OTHER")
+              << toString(grilledChicken.getCookingMethod())
               << std::endl;
 
     std::cout << "Protein Type: " << grilledChicken.getProteinType() << std::endl;
 
     std::cout << "Side Dishes: ";
-    for (size_t i = 0; i < grilledChicken.getSideDishes().size(); ++i) {
-        std::cout << grilledChicken.getSideDishes()[i].name << " ("
-                  << (grilledChicken.getSideDishes()[i].category == MainCourse::Category::STARCHES ? "Starches" : "Vegetable")
+    Span<const MainCourse::SideDish> sides = grilledChicken.getSideDishesView(); //view, no copy per access
+    for (size_t i = 0; i < sides.size(); ++i) {
+        std::cout << sides[i].name << " ("
+                  << toDisplayString(sides[i].category)
                   << ")";
-        if (i < grilledChicken.getSideDishes().size() - 1) { //check if printing last element, then no comma
+        if (i < sides.size() - 1) { //check if printing last element, then no comma
             std::cout << ", ";
         }
     }
@@ -86,7 +88,7 @@ int main() {
     Dessert dessert("Chocolate Cake", {"Flour, Sugar, Cocoa Powder, Eggs"}, 45, 7.99, Dish::CuisineType::FRENCH, Dessert::FlavorProfile::SWEET, 9, false);
     dessert.display(); //display basic details
     std::cout << "Flavor Profile: "
-              << (dessert.getFlavorProfile() == Dessert::FlavorProfile::SWEET ? "SWEET" : "OTHER")
+              << toString(dessert.getFlavorProfile())
               << std::endl;
     std::cout << "Sweetness Level: " << dessert.getSweetnessLevel() << std::endl;
     std::cout << "Contains Nuts: " << (dessert.containsNuts() ? "True" : "False") << std::endl;